@@ -0,0 +1,127 @@
+#include "AssetLoader.h"
+#include <iostream>
+
+AssetLoader::AssetLoader()
+    : cancelled(false),
+      finished(0),
+      atlas(nullptr),
+      atlasPacked(false),
+      atlasUploaded(false) {
+}
+
+AssetLoader::~AssetLoader() {
+    Cancel();
+}
+
+void AssetLoader::SetAtlas(SpriteAtlas* spriteAtlas) {
+    if (worker.joinable()) {
+        return;
+    }
+    atlas = spriteAtlas;
+}
+
+void AssetLoader::Add(const std::string& path, Texture2D* target, int sprite) {
+    if (worker.joinable() || target == nullptr) {
+        return;
+    }
+    *target = Texture2D{};
+    jobs.push_back(Job{path, target, sprite});
+}
+
+void AssetLoader::Start() {
+    if (worker.joinable()) {
+        return;
+    }
+    if (jobs.empty()) {
+        atlasPacked.store(true);
+        return;
+    }
+    worker = std::thread(&AssetLoader::DecodeAll, this);
+}
+
+void AssetLoader::DecodeAll() {
+    for (size_t i = 0; i < jobs.size() && !cancelled.load(); i++) {
+        // LoadImage only reads and decodes the file; no GL calls
+        Image image = LoadImage(jobs[i].path.c_str());
+        if (atlas != nullptr && jobs[i].sprite != SpriteAtlas::NONE && image.data != nullptr) {
+            atlas->Pack(jobs[i].sprite, image);
+        }
+        std::lock_guard<std::mutex> lock(decodedMutex);
+        decoded.push_back(Decoded{i, image});
+    }
+    if (!cancelled.load()) {
+        atlasPacked.store(true);
+    }
+}
+
+int AssetLoader::UploadReady(int maxUploads) {
+    if (IsDone()) {
+        return 0;
+    }
+
+    int uploaded = 0;
+    if (atlas != nullptr && !atlasUploaded && atlasPacked.load()) {
+        // One texture for every grid sprite, so it goes first
+        if (atlas->Upload()) {
+            uploaded++;
+        }
+        atlasUploaded = true;
+    }
+
+    std::vector<Decoded> ready;
+    {
+        std::lock_guard<std::mutex> lock(decodedMutex);
+        size_t count = decoded.size();
+        if (maxUploads > 0 && count > static_cast<size_t>(maxUploads)) {
+            count = static_cast<size_t>(maxUploads);
+        }
+        ready.assign(decoded.begin(), decoded.begin() + count);
+        decoded.erase(decoded.begin(), decoded.begin() + count);
+    }
+
+    for (Decoded& item : ready) {
+        Job& job = jobs[item.job];
+        if (item.image.data != nullptr) {
+            *job.target = LoadTextureFromImage(item.image);
+            UnloadImage(item.image);
+            uploaded++;
+        } else {
+            std::cout << "[AssetLoader] Could not load " << job.path << std::endl;
+        }
+        finished++;
+    }
+
+    if (IsDone()) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+        std::cout << "[AssetLoader] All " << jobs.size() << " assets loaded" << std::endl;
+    }
+    return uploaded;
+}
+
+bool AssetLoader::IsDone() const {
+    return finished == jobs.size() && (atlas == nullptr || atlasUploaded);
+}
+
+size_t AssetLoader::GetJobCount() const {
+    return jobs.size();
+}
+
+size_t AssetLoader::GetFinishedCount() const {
+    return finished;
+}
+
+void AssetLoader::Cancel() {
+    cancelled.store(true);
+    if (worker.joinable()) {
+        worker.join();
+    }
+    std::lock_guard<std::mutex> lock(decodedMutex);
+    for (Decoded& item : decoded) {
+        if (item.image.data != nullptr) {
+            UnloadImage(item.image);
+        }
+    }
+    decoded.clear();
+}
@@ -0,0 +1,83 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "raylib.h"
+#include "SpriteAtlas.h"
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @class AssetLoader
+ * @brief Decodes image files on a background thread and uploads them as textures on the main thread
+ *
+ * Decoding a PNG is CPU work that raylib can do anywhere, but creating a
+ * texture needs the OpenGL context, which belongs to the main thread. The
+ * loader decodes every queued file with LoadImage() on its own thread and
+ * hands the images back; UploadReady(), called once per frame, turns a few
+ * of them into textures. Until then a target texture keeps id 0, which the
+ * screens already treat as "no texture".
+ *
+ * Files can also be packed into a SpriteAtlas. The worker packs them as it
+ * decodes them, and the atlas is uploaded as soon as the last one is in,
+ * ahead of any textures still waiting.
+ */
+class AssetLoader {
+private:
+    struct Job {
+        std::string path;
+        Texture2D* target;      // Filled in on upload; must outlive the loader
+        int sprite;             // Atlas sprite to pack the image into, or SpriteAtlas::NONE
+    };
+
+    struct Decoded {
+        size_t job;
+        Image image;
+    };
+
+    std::vector<Job> jobs;
+    std::vector<Decoded> decoded;   // Guarded by decodedMutex
+    std::mutex decodedMutex;
+    std::thread worker;
+    std::atomic<bool> cancelled;
+    size_t finished;                // Jobs uploaded or found missing
+    SpriteAtlas* atlas;             // Written only by the worker until atlasPacked is set
+    std::atomic<bool> atlasPacked;
+    bool atlasUploaded;
+
+    void DecodeAll();
+
+public:
+    AssetLoader();
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+
+    // Sets the atlas that sprites are packed into; call before Start()
+    void SetAtlas(SpriteAtlas* spriteAtlas);
+
+    // Queues a file, optionally also packing it into the atlas; call before Start()
+    void Add(const std::string& path, Texture2D* target, int sprite = SpriteAtlas::NONE);
+
+    // Starts decoding the queued files in the background
+    void Start();
+
+    // Uploads the atlas once packed, then up to maxUploads decoded images;
+    // returns how many textures were created
+    int UploadReady(int maxUploads);
+
+    // True once every queued file has been uploaded or found missing, and the atlas is uploaded
+    bool IsDone() const;
+
+    size_t GetJobCount() const;
+    size_t GetFinishedCount() const;
+
+    // Stops decoding and frees images that were never uploaded
+    void Cancel();
+};
+
+#endif // ASSET_LOADER_H
@@ -270,6 +270,9 @@ void CartViewScreen::DrawPlantDisplay() {
                 DrawTextureEx(ribbonTexture, Vector2{static_cast<float>(rx), static_cast<float>(ry)}, 0.0f, rs, WHITE);
             }
         }
+    } else if (manager->AreAssetsLoading()) {
+        manager->DrawTexturePlaceholder(Rectangle{displayBox.x + (displayBox.width - 220) / 2,
+                                                  displayBox.y + (displayBox.height - 300) / 2 - 20, 220, 300});
     } else {
         // Fallback: draw plant name
         const char* name = plant->getName().c_str();
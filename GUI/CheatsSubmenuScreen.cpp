@@ -125,15 +125,15 @@ void CheatsSubmenuScreen::ActivateFreePlants() {
     }
 
     // Get all plants on sales floor and set their price to 0
-    std::vector<Plant*> plants = salesFloor->getDisplayPlants();
     int count = 0;
 
-    for (Plant* plant : plants) {
+    for (Plant* plant : salesFloor->getGrid().getAll()) {
         if (plant != nullptr) {
             plant->setPrice(0.0);
             count++;
         }
     }
+    salesFloor->markChanged();
 
     freePlantsActive = true;
     std::cout << "[CHEAT] Free Plants activated! Set " << count << " plants to $0.00" << std::endl;
@@ -176,7 +176,7 @@ void CheatsSubmenuScreen::StockGreenhouse() {
             for (int row = 0; row < rows && !added; row++) {
                 for (int col = 0; col < cols && !added; col++) {
                     if (greenhouse->isPositionEmpty(row, col)) {
-                        Plant* plant = factory->buildPlant(manager->GetCareScheduler());
+                        Plant* plant = factory->buildPlant(nullptr); // care comes from the threshold monitor
                         if (plant != nullptr) {
                             if (greenhouse->addPlant(plant, row, col)) {
                                 count++;
@@ -202,10 +202,9 @@ void CheatsSubmenuScreen::MaxOutAllPlantStates() {
     }
 
     // Get all plants from greenhouse and set them to mature state
-    std::vector<Plant*> plants = greenhouse->getAllPlants();
     int count = 0;
 
-    for (Plant* plant : plants) {
+    for (Plant* plant : greenhouse->getGrid().getAll()) {
         if (plant != nullptr) {
             // Set to mature state
             plant->setState(new MatureState());
@@ -217,6 +216,7 @@ void CheatsSubmenuScreen::MaxOutAllPlantStates() {
             count++;
         }
     }
+    greenhouse->markChanged();
 
     maxOutPlantsActive = true;
     std::cout << "[CHEAT] Max Out All Plant States activated! Set " << count << " plants to Mature state" << std::endl;
@@ -1,5 +1,8 @@
 #include "CustomerGreenhouseScreen.h"
 #include "ScreenManager.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <cstring>
 #include <sstream>
@@ -18,8 +21,10 @@ CustomerGreenhouseScreen::CustomerGreenhouseScreen(ScreenManager* mgr)
       backButtonHovered(false),
       viewCartHovered(false) {
     
-    gridRows = 6;  // Greenhouse is 6x8
-    gridCols = 8;
+    // Size the grid from the greenhouse; the viewport scrolls if it does not fit
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    gridRows = (greenhouse != nullptr) ? greenhouse->getRows() : 6;
+    gridCols = (greenhouse != nullptr) ? greenhouse->getColumns() : 8;
     
     InitializeLayout();
     InitializeButtons();
@@ -46,13 +51,20 @@ void CustomerGreenhouseScreen::InitializeLayout() {
     int cellSizeByHeight = availableHeight / gridRows;
     
     cellSize = (cellSizeByWidth < cellSizeByHeight) ? cellSizeByWidth : cellSizeByHeight;
+    if (cellSize < GreenhouseViewport::MIN_CELL_SIZE) {
+        cellSize = GreenhouseViewport::MIN_CELL_SIZE;
+    }
     
-    // Center the grid in the middle panel
+    // Center the grid in the middle panel, or start at its corner if it is too big
     int gridTotalWidth = cellSize * gridCols;
     int gridTotalHeight = cellSize * gridRows;
     
-    gridStartX = leftPanelWidth + (middlePanelWidth - gridTotalWidth) / 2;
-    gridStartY = 60 + (screenHeight - 60 - gridTotalHeight) / 2;
+    gridStartX = leftPanelWidth + std::max(10, (middlePanelWidth - gridTotalWidth) / 2);
+    gridStartY = 60 + std::max(10, (screenHeight - 60 - gridTotalHeight) / 2);
+
+    gridViewport.SetLayout(Rectangle{static_cast<float>(leftPanelWidth), 60.0f,
+                                     static_cast<float>(middlePanelWidth), static_cast<float>(screenHeight - 60)},
+                           gridStartX, gridStartY, cellSize, gridRows, gridCols);
 }
 
 void CustomerGreenhouseScreen::InitializeButtons() {
@@ -83,18 +95,13 @@ void CustomerGreenhouseScreen::Update() {
 }
 
 void CustomerGreenhouseScreen::UpdateGrid() {
-    Vector2 mousePos = GetMousePosition();
-    
-    // Check if mouse is over grid
-    if (mousePos.x >= gridStartX && mousePos.x < gridStartX + (cellSize * gridCols) &&
-        mousePos.y >= gridStartY && mousePos.y < gridStartY + (cellSize * gridRows)) {
-        
-        int col = static_cast<int>((mousePos.x - gridStartX) / cellSize);
-        int row = static_cast<int>((mousePos.y - gridStartY) / cellSize);
-        
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-            HandlePlantSelection(row, col);
-        }
+    gridViewport.Update();
+
+    // Check if mouse is over a cell (through the viewport's zoom and scroll)
+    int row = 0;
+    int col = 0;
+    if (gridViewport.GetCellAt(GetMousePosition(), row, col) && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        HandlePlantSelection(row, col);
     }
 }
 
@@ -143,7 +150,22 @@ void CustomerGreenhouseScreen::Draw() {
         : Color{216, 228, 220, 255}; // Soft sage green
     ClearBackground(bgColor);
 
-    DrawLeftPanel();
+    // Customer details and the selected plant only change with the customer or the greenhouse
+    Customer* customer = manager->GetCustomer();
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    uint64_t infoKey = reinterpret_cast<uintptr_t>(customer);
+    infoKey = LayerCache::Mix(infoKey, customer != nullptr ? customer->getChangeCount() : 0);
+    infoKey = LayerCache::Mix(infoKey, greenhouse != nullptr ? greenhouse->getChangeCount() : 0);
+    infoKey = LayerCache::Mix(infoKey, reinterpret_cast<uintptr_t>(selectedPlant));
+    infoKey = LayerCache::Mix(infoKey, manager->IsAlternativeColors());
+
+    Rectangle infoArea = {0, 0, static_cast<float>(leftPanelWidth + 1), static_cast<float>(screenHeight)};
+    if (infoLayer.BeginUpdate(infoArea, infoKey, bgColor)) {
+        DrawLeftPanel();
+        infoLayer.EndUpdate();
+    }
+    infoLayer.Draw();
+
     DrawMiddlePanel();
     DrawRightPanel();
 }
@@ -276,8 +298,25 @@ void CustomerGreenhouseScreen::DrawMiddlePanel() {
              20,
              headerSize,
              headerColor);
+    gridViewport.DrawStatus(lineColor);
 
-    DrawGrid();
+    // The grid is redrawn when the greenhouse changes, or the camera or selection moves
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    Vector2 target = gridViewport.GetTarget();
+    uint64_t gridKey = greenhouse != nullptr ? greenhouse->getChangeCount() : 0;
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedRow));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedCol));
+    gridKey = LayerCache::Mix(gridKey, manager->IsAlternativeColors());
+    gridKey = LayerCache::Mix(gridKey, manager->AreAssetsLoading());
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(gridViewport.GetZoom() * 1000)));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(target.x * gridViewport.GetZoom())));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(target.y * gridViewport.GetZoom())));
+
+    if (gridLayer.BeginUpdate(gridViewport.GetArea(), gridKey, middleBg)) {
+        DrawGrid();
+        gridLayer.EndUpdate();
+    }
+    gridLayer.Draw();
 }
 
 void CustomerGreenhouseScreen::DrawRightPanel() {
@@ -363,8 +402,24 @@ void CustomerGreenhouseScreen::DrawGrid() {
         ? Color{80, 90, 85, 255}     // Grey-green
         : Color{200, 210, 205, 255}; // Light sage
 
-    for (int row = 0; row < gridRows; row++) {
-        for (int col = 0; col < gridCols; col++) {
+    gridViewport.Begin(gridLayer.GetOrigin());
+
+    if (gridViewport.IsOverview()) {
+        // Too small to draw plants: show occupancy and health per tile instead
+        gridViewport.DrawOverview(*greenhouse, manager->IsAlternativeColors());
+        if (selectedRow >= 0 && selectedCol >= 0) {
+            DrawRectangleLinesEx(gridViewport.GetCellRect(selectedRow, selectedCol),
+                                 2.0f / gridViewport.GetZoom(), cellBorder);
+        }
+        gridViewport.End();
+        return;
+    }
+
+    // Only the cells the camera can see. Cells, then sprites, then labels,
+    // so every sprite goes out in one batch.
+    GridRegion visible = gridViewport.GetVisibleCells();
+    for (int row = visible.row; row < visible.row + visible.rowCount; row++) {
+        for (int col = visible.col; col < visible.col + visible.colCount; col++) {
             int x = gridStartX + col * cellSize;
             int y = gridStartY + row * cellSize;
 
@@ -375,36 +430,54 @@ void CustomerGreenhouseScreen::DrawGrid() {
 
             DrawRectangle(x + 1, y + 1, cellSize - 2, cellSize - 2, cellColor);
             DrawRectangleLines(x + 1, y + 1, cellSize - 2, cellSize - 2, cellBorder);
-
-            Plant* plant = greenhouse->getPlantAt(row, col);
-            if (plant != nullptr) {
-                DrawPlantInCell(plant, row, col);
-            }
         }
     }
+
+    greenhouse->forEachPlant(visible, [this](Plant* plant, int row, int col) {
+        DrawPlantSprite(plant, row, col);
+    });
+    greenhouse->forEachPlant(visible, [this](Plant* plant, int row, int col) {
+        DrawPlantInCell(plant, row, col);
+    });
+
+    gridViewport.End();
+}
+
+void CustomerGreenhouseScreen::DrawPlantSprite(Plant* plant, int row, int col) {
+    int sprite = manager->GetPlantSprite(plant);
+    if (!manager->IsSpriteReady(sprite)) {
+        return;
+    }
+
+    int x = gridStartX + col * cellSize;
+    int y = gridStartY + row * cellSize;
+
+    // Calculate scaling to fit in cell
+    Rectangle frame = manager->GetSpriteFrame(sprite);
+    int maxSize = cellSize - 20;
+    float scale = static_cast<float>(maxSize) / frame.height;
+
+    int scaledWidth = static_cast<int>(frame.width * scale);
+    int scaledHeight = static_cast<int>(frame.height * scale);
+
+    // Center sprite in cell
+    int texX = x + (cellSize - scaledWidth) / 2;
+    int texY = y + (cellSize - scaledHeight) / 2 - 5;
+
+    manager->DrawSprite(sprite, Vector2{static_cast<float>(texX), static_cast<float>(texY)}, scale, WHITE);
 }
 
 void CustomerGreenhouseScreen::DrawPlantInCell(Plant* plant, int row, int col) {
     int x = gridStartX + col * cellSize;
     int y = gridStartY + row * cellSize;
-    
-    // Get plant texture
-    Texture2D plantTexture = manager->GetPlantTexture(plant->getName());
-    
-    if (plantTexture.id != 0) {
-        // Calculate scaling to fit in cell
+
+    if (manager->IsSpriteReady(manager->GetPlantSprite(plant))) {
+        // Drawn by DrawPlantSprite()
+    } else if (manager->AreAssetsLoading()) {
         int maxSize = cellSize - 20;
-        float scale = static_cast<float>(maxSize) / plantTexture.height;
-        
-        int scaledWidth = static_cast<int>(plantTexture.width * scale);
-        int scaledHeight = static_cast<int>(plantTexture.height * scale);
-        
-        // Center texture in cell
-        int texX = x + (cellSize - scaledWidth) / 2;
-        int texY = y + (cellSize - scaledHeight) / 2 - 5;
-        
-        // Draw with full color
-        DrawTextureEx(plantTexture, Vector2{static_cast<float>(texX), static_cast<float>(texY)}, 0.0f, scale, WHITE);
+        manager->DrawTexturePlaceholder(Rectangle{static_cast<float>(x + (cellSize - maxSize) / 2),
+                                                  static_cast<float>(y + (cellSize - maxSize) / 2 - 5),
+                                                  static_cast<float>(maxSize), static_cast<float>(maxSize)});
     } else {
         Color nameColor = manager->IsAlternativeColors()
             ? Color{200, 200, 200, 255}  // Light grey
@@ -2,6 +2,8 @@
 #define CUSTOMER_GREENHOUSE_SCREEN_H
 
 #include "raylib.h"
+#include "GreenhouseViewport.h"
+#include "LayerCache.h"
 #include <string>
 
 class ScreenManager;
@@ -24,6 +26,11 @@ private:
     int cellSize;
     int gridStartX;
     int gridStartY;
+    GreenhouseViewport gridViewport;
+
+    // Cached layers, redrawn only when what they show changes
+    LayerCache infoLayer;
+    LayerCache gridLayer;
     
     // Selection state
     int selectedRow;
@@ -47,6 +54,7 @@ private:
     void DrawMiddlePanel();
     void DrawRightPanel();
     void DrawGrid();
+    void DrawPlantSprite(Plant* plant, int row, int col);
     void DrawPlantInCell(Plant* plant, int row, int col);
     void DrawButtons();
     
@@ -364,6 +364,9 @@ void DecorationScreen::DrawPlantPreview() {
                 DrawTextureEx(ribbonTexture, Vector2{(float)rx, (float)ry}, 0.0f, rs, WHITE);
             }
         }
+    } else if (manager->AreAssetsLoading()) {
+        manager->DrawTexturePlaceholder(Rectangle{previewBox.x + (previewBox.width - 150) / 2,
+                                                  previewBox.y + (previewBox.height - 200) / 2 - 10, 150, 200});
     }
     
     // Remove buttons if decorations exist
@@ -458,6 +461,9 @@ void DecorationScreen::DrawPotSelection() {
             int texY = potButtons[i].y + (potButtons[i].height - texHeight) / 2;
             DrawTextureEx(potTexture, Vector2{static_cast<float>(texX), static_cast<float>(texY)},
                           0.0f, scale, WHITE);
+        } else if (manager->AreAssetsLoading()) {
+            manager->DrawTexturePlaceholder(Rectangle{potButtons[i].x + (potButtons[i].width - 50) / 2,
+                                                      potButtons[i].y + (potButtons[i].height - 50) / 2, 50, 50});
         }
     }
 }
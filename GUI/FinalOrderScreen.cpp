@@ -5,6 +5,9 @@
 #include "../include/PaymentProcessor.h"
 #include "../include/CashPayment.h"
 #include "../include/CreditCardPayment.h"
+#include "../include/SalesLedger.h"
+#include "../include/OrderHistory.h"
+#include "../include/TransactionJournal.h"
 #include "../include/Iterator.h"
 #include <iostream>
 #include <iomanip>
@@ -839,8 +842,15 @@ bool FinalOrderScreen::ProcessPayment(bool isCash) {
 
     // Deduct from customer budget
     bool deducted = customer->deductFromBudget(orderTotal);
+    // Commit the checkout: the sale, payment and cart transfers become durable together
+    TransactionJournal::getInstance()->commit();
 
     if (deducted) {
+        SalesLedger::getInstance()->recordOrder(finalOrder, customer, paymentProcessor);
+        OrderHistory* history = manager->GetOrderHistory();
+        if (history != nullptr && history->isOpen()) {
+            history->append(finalOrder, customer->getId(), manager->GetDaysCounter());
+        }
         paymentSuccessful = true;
         customerBalance = customer->getBudget();
         std::cout << "[FinalOrderScreen] Payment successful! New balance: R" << customerBalance << "\n";
@@ -0,0 +1,255 @@
+#include "GreenhouseViewport.h"
+#include <cmath>
+#include <sstream>
+
+// Backend includes
+#include "../include/Greenhouse.h"
+#include "../include/Plant.h"
+
+namespace {
+
+const float EDGE_PADDING = 10.0f;   // World pixels the camera may show past the grid edges
+
+// Keeps the visible span over the grid on one axis, or centres the grid if it fits
+float ClampAxis(float target, float visible, float start, float length) {
+    if (length + 2 * EDGE_PADDING <= visible) {
+        return start + length / 2 - visible / 2;
+    }
+    if (target < start - EDGE_PADDING) {
+        return start - EDGE_PADDING;
+    }
+    if (target > start + length + EDGE_PADDING - visible) {
+        return start + length + EDGE_PADDING - visible;
+    }
+    return target;
+}
+
+unsigned char Mix(unsigned char from, unsigned char to, float amount) {
+    return static_cast<unsigned char>(from + (to - from) * amount);
+}
+
+Color Blend(Color from, Color to, float amount) {
+    return Color{Mix(from.r, to.r, amount), Mix(from.g, to.g, amount), Mix(from.b, to.b, amount), 255};
+}
+
+// Same colours as the staff screen's health bars, blended instead of stepped
+Color HealthColor(float health) {
+    Color bad = Color{200, 100, 100, 255};      // Red
+    Color fair = Color{235, 186, 170, 255};     // Peach
+    Color good = Color{120, 165, 120, 255};     // Sage green
+    if (health < 0.5f) {
+        return Blend(bad, fair, health / 0.5f);
+    }
+    return Blend(fair, good, (health - 0.5f) / 0.5f);
+}
+
+}
+
+GreenhouseViewport::GreenhouseViewport()
+    : camera{},
+      viewport{0, 0, 0, 0},
+      bounds{0, 0, 0, 0},
+      cellSize(1.0f),
+      rows(0),
+      cols(0),
+      minZoom(1.0f),
+      dragging(false),
+      lastMouse{0, 0} {
+    camera.zoom = 1.0f;
+}
+
+void GreenhouseViewport::SetLayout(Rectangle screenArea, int gridX, int gridY, int cell, int gridRows, int gridCols) {
+    viewport = screenArea;
+    cellSize = static_cast<float>(cell);
+    rows = gridRows;
+    cols = gridCols;
+    bounds = Rectangle{static_cast<float>(gridX), static_cast<float>(gridY), cols * cellSize, rows * cellSize};
+
+    camera.offset = Vector2{viewport.x, viewport.y};
+    camera.target = Vector2{viewport.x, viewport.y};
+    camera.rotation = 0.0f;
+    camera.zoom = 1.0f;
+
+    // Zooming out stops once the whole grid fits
+    float fitX = viewport.width / (bounds.width + 2 * EDGE_PADDING);
+    float fitY = viewport.height / (bounds.height + 2 * EDGE_PADDING);
+    minZoom = fitX < fitY ? fitX : fitY;
+    if (minZoom > 1.0f) {
+        minZoom = 1.0f;
+    }
+
+    dragging = false;
+    ClampCamera();
+}
+
+void GreenhouseViewport::ClampCamera() {
+    float visibleWidth = viewport.width / camera.zoom;
+    float visibleHeight = viewport.height / camera.zoom;
+    camera.target.x = ClampAxis(camera.target.x, visibleWidth, bounds.x, bounds.width);
+    camera.target.y = ClampAxis(camera.target.y, visibleHeight, bounds.y, bounds.height);
+
+    // Whole screen pixels, so text and sprites do not shimmer while panning
+    camera.target.x = std::round(camera.target.x * camera.zoom) / camera.zoom;
+    camera.target.y = std::round(camera.target.y * camera.zoom) / camera.zoom;
+}
+
+void GreenhouseViewport::Update() {
+    Vector2 mouse = GetMousePosition();
+    bool overViewport = CheckCollisionPointRec(mouse, viewport);
+
+    float wheel = overViewport ? GetMouseWheelMove() : 0.0f;
+    if (wheel != 0.0f) {
+        // Keep the point under the cursor still while zooming
+        Vector2 anchor = GetScreenToWorld2D(mouse, camera);
+        float zoom = camera.zoom * std::pow(ZOOM_STEP, wheel);
+        if (zoom < minZoom) zoom = minZoom;
+        if (zoom > MAX_ZOOM) zoom = MAX_ZOOM;
+
+        camera.zoom = zoom;
+        camera.target.x = anchor.x - (mouse.x - camera.offset.x) / zoom;
+        camera.target.y = anchor.y - (mouse.y - camera.offset.y) / zoom;
+    }
+
+    if (overViewport && IsMouseButtonPressed(MOUSE_BUTTON_RIGHT)) {
+        dragging = true;
+        lastMouse = mouse;
+    }
+    if (dragging) {
+        if (IsMouseButtonDown(MOUSE_BUTTON_RIGHT)) {
+            camera.target.x -= (mouse.x - lastMouse.x) / camera.zoom;
+            camera.target.y -= (mouse.y - lastMouse.y) / camera.zoom;
+            lastMouse = mouse;
+        } else {
+            dragging = false;
+        }
+    }
+
+    ClampCamera();
+}
+
+void GreenhouseViewport::Begin(Vector2 origin) const {
+    BeginScissorMode(static_cast<int>(viewport.x - origin.x), static_cast<int>(viewport.y - origin.y),
+                     static_cast<int>(viewport.width), static_cast<int>(viewport.height));
+
+    // BeginMode2D() replaces any camera already active, including a layer's shift
+    Camera2D shifted = camera;
+    shifted.offset = Vector2{camera.offset.x - origin.x, camera.offset.y - origin.y};
+    BeginMode2D(shifted);
+}
+
+void GreenhouseViewport::End() const {
+    EndMode2D();
+    EndScissorMode();
+}
+
+GridRegion GreenhouseViewport::GetVisibleCells() const {
+    float visibleWidth = viewport.width / camera.zoom;
+    float visibleHeight = viewport.height / camera.zoom;
+
+    int firstCol = static_cast<int>(std::floor((camera.target.x - bounds.x) / cellSize));
+    int lastCol = static_cast<int>(std::floor((camera.target.x + visibleWidth - bounds.x) / cellSize));
+    int firstRow = static_cast<int>(std::floor((camera.target.y - bounds.y) / cellSize));
+    int lastRow = static_cast<int>(std::floor((camera.target.y + visibleHeight - bounds.y) / cellSize));
+
+    if (firstCol < 0) firstCol = 0;
+    if (firstRow < 0) firstRow = 0;
+    if (lastCol > cols - 1) lastCol = cols - 1;
+    if (lastRow > rows - 1) lastRow = rows - 1;
+
+    if (lastCol < firstCol || lastRow < firstRow) {
+        return GridRegion{0, 0, 0, 0};
+    }
+    return GridRegion{firstRow, firstCol, lastRow - firstRow + 1, lastCol - firstCol + 1};
+}
+
+bool GreenhouseViewport::GetCellAt(Vector2 screenPosition, int& row, int& col) const {
+    if (!CheckCollisionPointRec(screenPosition, viewport)) {
+        return false;
+    }
+
+    Vector2 world = GetScreenToWorld2D(screenPosition, camera);
+    if (world.x < bounds.x || world.y < bounds.y) {
+        return false;
+    }
+
+    col = static_cast<int>((world.x - bounds.x) / cellSize);
+    row = static_cast<int>((world.y - bounds.y) / cellSize);
+    return row < rows && col < cols;
+}
+
+Rectangle GreenhouseViewport::GetCellRect(int row, int col) const {
+    return Rectangle{bounds.x + col * cellSize, bounds.y + row * cellSize, cellSize, cellSize};
+}
+
+float GreenhouseViewport::GetZoom() const {
+    return camera.zoom;
+}
+
+Vector2 GreenhouseViewport::GetTarget() const {
+    return camera.target;
+}
+
+Rectangle GreenhouseViewport::GetArea() const {
+    return viewport;
+}
+
+bool GreenhouseViewport::IsOverview() const {
+    return cellSize * camera.zoom < OVERVIEW_CELL_PIXELS;
+}
+
+void GreenhouseViewport::DrawOverview(const Greenhouse& greenhouse, bool alternativeColors) {
+    GridRegion visible = GetVisibleCells();
+    if (visible.rowCount == 0 || visible.colCount == 0) {
+        return;
+    }
+
+    // Square tiles of span x span cells, aligned to the grid origin
+    int span = static_cast<int>(std::ceil(OVERVIEW_TILE_PIXELS / (cellSize * camera.zoom)));
+    if (span < 1) span = 1;
+
+    int firstTileRow = visible.row / span;
+    int firstTileCol = visible.col / span;
+    int tileRows = (visible.row + visible.rowCount - 1) / span - firstTileRow + 1;
+    int tileCols = (visible.col + visible.colCount - 1) / span - firstTileCol + 1;
+
+    tilePlants.assign(static_cast<size_t>(tileRows) * tileCols, 0);
+    tileHealth.assign(static_cast<size_t>(tileRows) * tileCols, 0);
+
+    // Only plants under the visible tiles are touched
+    GridRegion covered = {firstTileRow * span, firstTileCol * span, tileRows * span, tileCols * span};
+    greenhouse.forEachPlant(covered, [&](Plant* plant, int row, int col) {
+        size_t tile = static_cast<size_t>(row / span - firstTileRow) * tileCols + (col / span - firstTileCol);
+        tilePlants[tile]++;
+        tileHealth[tile] += plant->getHealthLevel();
+    });
+
+    Color empty = alternativeColors
+        ? Color{50, 55, 50, 255}     // Dark cell
+        : Color{245, 250, 247, 255}; // Light cell
+
+    for (int tileRow = 0; tileRow < tileRows; tileRow++) {
+        for (int tileCol = 0; tileCol < tileCols; tileCol++) {
+            int row = (firstTileRow + tileRow) * span;
+            int col = (firstTileCol + tileCol) * span;
+            int rowsInTile = (rows - row < span) ? rows - row : span;
+            int colsInTile = (cols - col < span) ? cols - col : span;
+
+            Color color = empty;
+            size_t tile = static_cast<size_t>(tileRow) * tileCols + tileCol;
+            if (tilePlants[tile] > 0) {
+                float health = tileHealth[tile] / (100.0f * tilePlants[tile]);
+                float occupancy = tilePlants[tile] / static_cast<float>(rowsInTile * colsInTile);
+                color = Blend(empty, HealthColor(health), 0.35f + 0.65f * occupancy);
+            }
+
+            DrawRectangleRec(Rectangle{bounds.x + col * cellSize, bounds.y + row * cellSize,
+                                       colsInTile * cellSize, rowsInTile * cellSize}, color);
+        }
+    }
+}
+
+void GreenhouseViewport::DrawStatus(Color textColor) const {
+    std::ostringstream status;
+    status << static_cast<int>(camera.zoom * 100 + 0.5f) << "%  -  wheel to zoom, right-drag to pan";
+    DrawText(status.str().c_str(), static_cast<int>(viewport.x) + 10, static_cast<int>(viewport.y) - 16, 12, textColor);
+}
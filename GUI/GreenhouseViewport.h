@@ -0,0 +1,89 @@
+#ifndef GREENHOUSE_VIEWPORT_H
+#define GREENHOUSE_VIEWPORT_H
+
+#include "raylib.h"
+#include <vector>
+
+#include "../include/PlantGrid.h"
+
+class Greenhouse;
+
+/**
+ * @class GreenhouseViewport
+ * @brief Scrollable, zoomable window onto a greenhouse grid
+ *
+ * The grid is laid out in world coordinates (gridX + col * cellSize, ...)
+ * and shown through a Camera2D, so screens keep drawing cells exactly as
+ * they did before. Screens ask GetVisibleCells() which cells the camera can
+ * see and only fetch and draw those, so a frame costs the same whether the
+ * greenhouse has fifty cells or fifty thousand.
+ *
+ * When cells shrink below OVERVIEW_CELL_PIXELS on screen, drawing each one
+ * stops being useful. DrawOverview() then draws aggregated tiles instead:
+ * the colour shows the average health of the plants in the tile and its
+ * strength shows how full the tile is.
+ *
+ * Mouse wheel zooms around the cursor; dragging with the right button pans.
+ */
+class GreenhouseViewport {
+public:
+    static const int MIN_CELL_SIZE = 48;            // Cells are never laid out smaller; the camera scrolls instead
+    static constexpr float MAX_ZOOM = 3.0f;
+    static constexpr float ZOOM_STEP = 1.15f;       // Zoom factor per wheel notch
+    static const int OVERVIEW_CELL_PIXELS = 24;     // Below this on-screen size, draw tiles instead of cells
+    static const int OVERVIEW_TILE_PIXELS = 16;     // Smallest on-screen size of an overview tile
+
+private:
+    Camera2D camera;        // offset stays at the viewport's top-left corner
+    Rectangle viewport;     // Screen area the grid is shown in
+    Rectangle bounds;       // World area covered by the grid
+    float cellSize;
+    int rows;
+    int cols;
+    float minZoom;
+    bool dragging;
+    Vector2 lastMouse;
+
+    // Reused by DrawOverview() so overview frames do not allocate
+    std::vector<int> tilePlants;
+    std::vector<int> tileHealth;
+
+    void ClampCamera();
+
+public:
+    GreenhouseViewport();
+
+    // Lays the grid out at gridX/gridY in world space and resets the camera so that
+    // world and screen coordinates match
+    void SetLayout(Rectangle screenArea, int gridX, int gridY, int cell, int gridRows, int gridCols);
+
+    // Handles zooming and panning while the mouse is over the viewport
+    void Update();
+
+    // Clips to the viewport and applies the camera; pair with End(). When drawing
+    // into a LayerCache, pass its origin so the grid lands in the right place.
+    void Begin(Vector2 origin = Vector2{0, 0}) const;
+    void End() const;
+
+    // Cells the camera can see, clipped to the grid; zero-sized if none
+    GridRegion GetVisibleCells() const;
+
+    // Converts a screen position to a cell; false if it is outside the viewport or the grid
+    bool GetCellAt(Vector2 screenPosition, int& row, int& col) const;
+
+    // World-space rectangle of a cell, for drawing inside Begin()/End()
+    Rectangle GetCellRect(int row, int col) const;
+
+    float GetZoom() const;
+    Vector2 GetTarget() const;
+    Rectangle GetArea() const;
+    bool IsOverview() const;
+
+    // Draws occupancy/health tiles for the visible part of the greenhouse; call inside Begin()/End()
+    void DrawOverview(const Greenhouse& greenhouse, bool alternativeColors);
+
+    // Draws the zoom level and controls in the viewport's bottom-left corner; call outside Begin()/End()
+    void DrawStatus(Color textColor) const;
+};
+
+#endif // GREENHOUSE_VIEWPORT_H
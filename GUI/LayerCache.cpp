@@ -0,0 +1,92 @@
+#include "LayerCache.h"
+
+LayerCache::LayerCache()
+    : target{},
+      area{0, 0, 0, 0},
+      key(0),
+      valid(false),
+      direct(false) {
+}
+
+LayerCache::~LayerCache() {
+    // Screens outlive the window; its framebuffers are already gone by then
+    if (IsWindowReady()) {
+        Unload();
+    }
+}
+
+uint64_t LayerCache::Mix(uint64_t key, uint64_t value) {
+    // Same mixing step as boost::hash_combine, widened to 64 bits
+    return key ^ (value + 0x9e3779b97f4a7c15ULL + (key << 6) + (key >> 2));
+}
+
+bool LayerCache::BeginUpdate(Rectangle screenArea, uint64_t newKey, Color background) {
+    bool sameArea = screenArea.x == area.x && screenArea.y == area.y &&
+                    screenArea.width == area.width && screenArea.height == area.height;
+    if (valid && sameArea && newKey == key) {
+        return false;
+    }
+
+    int width = static_cast<int>(screenArea.width);
+    int height = static_cast<int>(screenArea.height);
+    if (target.id == 0 || target.texture.width != width || target.texture.height != height) {
+        Unload();
+        if (width > 0 && height > 0) {
+            target = LoadRenderTexture(width, height);
+        }
+    }
+
+    area = screenArea;
+    key = newKey;
+
+    // No framebuffer: draw this frame's layer straight to the screen
+    direct = target.id == 0;
+    if (direct) {
+        valid = false;
+        return true;
+    }
+
+    BeginTextureMode(target);
+    ClearBackground(background);
+
+    // Shift screen coordinates so the area's corner lands on the texture's corner
+    Camera2D shift = {};
+    shift.offset = Vector2{-area.x, -area.y};
+    shift.zoom = 1.0f;
+    BeginMode2D(shift);
+    return true;
+}
+
+void LayerCache::EndUpdate() {
+    if (direct) {
+        return;
+    }
+    EndMode2D();
+    EndTextureMode();
+    valid = true;
+}
+
+void LayerCache::Draw() const {
+    if (!valid) {
+        return;
+    }
+    // Render textures are stored upside down, hence the negative height
+    Rectangle source = {0, 0, static_cast<float>(target.texture.width), -static_cast<float>(target.texture.height)};
+    DrawTextureRec(target.texture, source, Vector2{area.x, area.y}, WHITE);
+}
+
+Vector2 LayerCache::GetOrigin() const {
+    return direct ? Vector2{0, 0} : Vector2{area.x, area.y};
+}
+
+void LayerCache::Invalidate() {
+    valid = false;
+}
+
+void LayerCache::Unload() {
+    if (target.id != 0) {
+        UnloadRenderTexture(target);
+        target = RenderTexture2D{};
+    }
+    valid = false;
+}
@@ -0,0 +1,67 @@
+#ifndef LAYER_CACHE_H
+#define LAYER_CACHE_H
+
+#include "raylib.h"
+#include <cstdint>
+
+/**
+ * @class LayerCache
+ * @brief Keeps a static part of a screen in a render texture between frames
+ *
+ * Most of what the grid and info panels draw only changes when the backend
+ * does: a day passes, a cell is filled, the cart is edited. Redrawing all of
+ * it every frame costs hundreds of draw calls for nothing. A screen instead
+ * builds a key from what the layer depends on (usually the change count of
+ * the greenhouse, sales floor or customer it shows, plus its own selection
+ * and colour mode) and redraws the layer into the texture only when the key
+ * moves. Every other frame is one textured quad.
+ *
+ *     if (layer.BeginUpdate(area, key, background)) {
+ *         DrawGrid();
+ *         layer.EndUpdate();
+ *     }
+ *     layer.Draw();
+ *
+ * Between BeginUpdate() and EndUpdate() the usual screen coordinates apply.
+ * Hover effects and anything animated are drawn after Draw(), straight to the
+ * screen. If no render texture can be created the layer is drawn directly
+ * every frame, exactly as it was before caching.
+ */
+class LayerCache {
+private:
+    RenderTexture2D target;
+    Rectangle area;     // Screen area the texture covers
+    uint64_t key;       // Key the texture was last drawn with
+    bool valid;
+    bool direct;        // Drawing straight to the screen this frame
+
+public:
+    LayerCache();
+    ~LayerCache();
+
+    LayerCache(const LayerCache&) = delete;
+    LayerCache& operator=(const LayerCache&) = delete;
+
+    // Combines a value into a layer key
+    static uint64_t Mix(uint64_t key, uint64_t value);
+
+    // Returns false if the texture already holds this area drawn with this key.
+    // Otherwise clears the texture to the background and starts drawing into it;
+    // draw the layer, then call EndUpdate().
+    bool BeginUpdate(Rectangle screenArea, uint64_t newKey, Color background);
+    void EndUpdate();
+
+    // Draws the cached layer at its screen area
+    void Draw() const;
+
+    // Screen position of the texture's top-left corner, for cameras used inside BeginUpdate()
+    Vector2 GetOrigin() const;
+
+    // Forces a redraw on the next BeginUpdate()
+    void Invalidate();
+
+    // Frees the render texture; must run while the window is still open
+    void Unload();
+};
+
+#endif // LAYER_CACHE_H
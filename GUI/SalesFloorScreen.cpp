@@ -5,6 +5,7 @@
 #include <sstream>
 #include <iomanip>
 #include <algorithm>
+#include <cstdint>
 #include <vector>
 
 // Backend includes
@@ -281,10 +282,9 @@ void SalesFloorScreen::UpdateReorderNotification() {
         std::cout << "[Prototype Pattern] YES clicked - Cloning previous order!\n";
         showReorderNotification = false;
 
-        // Clone the previous order using the Prototype pattern
-        FinalOrder* previousOrder = manager->GetPreviousOrder();
-        if (previousOrder != nullptr) {
-            FinalOrder* clonedOrder = previousOrder->clone();
+        // Rebuild the customer's last paid order, or clone the sample order (Prototype pattern)
+        FinalOrder* clonedOrder = manager->CreateReorder();
+        if (clonedOrder != nullptr) {
             std::cout << "[Prototype Pattern] Order cloned successfully!\n";
             std::cout << "[Prototype Pattern] Cloned order summary:\n";
             clonedOrder->printInvoice();
@@ -488,7 +488,27 @@ void SalesFloorScreen::Draw() {
         : Color{216, 228, 220, 255}; // Light sage green
     ClearBackground(bgColor);
 
-    DrawLeftPanel();
+    // Customer details and the selected plant only change with the customer or the sales floor
+    Customer* customer = manager->GetCustomer();
+    SalesFloor* salesFloor = manager->GetSalesFloor();
+    uint64_t infoKey = reinterpret_cast<uintptr_t>(customer);
+    infoKey = LayerCache::Mix(infoKey, customer != nullptr ? customer->getChangeCount() : 0);
+    infoKey = LayerCache::Mix(infoKey, salesFloor != nullptr ? salesFloor->getChangeCount() : 0);
+    infoKey = LayerCache::Mix(infoKey, reinterpret_cast<uintptr_t>(selectedPlant));
+    infoKey = LayerCache::Mix(infoKey, manager->IsAlternativeColors());
+
+    Rectangle infoArea = {0, 0, static_cast<float>(leftPanelWidth + 1), static_cast<float>(screenHeight)};
+    if (infoLayer.BeginUpdate(infoArea, infoKey, bgColor)) {
+        DrawLeftPanel();
+        infoLayer.EndUpdate();
+    }
+    infoLayer.Draw();
+
+    // Has hover effects, so it is drawn over the cached panel every frame
+    if (showReorderNotification) {
+        DrawReorderNotification();
+    }
+
     DrawMiddlePanel();
     DrawRightPanel();
 
@@ -611,11 +631,6 @@ void SalesFloorScreen::DrawLeftPanel() {
         yPos += 25;
         DrawText("- Use buttons to navigate", 20, yPos, 16, textColor);
     }
-
-    // Draw reorder notification if showing
-    if (showReorderNotification) {
-        DrawReorderNotification();
-    }
 }
 
 void SalesFloorScreen::DrawReorderNotification() {
@@ -760,7 +775,21 @@ void SalesFloorScreen::DrawMiddlePanel() {
              headerSize,
              headerColor);
 
-    DrawGrid();
+    // The grid is redrawn when the sales floor changes or the selection moves
+    SalesFloor* salesFloor = manager->GetSalesFloor();
+    uint64_t gridKey = salesFloor != nullptr ? salesFloor->getChangeCount() : 0;
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedRow));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedCol));
+    gridKey = LayerCache::Mix(gridKey, manager->IsAlternativeColors());
+    gridKey = LayerCache::Mix(gridKey, manager->AreAssetsLoading());
+
+    Rectangle gridArea = {static_cast<float>(gridStartX), static_cast<float>(gridStartY),
+                          static_cast<float>(gridCols * cellSize), static_cast<float>(gridRows * cellSize)};
+    if (gridLayer.BeginUpdate(gridArea, gridKey, middleBg)) {
+        DrawGrid();
+        gridLayer.EndUpdate();
+    }
+    gridLayer.Draw();
 }
 
 void SalesFloorScreen::DrawRightPanel() {
@@ -910,6 +939,8 @@ void SalesFloorScreen::DrawGrid() {
         ? Color{80, 90, 85, 255}     // Grey-green
         : Color{200, 210, 205, 255}; // Light sage
 
+    // Cells, then sprites, then labels. All sprites share the atlas texture,
+    // so the middle pass is a single batch instead of one per cell.
     for (int row = 0; row < gridRows; row++) {
         for (int col = 0; col < gridCols; col++) {
             int x = gridStartX + col * cellSize;
@@ -922,7 +953,20 @@ void SalesFloorScreen::DrawGrid() {
 
             DrawRectangle(x + 2, y + 2, cellSize - 4, cellSize - 4, cellColor);
             DrawRectangleLines(x + 2, y + 2, cellSize - 4, cellSize - 4, cellBorder);
+        }
+    }
 
+    for (int row = 0; row < gridRows; row++) {
+        for (int col = 0; col < gridCols; col++) {
+            Plant* plant = salesFloor->getPlantAt(row, col);
+            if (plant != nullptr) {
+                DrawPlantSprite(plant, row, col);
+            }
+        }
+    }
+
+    for (int row = 0; row < gridRows; row++) {
+        for (int col = 0; col < gridCols; col++) {
             Plant* plant = salesFloor->getPlantAt(row, col);
             if (plant != nullptr) {
                 DrawPlantInCell(plant, row, col);
@@ -931,23 +975,39 @@ void SalesFloorScreen::DrawGrid() {
     }
 }
 
+void SalesFloorScreen::DrawPlantSprite(Plant* plant, int row, int col) {
+    int sprite = manager->GetPlantSprite(plant);
+    if (!manager->IsSpriteReady(sprite)) {
+        return;
+    }
+
+    int x = gridStartX + col * cellSize;
+    int y = gridStartY + row * cellSize;
+
+    Rectangle frame = manager->GetSpriteFrame(sprite);
+    int maxSize = cellSize - 30;
+    float scale = static_cast<float>(maxSize) / frame.height;
+
+    int scaledWidth = static_cast<int>(frame.width * scale);
+    int scaledHeight = static_cast<int>(frame.height * scale);
+
+    int texX = x + (cellSize - scaledWidth) / 2;
+    int texY = y + (cellSize - scaledHeight) / 2 - 10;
+
+    manager->DrawSprite(sprite, Vector2{static_cast<float>(texX), static_cast<float>(texY)}, scale, WHITE);
+}
+
 void SalesFloorScreen::DrawPlantInCell(Plant* plant, int row, int col) {
     int x = gridStartX + col * cellSize;
     int y = gridStartY + row * cellSize;
-    
-    Texture2D plantTexture = manager->GetPlantTexture(plant->getName());
-    
-    if (plantTexture.id != 0) {
+
+    if (manager->IsSpriteReady(manager->GetPlantSprite(plant))) {
+        // Drawn by DrawPlantSprite()
+    } else if (manager->AreAssetsLoading()) {
         int maxSize = cellSize - 30;
-        float scale = static_cast<float>(maxSize) / plantTexture.height;
-        
-        int scaledWidth = static_cast<int>(plantTexture.width * scale);
-        int scaledHeight = static_cast<int>(plantTexture.height * scale);
-        
-        int texX = x + (cellSize - scaledWidth) / 2;
-        int texY = y + (cellSize - scaledHeight) / 2 - 10;
-        
-        DrawTextureEx(plantTexture, Vector2{static_cast<float>(texX), static_cast<float>(texY)}, 0.0f, scale, WHITE);
+        manager->DrawTexturePlaceholder(Rectangle{static_cast<float>(x + (cellSize - maxSize) / 2),
+                                                  static_cast<float>(y + (cellSize - maxSize) / 2 - 10),
+                                                  static_cast<float>(maxSize), static_cast<float>(maxSize)});
     } else {
         Color nameColor = manager->IsAlternativeColors()
             ? Color{200, 200, 200, 255}  // Light grey
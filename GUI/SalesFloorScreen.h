@@ -2,6 +2,7 @@
 #define SALES_FLOOR_SCREEN_H
 
 #include "raylib.h"
+#include "LayerCache.h"
 #include <string>
 #include <vector>
 
@@ -27,6 +28,10 @@ private:
     int selectedRow;
     int selectedCol;
     Plant* selectedPlant;
+
+    // Cached layers, redrawn only when what they show changes
+    LayerCache infoLayer;
+    LayerCache gridLayer;
     
     Rectangle addToCartButton;
     Rectangle viewGreenhouseButton;
@@ -76,6 +81,7 @@ private:
     void DrawMiddlePanel();
     void DrawRightPanel();
     void DrawGrid();
+    void DrawPlantSprite(Plant* plant, int row, int col);
     void DrawPlantInCell(Plant* plant, int row, int col);
     void DrawButtons();
     void DrawRequestOverlay();
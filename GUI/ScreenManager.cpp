@@ -11,11 +11,19 @@
 #include "../include/SalesFloor.h"
 #include "../include/Greenhouse.h"
 #include "../include/CareScheduler.h"
+#include "../include/ThresholdMonitor.h"
+#include "../include/PlantEventStream.h"
+#include "../include/SpeciesKernel.h"
 #include "../include/SalesAssistant.h"
 #include "../include/FloorManager.h"
 #include "../include/NurseryOwner.h"
 #include "../include/Plant.h"
 #include "../include/FinalOrder.h"
+#include "../include/SalesLedger.h"
+#include "../include/OrderHistory.h"
+#include "../include/TransactionJournal.h"
+#include "AssetLoader.h"
+#include "SpriteAtlas.h"
 
 // Factory includes
 #include "../include/RoseFactory.h"
@@ -39,6 +47,8 @@ ScreenManager::ScreenManager()
       salesFloor(nullptr),
       greenhouse(nullptr),
       careScheduler(nullptr),
+      thresholdMonitor(nullptr),
+      lifecycleEvents(nullptr),
       salesAssistant(nullptr),
       floorManager(nullptr),
       nurseryOwner(nullptr),
@@ -47,9 +57,12 @@ ScreenManager::ScreenManager()
       finalOrder(nullptr),
       previousOrder(nullptr),
       hasShownReorderNotification(false),
+      orderHistory(nullptr),
       lastUpdateTime(0.0f),
       daysCounter(0),
-      useAlternativeColors(false) {
+      useAlternativeColors(false),
+      spriteAtlas(nullptr),
+      assetLoader(nullptr) {
 
     std::srand(static_cast<unsigned>(std::time(nullptr)));
 }
@@ -80,6 +93,14 @@ void ScreenManager::Initialize() {
     // Create care scheduler
     careScheduler = new CareScheduler();
     std::cout << "[ScreenManager] Created CareScheduler" << std::endl;
+
+    // Greenhouse care is scheduled by a batch monitor after each day rather than per-plant observers
+    thresholdMonitor = new ThresholdMonitor(careScheduler);
+    thresholdMonitor->addStandardThresholds();
+
+    // Lifecycle events are read once per day instead of re-scanning the grids for changes
+    lifecycleEvents = new PlantEventQueue(1024);
+    PlantEventStream::getInstance()->subscribe(lifecycleEvents);
     
     // Create staff chain of responsibility
     salesAssistant = new SalesAssistant(mediator, "Sales Assistant", "SA-001");
@@ -89,6 +110,18 @@ void ScreenManager::Initialize() {
     floorManager->setNext(nurseryOwner);
     std::cout << "[ScreenManager] Created Staff Chain of Responsibility" << std::endl;
     
+    // Stock, sales, moves and care are journaled from here on when a journal is asked for;
+    // checkouts commit them
+    const char* journalPath = std::getenv(TransactionJournal::PATH_VARIABLE);
+    if (journalPath != nullptr) {
+        if (TransactionJournal::getInstance()->open(journalPath)) {
+            std::cout << "[ScreenManager] Opened transaction journal " << journalPath << std::endl;
+        } else {
+            std::cout << "[ScreenManager] Journal disabled: "
+                      << TransactionJournal::getInstance()->getError() << std::endl;
+        }
+    }
+    
     // Populate greenhouse with initial plants
     PopulateInitialGreenhouse();
     std::cout << "[ScreenManager] Populated initial greenhouse" << std::endl;
@@ -108,6 +141,12 @@ void ScreenManager::Initialize() {
     // Create a sample previous order for Prototype pattern demonstration
     CreateSamplePreviousOrder();
 
+    orderHistory = new OrderHistory();
+    if (orderHistory->open("order_history.bin")) {
+        std::cout << "[ScreenManager] Opened order history with "
+                  << orderHistory->getOrderCount() << " past orders" << std::endl;
+    }
+
     std::cout << "[ScreenManager] Initialization complete!" << std::endl;
 }
 
@@ -138,14 +177,12 @@ void ScreenManager::PopulateInitialGreenhouse() {
         int factoryIndex = std::rand() % factories.size();
         PlantFactory* factory = factories[factoryIndex];
         
-        // Create plant with scheduler
-        Plant* plant = factory->buildPlant(careScheduler);
+        // Care is scheduled by the threshold monitor, so no per-plant observers are needed
+        Plant* plant = factory->buildPlant(nullptr);
         
         // Give plants random starting ages (0-10 days)
         int startingAge = std::rand() % 11;
-        for (int age = 0; age < startingAge; age++) {
-            plant->dailyUpdate();
-        }
+        plant->advanceDays(startingAge);
         
         // Find empty spot in greenhouse
         bool placed = false;
@@ -219,19 +256,12 @@ void ScreenManager::PopulateInitialSalesFloor() {
         // Age the plant to mature state (35+ days for mature, 50+ for flowering)
         int targetAge = 35 + (std::rand() % 20); // 35-54 days
 
-        for (int age = 0; age < targetAge; age++) {
-            // Keep plant healthy while aging
-            plant->setWaterLevel(80);
-            plant->setNutrientLevel(80);
-            plant->setSunlightExposure(70);
-            plant->updateHealth();
-            plant->incrementAge();
-
-            // Manually trigger state changes
-            if (plant->getState() != nullptr) {
-                plant->getState()->handleChange(plant);
-            }
-        }
+        // Keep plant healthy while aging
+        plant->setWaterLevel(80);
+        plant->setNutrientLevel(80);
+        plant->setSunlightExposure(70);
+        plant->updateHealth();
+        plant->advanceDaysMaintained(targetAge);
 
         // Ensure plant is ready for sale
         plant->setReadyForSale(true);
@@ -249,6 +279,7 @@ void ScreenManager::PopulateInitialSalesFloor() {
             int col = std::rand() % 5;
             if (salesFloor->isPositionEmpty(row, col)) {
                 salesFloor->addPlantToDisplay(plant, row, col);
+                TransactionJournal::getInstance()->recordAddition(plant, JournalLocation::SalesFloor, row, col);
                 placed = true;
                 plantsCreated++;
                 std::cout << "[ScreenManager] Placed " << plant->getName()
@@ -278,19 +309,12 @@ void ScreenManager::PopulateInitialSalesFloor() {
         // Age the plant to mature state (35+ days for mature, 50+ for flowering)
         int targetAge = 35 + (std::rand() % 20); // 35-54 days
 
-        for (int age = 0; age < targetAge; age++) {
-            // Keep plant healthy while aging
-            plant->setWaterLevel(80);
-            plant->setNutrientLevel(80);
-            plant->setSunlightExposure(70);
-            plant->updateHealth();
-            plant->incrementAge();
-
-            // Manually trigger state changes
-            if (plant->getState() != nullptr) {
-                plant->getState()->handleChange(plant);
-            }
-        }
+        // Keep plant healthy while aging
+        plant->setWaterLevel(80);
+        plant->setNutrientLevel(80);
+        plant->setSunlightExposure(70);
+        plant->updateHealth();
+        plant->advanceDaysMaintained(targetAge);
 
         // Ensure plant is ready for sale
         plant->setReadyForSale(true);
@@ -308,6 +332,7 @@ void ScreenManager::PopulateInitialSalesFloor() {
             int col = std::rand() % 5;
             if (salesFloor->isPositionEmpty(row, col)) {
                 salesFloor->addPlantToDisplay(plant, row, col);
+                TransactionJournal::getInstance()->recordAddition(plant, JournalLocation::SalesFloor, row, col);
                 placed = true;
                 plantsCreated++;
                 std::cout << "[ScreenManager] Placed " << plant->getName()
@@ -372,44 +397,63 @@ void ScreenManager::CreateSamplePreviousOrder() {
 }
 
 void ScreenManager::LoadAssets() {
-    std::cout << "[ScreenManager] Loading plant textures..." << std::endl;
-    
-    // Load plant textures
-    plantTextures["Rose"] = LoadTexture("assets/rose.png");
-    plantTextures["Daisy"] = LoadTexture("assets/daisy.png");
-    plantTextures["Cactus"] = LoadTexture("assets/cactus.png");
-    plantTextures["Aloe"] = LoadTexture("assets/aloe.png");
-    plantTextures["Potato"] = LoadTexture("assets/potato.png");
-    plantTextures["Strelitzia"] = LoadTexture("assets/strelitzia.png");
-    plantTextures["Radish"] = LoadTexture("assets/radish.png");
-    plantTextures["Monstera"] = LoadTexture("assets/monstera.png");
-    plantTextures["Venus Fly Trap"] = LoadTexture("assets/VenusFlyTrap.png");
-    plantTextures["Carrot"] = LoadTexture("assets/carrot.png");
-    
-    // Load pot textures
+    std::cout << "[ScreenManager] Queueing textures for background loading..." << std::endl;
+
+    // Files are decoded on a worker thread and uploaded a few per frame in Update(),
+    // so the first frame does not wait for them; until then the textures have id 0.
+    // The map entries are created here and not touched again while loading.
+    // Plants, pots and the ribbon are also packed into the sprite atlas the
+    // grid screens draw from; its IDs are handed out here, in a fixed order.
+    spriteAtlas = new SpriteAtlas();
+    assetLoader = new AssetLoader();
+    assetLoader->SetAtlas(spriteAtlas);
+
+    // Plant textures
+    assetLoader->Add("assets/rose.png", &plantTextures["Rose"], spriteAtlas->Add("Rose"));
+    assetLoader->Add("assets/daisy.png", &plantTextures["Daisy"], spriteAtlas->Add("Daisy"));
+    assetLoader->Add("assets/cactus.png", &plantTextures["Cactus"], spriteAtlas->Add("Cactus"));
+    assetLoader->Add("assets/aloe.png", &plantTextures["Aloe"], spriteAtlas->Add("Aloe"));
+    assetLoader->Add("assets/potato.png", &plantTextures["Potato"], spriteAtlas->Add("Potato"));
+    assetLoader->Add("assets/strelitzia.png", &plantTextures["Strelitzia"], spriteAtlas->Add("Strelitzia"));
+    assetLoader->Add("assets/radish.png", &plantTextures["Radish"], spriteAtlas->Add("Radish"));
+    assetLoader->Add("assets/monstera.png", &plantTextures["Monstera"], spriteAtlas->Add("Monstera"));
+    assetLoader->Add("assets/VenusFlyTrap.png", &plantTextures["Venus Fly Trap"], spriteAtlas->Add("Venus Fly Trap"));
+    assetLoader->Add("assets/carrot.png", &plantTextures["Carrot"], spriteAtlas->Add("Carrot"));
+
+    // Pot textures
     std::vector<std::string> potColors = {
         "blue", "red", "terracotta", "green", "yellow",
         "pink", "purple", "orange", "black", "white"
     };
-    
+
     for (const std::string& color : potColors) {
-        std::string path = "assets/pots/pot_" + color + ".png";
-        potTextures[color] = LoadTexture(path.c_str());
+        assetLoader->Add("assets/pots/pot_" + color + ".png", &potTextures[color], spriteAtlas->Add("pot_" + color));
     }
-    
-    // Load ribbon texture
-    ribbonTexture = LoadTexture("assets/ribbon.png");
-    
-    // Load UI icons (optional - will work even if files don't exist)
-    moneyIcon = LoadTexture("assets/money_icon.png");
-    cartIcon = LoadTexture("assets/cart_icon.png");
-    
-    std::cout << "[ScreenManager] Assets loaded successfully" << std::endl;
+
+    // Ribbon texture
+    assetLoader->Add("assets/ribbon.png", &ribbonTexture, spriteAtlas->Add("ribbon"));
+
+    // UI icons (optional - will work even if files don't exist)
+    assetLoader->Add("assets/money_icon.png", &moneyIcon);
+    assetLoader->Add("assets/cart_icon.png", &cartIcon);
+
+    assetLoader->Start();
+    std::cout << "[ScreenManager] Loading " << assetLoader->GetJobCount() << " assets in the background" << std::endl;
 }
 
 void ScreenManager::UnloadAssets() {
     std::cout << "[ScreenManager] Unloading assets..." << std::endl;
 
+    // Stop the loader before its targets go away
+    if (assetLoader != nullptr) {
+        delete assetLoader;
+        assetLoader = nullptr;
+    }
+    if (spriteAtlas != nullptr) {
+        delete spriteAtlas;
+        spriteAtlas = nullptr;
+    }
+
     auto safeUnload = [](Texture2D &tx) {
         if (tx.id != 0) {
             UnloadTexture(tx);
@@ -437,6 +481,12 @@ void ScreenManager::UnloadAssets() {
 }
 
 void ScreenManager::Update() {
+    // Upload a few decoded textures per frame while assets are still loading
+    const int ASSET_UPLOADS_PER_FRAME = 4;
+    if (assetLoader != nullptr && !assetLoader->IsDone()) {
+        assetLoader->UploadReady(ASSET_UPLOADS_PER_FRAME);
+    }
+
     // Real-time plant growth system
     float currentTime = GetTime();
     float deltaTime = currentTime - lastUpdateTime;
@@ -456,21 +506,42 @@ void ScreenManager::Update() {
 void ScreenManager::PerformDailyUpdate() {
     std::cout << "\n[ScreenManager] ===== DAILY UPDATE =====" << std::endl;
     
-    // Update all plants in greenhouse
-    std::vector<Plant*> allPlants = greenhouse->getAllPlants();
+    // Update all plants in greenhouse; they have no observers, so there is nothing to batch
+    PlantGridView allPlants = greenhouse->getGrid().getAll();
+    std::vector<Plant*> plants;
     for (Plant* plant : allPlants) {
-        if (plant != nullptr) {
-            plant->dailyUpdate();
-        }
+        plants.push_back(plant);
     }
+    dailyUpdateBatch(plants.data(), plants.size());
+    greenhouse->markChanged();
+
+    // Schedule care for plants that dropped below a threshold today
+    int scheduled = thresholdMonitor->scan(allPlants);
+    std::cout << "[ScreenManager] Scheduled " << scheduled << " care tasks" << std::endl;
     
     // Increment days counter
     daysCounter++;
+    SalesLedger::getInstance()->setDay(daysCounter);
     std::cout << "[ScreenManager] Day " << daysCounter << " complete" << std::endl;
     
     // Auto-transfer mature plants to sales floor
     std::cout << "[ScreenManager] Checking for plant relocations..." << std::endl;
     mediator->checkPlantRelocation();
+
+    // Summarise what happened to plants since the last day
+    std::vector<PlantEvent> events;
+    lifecycleEvents->drain(events);
+    int stateChanges = 0;
+    int relocations = 0;
+    for (const PlantEvent& event : events) {
+        if (event.type == PlantEventType::StateChanged) {
+            stateChanges++;
+        } else if (event.type == PlantEventType::MovedToSalesFloor) {
+            relocations++;
+        }
+    }
+    std::cout << "[ScreenManager] " << stateChanges << " state changes, " << relocations
+              << " plants moved to the sales floor" << std::endl;
     
     std::cout << "[ScreenManager] ========================\n" << std::endl;
 }
@@ -514,6 +585,13 @@ void ScreenManager::Cleanup() {
         previousOrder = nullptr;
     }
 
+    if (orderHistory != nullptr) {
+        delete orderHistory;
+        orderHistory = nullptr;
+    }
+
+    TransactionJournal::getInstance()->close();
+
     // Delete staff members
     if (salesAssistant != nullptr) {
         delete salesAssistant;
@@ -528,24 +606,37 @@ void ScreenManager::Cleanup() {
         nurseryOwner = nullptr;
     }
     
-    // Delete care scheduler
+    // Stop receiving lifecycle events
+    if (lifecycleEvents != nullptr) {
+        PlantEventStream::getInstance()->unsubscribe(lifecycleEvents);
+        delete lifecycleEvents;
+        lifecycleEvents = nullptr;
+    }
+
+    // Delete sales floor (contains plants) - DON'T delete plants separately
+    if (salesFloor != nullptr) {
+        delete salesFloor;  // Destructor handles plant deletion
+        salesFloor = nullptr;
+    }
+
+    // Delete greenhouse (contains plants) - DON'T delete plants separately
+    if (greenhouse != nullptr) {
+        delete greenhouse;  // Destructor handles plant deletion
+        greenhouse = nullptr;
+    }
+
+    // Delete threshold monitor
+    if (thresholdMonitor != nullptr) {
+        delete thresholdMonitor;
+        thresholdMonitor = nullptr;
+    }
+
+    // Delete care scheduler last: plants with standard observers must not outlive it
     if (careScheduler != nullptr) {
         delete careScheduler;
         careScheduler = nullptr;
     }
     
-// Delete sales floor (contains plants) - DON'T delete plants separately
-if (salesFloor != nullptr) {
-    delete salesFloor;  // Destructor handles plant deletion
-    salesFloor = nullptr;
-}
-
-// Delete greenhouse (contains plants) - DON'T delete plants separately  
-if (greenhouse != nullptr) {
-    delete greenhouse;  // Destructor handles plant deletion
-    greenhouse = nullptr;
-}
-    
     // Delete mediator
     if (mediator != nullptr) {
         delete mediator;
@@ -671,6 +762,49 @@ Texture2D ScreenManager::GetCartIcon() const {
     return cartIcon;
 }
 
+bool ScreenManager::AreAssetsLoading() const {
+    return assetLoader != nullptr && !assetLoader->IsDone();
+}
+
+int ScreenManager::GetPlantSprite(Plant* plant) const {
+    if (plant == nullptr || spriteAtlas == nullptr) {
+        return SpriteAtlas::NONE;
+    }
+    // Look the name up once; the ID stays on the plant for later frames
+    if (plant->getSpriteId() == Plant::NO_SPRITE_ID) {
+        plant->setSpriteId(spriteAtlas->Find(plant->getName()));
+    }
+    return plant->getSpriteId();
+}
+
+bool ScreenManager::IsSpriteReady(int sprite) const {
+    return spriteAtlas != nullptr && spriteAtlas->IsReady() && sprite != SpriteAtlas::NONE;
+}
+
+Rectangle ScreenManager::GetSpriteFrame(int sprite) const {
+    if (spriteAtlas == nullptr) {
+        return Rectangle{0, 0, 0, 0};
+    }
+    return spriteAtlas->GetFrame(sprite);
+}
+
+void ScreenManager::DrawSprite(int sprite, Vector2 position, float scale, Color tint) const {
+    if (spriteAtlas != nullptr) {
+        spriteAtlas->Draw(sprite, position, scale, tint);
+    }
+}
+
+void ScreenManager::DrawTexturePlaceholder(Rectangle area) const {
+    Color fill = useAlternativeColors
+        ? Color{60, 60, 66, 255}     // Dark grey
+        : Color{225, 235, 228, 255}; // Pale sage
+    Color border = useAlternativeColors
+        ? Color{90, 90, 96, 255}
+        : Color{200, 212, 204, 255};
+    DrawRectangleRec(area, fill);
+    DrawRectangleLinesEx(area, 2, border);
+}
+
 // Customer management
 void ScreenManager::CreateNewCustomer(double budget) {
     if (customer != nullptr) {
@@ -717,6 +851,25 @@ FinalOrder* ScreenManager::GetPreviousOrder() const {
     return previousOrder;
 }
 
+OrderHistory* ScreenManager::GetOrderHistory() const {
+    return orderHistory;
+}
+
+FinalOrder* ScreenManager::CreateReorder() const {
+    // The customer's last paid order if there is one, read from the history file
+    if (customer != nullptr && orderHistory != nullptr) {
+        OrderHistory::OrderView latest = orderHistory->getLatestOrder(customer->getId());
+        if (latest.isValid()) {
+            std::cout << "[ScreenManager] Rebuilding order #" << latest.getSequence()
+                      << " from day " << latest.getDay() << " of the order history" << std::endl;
+            return orderHistory->materialize(latest);
+        }
+    }
+
+    // Otherwise the sample order
+    return previousOrder != nullptr ? previousOrder->clone() : nullptr;
+}
+
 bool ScreenManager::HasShownReorderNotification() const {
     return hasShownReorderNotification;
 }
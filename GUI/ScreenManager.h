@@ -12,12 +12,17 @@ class Customer;
 class SalesFloor;
 class Greenhouse;
 class CareScheduler;
+class ThresholdMonitor;
+class PlantEventQueue;
 class SalesAssistant;
 class FloorManager;
 class NurseryOwner;
 class Plant;
 class ConcreteOrder;
 class FinalOrder;
+class OrderHistory;
+class AssetLoader;
+class SpriteAtlas;
 class PlantFactory;
 
 // Screen enumeration
@@ -53,6 +58,8 @@ private:
     SalesFloor* salesFloor;
     Greenhouse* greenhouse;
     CareScheduler* careScheduler;
+    ThresholdMonitor* thresholdMonitor;
+    PlantEventQueue* lifecycleEvents;
     
     // Staff members (chain of responsibility)
     SalesAssistant* salesAssistant;
@@ -68,6 +75,9 @@ private:
     FinalOrder* previousOrder;
     bool hasShownReorderNotification;
 
+    // Paid orders per customer, kept on disk for reordering
+    OrderHistory* orderHistory;
+
     // Time tracking for real-time updates
     float lastUpdateTime;
     int daysCounter;
@@ -81,6 +91,8 @@ private:
     Texture2D ribbonTexture;
     Texture2D moneyIcon;
     Texture2D cartIcon;
+    SpriteAtlas* spriteAtlas;   // Plant, pot and ribbon sprites for the grid screens
+    AssetLoader* assetLoader;   // Decodes the textures above in the background
     
     // Helper methods
     void PopulateInitialGreenhouse();
@@ -132,6 +144,8 @@ public:
 
     // Previous order management (Prototype pattern)
     FinalOrder* GetPreviousOrder() const;
+    OrderHistory* GetOrderHistory() const;
+    FinalOrder* CreateReorder() const;
     bool HasShownReorderNotification() const;
     void SetHasShownReorderNotification(bool shown);
 
@@ -144,6 +158,14 @@ public:
     Texture2D GetRibbonTexture() const;
     Texture2D GetMoneyIcon() const;
     Texture2D GetCartIcon() const;
+    bool AreAssetsLoading() const;
+    void DrawTexturePlaceholder(Rectangle area) const;
+
+    // Sprite atlas getters (one texture, so a whole grid draws in one batch)
+    int GetPlantSprite(Plant* plant) const;
+    bool IsSpriteReady(int sprite) const;
+    Rectangle GetSpriteFrame(int sprite) const;
+    void DrawSprite(int sprite, Vector2 position, float scale, Color tint) const;
     
     // Customer creation (for start screen)
     void CreateNewCustomer(double budget);
@@ -0,0 +1,131 @@
+#include "SpriteAtlas.h"
+#include <iostream>
+
+SpriteAtlas::SpriteAtlas()
+    : frames(1, Rectangle{0, 0, 0, 0}),
+      image{},
+      texture{},
+      cursorX(0),
+      cursorY(0),
+      shelfHeight(0) {
+}
+
+SpriteAtlas::~SpriteAtlas() {
+    Unload();
+}
+
+int SpriteAtlas::Add(const std::string& name) {
+    auto it = ids.find(name);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    int id = static_cast<int>(frames.size());
+    frames.push_back(Rectangle{0, 0, 0, 0});
+    ids[name] = id;
+    return id;
+}
+
+int SpriteAtlas::Find(const std::string& name) const {
+    auto it = ids.find(name);
+    if (it != ids.end()) {
+        return it->second;
+    }
+    return NONE;
+}
+
+bool SpriteAtlas::Pack(int id, const Image& sprite) {
+    if (id <= NONE || id >= static_cast<int>(frames.size()) || sprite.data == nullptr) {
+        return false;
+    }
+
+    // Keep the aspect ratio; only ever scale down
+    int width = sprite.width;
+    int height = sprite.height;
+    int longest = width > height ? width : height;
+    if (longest > MAX_SPRITE_SIZE) {
+        width = width * MAX_SPRITE_SIZE / longest;
+        height = height * MAX_SPRITE_SIZE / longest;
+    }
+
+    // Shelf packing: fill a row left to right, then start a new row below the tallest sprite
+    if (cursorX + width > WIDTH) {
+        cursorX = 0;
+        cursorY += shelfHeight + PADDING;
+        shelfHeight = 0;
+    }
+    if (cursorY + height > HEIGHT) {
+        std::cout << "[SpriteAtlas] No room left for sprite " << id << std::endl;
+        return false;
+    }
+
+    if (image.data == nullptr) {
+        image = GenImageColor(WIDTH, HEIGHT, BLANK);
+    }
+
+    Rectangle source = {0, 0, static_cast<float>(sprite.width), static_cast<float>(sprite.height)};
+    Rectangle dest = {static_cast<float>(cursorX), static_cast<float>(cursorY),
+                      static_cast<float>(width), static_cast<float>(height)};
+    ImageDraw(&image, sprite, source, dest, WHITE);
+    frames[id] = dest;
+
+    cursorX += width + PADDING;
+    if (height > shelfHeight) {
+        shelfHeight = height;
+    }
+    return true;
+}
+
+bool SpriteAtlas::Upload() {
+    if (image.data == nullptr) {
+        return false;
+    }
+    texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+    image = Image{};
+    return texture.id != 0;
+}
+
+bool SpriteAtlas::IsReady() const {
+    return texture.id != 0;
+}
+
+size_t SpriteAtlas::GetSpriteCount() const {
+    return frames.size() - 1;
+}
+
+Rectangle SpriteAtlas::GetFrame(int id) const {
+    if (id <= NONE || id >= static_cast<int>(frames.size())) {
+        return Rectangle{0, 0, 0, 0};
+    }
+    return frames[id];
+}
+
+void SpriteAtlas::Draw(int id, Vector2 position, float scale, Color tint) const {
+    // Frames are written by Pack() on the loader thread until Upload(), so read them only afterwards
+    if (texture.id == 0) {
+        return;
+    }
+    Rectangle frame = GetFrame(id);
+    if (frame.width == 0) {
+        return;
+    }
+    Rectangle dest = {position.x, position.y, frame.width * scale, frame.height * scale};
+    DrawTexturePro(texture, frame, dest, Vector2{0, 0}, 0.0f, tint);
+}
+
+void SpriteAtlas::Unload() {
+    if (texture.id != 0) {
+        UnloadTexture(texture);
+        texture = Texture2D{};
+    }
+    if (image.data != nullptr) {
+        UnloadImage(image);
+        image = Image{};
+    }
+    for (Rectangle& frame : frames) {
+        frame = Rectangle{0, 0, 0, 0};
+    }
+    cursorX = 0;
+    cursorY = 0;
+    shelfHeight = 0;
+}
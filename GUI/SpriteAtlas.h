@@ -0,0 +1,73 @@
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "raylib.h"
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @class SpriteAtlas
+ * @brief Packs many sprites into one texture so they can be drawn in a single batch
+ *
+ * raylib batches consecutive draws that use the same texture; every switch to
+ * another texture flushes the batch. Drawing a grid of plants from separate
+ * textures flushes once per cell, while drawing them from one atlas does not.
+ *
+ * Sprites are registered by name first, which hands out their integer IDs.
+ * Pack() copies decoded images into the atlas image (no GL calls, so it may
+ * run on the loader thread) and Upload() turns the result into a texture on
+ * the main thread. Sprites are scaled down to MAX_SPRITE_SIZE on the way in;
+ * screens that show a plant large keep using the full-size textures.
+ */
+class SpriteAtlas {
+public:
+    static const int NONE = 0;              // ID of "no sprite"; never drawn
+    static const int WIDTH = 2048;
+    static const int HEIGHT = 1024;
+    static const int MAX_SPRITE_SIZE = 256; // Longest side of a packed sprite
+    static const int PADDING = 2;           // Gap between sprites so filtering never bleeds
+
+private:
+    std::map<std::string, int> ids;
+    std::vector<Rectangle> frames;  // Indexed by ID; zero size until packed
+    Image image;                    // Filled by Pack(), freed by Upload()
+    Texture2D texture;
+    int cursorX;
+    int cursorY;
+    int shelfHeight;                // Tallest sprite in the current row
+
+public:
+    SpriteAtlas();
+    ~SpriteAtlas();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    // Registers a sprite and returns its ID; adding a name twice returns the same ID
+    int Add(const std::string& name);
+
+    // Returns the ID of a registered sprite, or NONE
+    int Find(const std::string& name) const;
+
+    // Copies an image into the atlas; returns false if it is empty or does not fit
+    bool Pack(int id, const Image& sprite);
+
+    // Creates the texture from the packed image; main thread only
+    bool Upload();
+
+    bool IsReady() const;
+    size_t GetSpriteCount() const;
+
+    // Part of the atlas texture holding a sprite; zero size if it was never packed
+    Rectangle GetFrame(int id) const;
+
+    // Same as DrawTextureEx() on the sprite's own texture, without rotation
+    void Draw(int id, Vector2 position, float scale, Color tint) const;
+
+    // Frees the image and texture; IDs stay valid and can be packed again
+    void Unload();
+};
+
+#endif // SPRITE_ATLAS_H
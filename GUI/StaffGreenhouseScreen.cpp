@@ -1,5 +1,8 @@
 #include "StaffGreenhouseScreen.h"
 #include "ScreenManager.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
@@ -11,6 +14,7 @@
 #include "../include/CareStrategy.h"
 #include "../include/CareScheduler.h"
 #include "../include/NurseryCoordinator.h"
+#include "../include/TransactionJournal.h"
 
 StaffGreenhouseScreen::StaffGreenhouseScreen(ScreenManager* mgr)
     : manager(mgr),
@@ -34,8 +38,10 @@ StaffGreenhouseScreen::StaffGreenhouseScreen(ScreenManager* mgr)
       closeOverlayHovered(false),
       displayedQueueSize(0) {
 
-    gridRows = 6;
-    gridCols = 8;
+    // Size the grid from the greenhouse; the viewport scrolls if it does not fit
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    gridRows = (greenhouse != nullptr) ? greenhouse->getRows() : 6;
+    gridCols = (greenhouse != nullptr) ? greenhouse->getColumns() : 8;
 
     InitializeLayout();
     InitializeButtons();
@@ -61,12 +67,18 @@ void StaffGreenhouseScreen::InitializeLayout() {
     int cellSizeByHeight = availableHeight / gridRows;
 
     cellSize = (cellSizeByWidth < cellSizeByHeight) ? cellSizeByWidth : cellSizeByHeight;
+    if (cellSize < GreenhouseViewport::MIN_CELL_SIZE) {
+        cellSize = GreenhouseViewport::MIN_CELL_SIZE;
+    }
 
     int gridTotalWidth  = cellSize * gridCols;
     int gridTotalHeight = cellSize * gridRows;
 
-    gridStartX = leftPanelWidth + (middlePanelWidth - gridTotalWidth) / 2;
-    gridStartY = 60 + (screenHeight - 60 - gridTotalHeight) / 2;
+    gridStartX = leftPanelWidth + std::max(10, (middlePanelWidth - gridTotalWidth) / 2);
+    gridStartY = 60 + std::max(10, (screenHeight - 60 - gridTotalHeight) / 2);
+
+    gridViewport.SetLayout(Rectangle{ (float)leftPanelWidth, 60.0f, (float)middlePanelWidth, (float)(screenHeight - 60) },
+                           gridStartX, gridStartY, cellSize, gridRows, gridCols);
 }
 
 void StaffGreenhouseScreen::InitializeButtons() {
@@ -135,17 +147,12 @@ void StaffGreenhouseScreen::Update() {
 }
 
 void StaffGreenhouseScreen::UpdateGrid() {
-    Vector2 mousePos = GetMousePosition();
-
-    if (mousePos.x >= gridStartX && mousePos.x < gridStartX + (cellSize * gridCols) &&
-        mousePos.y >= gridStartY && mousePos.y < gridStartY + (cellSize * gridRows)) {
-
-        int col = (int)((mousePos.x - gridStartX) / cellSize);
-        int row = (int)((mousePos.y - gridStartY) / cellSize);
+    gridViewport.Update();
 
-        if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
-            HandlePlantSelection(row, col);
-        }
+    int row = 0;
+    int col = 0;
+    if (gridViewport.GetCellAt(GetMousePosition(), row, col) && IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) {
+        HandlePlantSelection(row, col);
     }
 }
 
@@ -252,6 +259,7 @@ void StaffGreenhouseScreen::HandleWaterPlant() {
     if (strategy != nullptr) {
         strategy->water(selectedPlant);
         selectedPlant->updateHealth();
+        MarkGreenhouseChanged();
         std::cout << "[StaffGreenhouseScreen] Watered plant " << selectedPlant->getID()
                   << " - Water: " << selectedPlant->getWaterLevel()
                   << "%, Health: " << selectedPlant->getHealthLevel() << "%" << std::endl;
@@ -265,6 +273,7 @@ void StaffGreenhouseScreen::HandleFertilizePlant() {
     if (strategy != nullptr) {
         strategy->fertilize(selectedPlant);
         selectedPlant->updateHealth();
+        MarkGreenhouseChanged();
         std::cout << "[StaffGreenhouseScreen] Fertilized plant " << selectedPlant->getID()
                   << " - Nutrients: " << selectedPlant->getNutrientLevel()
                   << "%, Health: " << selectedPlant->getHealthLevel() << "%" << std::endl;
@@ -278,6 +287,7 @@ void StaffGreenhouseScreen::HandleAdjustSunlight() {
     if (strategy != nullptr) {
         strategy->adjustSunlight(selectedPlant);
         selectedPlant->updateHealth();
+        MarkGreenhouseChanged();
         std::cout << "[StaffGreenhouseScreen] Adjusted sunlight for plant " << selectedPlant->getID()
                   << " - Sunlight: " << selectedPlant->getSunlightExposure()
                   << "%, Health: " << selectedPlant->getHealthLevel() << "%" << std::endl;
@@ -289,6 +299,7 @@ void StaffGreenhouseScreen::HandleFullCare() {
 
     selectedPlant->performCare();
     selectedPlant->updateHealth();
+    MarkGreenhouseChanged();
     std::cout << "[StaffGreenhouseScreen] Performed full care on plant " << selectedPlant->getID()
               << " - Health: " << selectedPlant->getHealthLevel() << "%" << std::endl;
 }
@@ -316,6 +327,7 @@ void StaffGreenhouseScreen::HandleTransferToSalesFloor() {
             if (salesFloor->isPositionEmpty(row, col)) {
                 greenhouse->removePlant(selectedPlant);
                 salesFloor->addPlantToDisplay(selectedPlant, row, col);
+                TransactionJournal::getInstance()->recordRelocation(selectedPlant, row, col);
 
                 std::cout << "[StaffGreenhouseScreen] Transferred " << selectedPlant->getName()
                           << " (ID: " << selectedPlant->getID()
@@ -345,20 +357,26 @@ void StaffGreenhouseScreen::HandleRemoveDeadPlant() {
     Greenhouse* greenhouse = manager->GetGreenhouse();
     if (greenhouse == nullptr) return;
 
-    std::cout << "[StaffGreenhouseScreen] Removing dead plant " << selectedPlant->getName()
-              << " (ID: " << selectedPlant->getID() << ") from greenhouse" << std::endl;
+    std::cout << "[StaffGreenhouseScreen] Removing dead plants, starting with " << selectedPlant->getName()
+              << " (ID: " << selectedPlant->getID() << ")" << std::endl;
 
-    Plant* deadPlant = greenhouse->removePlantAt(selectedRow, selectedCol);
-    if (deadPlant != nullptr) {
-        delete deadPlant;
-        std::cout << "[StaffGreenhouseScreen] Dead plant removed and disposed of" << std::endl;
-    }
+    // Sweep every dead plant in one pass rather than one click per plant
+    int removed = greenhouse->removeDeadPlants();
+    std::cout << "[StaffGreenhouseScreen] " << removed << " dead plant(s) removed and disposed of" << std::endl;
 
     selectedPlant = nullptr;
     selectedRow = -1;
     selectedCol = -1;
 }
 
+// Care changes plants in place, which the greenhouse cannot see for itself
+void StaffGreenhouseScreen::MarkGreenhouseChanged() {
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    if (greenhouse != nullptr) {
+        greenhouse->markChanged();
+    }
+}
+
 void StaffGreenhouseScreen::HandleAdvanceDay() {
     std::cout << "[StaffGreenhouseScreen] Advancing day manually..." << std::endl;
     manager->PerformDailyUpdate();
@@ -385,9 +403,9 @@ int StaffGreenhouseScreen::CountQueuedTasks() {
     if (scheduler == nullptr || greenhouse == nullptr || scheduler->empty()) return 0;
 
     int taskCount = 0;
-    std::vector<Plant*> allPlants = greenhouse->getAllPlants();
-    for (Plant* plant : allPlants) {
-        if (plant != nullptr && !IsPlantDead(plant)) {
+    const char* liveStates[] = { "Seedling", "Growing", "Mature", "Flowering" };
+    for (const char* stateName : liveStates) {
+        for (Plant* plant : greenhouse->getPlantsInState(stateName)) {
             if (plant->getWaterLevel() < 30)      taskCount++;
             if (plant->getNutrientLevel() < 30)   taskCount++;
             if (plant->getSunlightExposure() < 40)taskCount++;
@@ -419,6 +437,7 @@ void StaffGreenhouseScreen::HandleRunOneScheduled() {
         std::cout << "[StaffGreenhouseScreen] Running one scheduled task..." << std::endl;
         scheduler->runNext();
         schedulerTasksExecuted = true;
+        MarkGreenhouseChanged();
 
         displayedQueueSize = CountQueuedTasks();
 
@@ -442,7 +461,20 @@ void StaffGreenhouseScreen::Draw() {
         : Color{216, 228, 220, 255}; // Soft sage green
     ClearBackground(bgColor);
 
-    DrawLeftPanel();
+    // Plant details and the day counter only change with the greenhouse
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    uint64_t infoKey = greenhouse != nullptr ? greenhouse->getChangeCount() : 0;
+    infoKey = LayerCache::Mix(infoKey, reinterpret_cast<uintptr_t>(selectedPlant));
+    infoKey = LayerCache::Mix(infoKey, static_cast<uint64_t>(manager->GetDaysCounter()));
+    infoKey = LayerCache::Mix(infoKey, manager->IsAlternativeColors());
+
+    Rectangle infoArea = {0, 0, static_cast<float>(leftPanelWidth + 1), static_cast<float>(screenHeight)};
+    if (infoLayer.BeginUpdate(infoArea, infoKey, bgColor)) {
+        DrawLeftPanel();
+        infoLayer.EndUpdate();
+    }
+    infoLayer.Draw();
+
     DrawMiddlePanel();
     DrawRightPanel();
 
@@ -616,8 +648,25 @@ void StaffGreenhouseScreen::DrawMiddlePanel() {
              20,
              headerSize,
              headerColor);
+    gridViewport.DrawStatus(borderColor);
 
-    DrawGrid();
+    // The grid is redrawn when the greenhouse changes, or the camera or selection moves
+    Greenhouse* greenhouse = manager->GetGreenhouse();
+    Vector2 target = gridViewport.GetTarget();
+    uint64_t gridKey = greenhouse != nullptr ? greenhouse->getChangeCount() : 0;
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedRow));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedCol));
+    gridKey = LayerCache::Mix(gridKey, manager->IsAlternativeColors());
+    gridKey = LayerCache::Mix(gridKey, manager->AreAssetsLoading());
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(gridViewport.GetZoom() * 1000)));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(target.x * gridViewport.GetZoom())));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(std::lround(target.y * gridViewport.GetZoom())));
+
+    if (gridLayer.BeginUpdate(gridViewport.GetArea(), gridKey, panelBg)) {
+        DrawGrid();
+        gridLayer.EndUpdate();
+    }
+    gridLayer.Draw();
 }
 
 void StaffGreenhouseScreen::DrawRightPanel() {
@@ -646,8 +695,25 @@ void StaffGreenhouseScreen::DrawGrid() {
     Greenhouse* greenhouse = manager->GetGreenhouse();
     if (greenhouse == nullptr) return;
 
-    for (int row = 0; row < gridRows; row++) {
-        for (int col = 0; col < gridCols; col++) {
+    gridViewport.Begin(gridLayer.GetOrigin());
+
+    if (gridViewport.IsOverview()) {
+        // Too small to draw plants: show occupancy and health per tile instead
+        gridViewport.DrawOverview(*greenhouse, manager->IsAlternativeColors());
+        if (selectedRow >= 0 && selectedCol >= 0) {
+            Color selectedOutline = manager->IsAlternativeColors() ? Color{150, 220, 180, 255} : BLACK;
+            DrawRectangleLinesEx(gridViewport.GetCellRect(selectedRow, selectedCol),
+                                 2.0f / gridViewport.GetZoom(), selectedOutline);
+        }
+        gridViewport.End();
+        return;
+    }
+
+    // Only the cells the camera can see. Cells, then sprites, then labels,
+    // so every sprite goes out in one batch.
+    GridRegion visible = gridViewport.GetVisibleCells();
+    for (int row = visible.row; row < visible.row + visible.rowCount; row++) {
+        for (int col = visible.col; col < visible.col + visible.colCount; col++) {
             int x = gridStartX + col * cellSize;
             int y = gridStartY + row * cellSize;
 
@@ -680,20 +746,51 @@ void StaffGreenhouseScreen::DrawGrid() {
                 ? (isDead ? Color{255, 140, 140, 255} : Color{100, 110, 100, 255})
                 : (isDead ? Color{200, 100, 100, 255} : Color{200, 210, 205, 255});
             DrawRectangleLines(x + 1, y + 1, cellSize - 2, cellSize - 2, borderColor);
+        }
+    }
 
-            if (plant != nullptr) {
-                DrawPlantInCell(plant, row, col);
-                if (isDead) {
-                    const char* skullIcon = "X";
-                    int iconWidth = MeasureText(skullIcon, 30);
-                    Color skullColor = manager->IsAlternativeColors()
-                        ? Color{255, 140, 140, 255}  // Light red
-                        : Color{200, 100, 100, 255}; // Red
-                    DrawText(skullIcon, x + (cellSize - iconWidth) / 2, y + cellSize / 2 - 15, 30, skullColor);
-                }
-            }
+    greenhouse->forEachPlant(visible, [this](Plant* plant, int row, int col) {
+        DrawPlantSprite(plant, row, col);
+    });
+
+    greenhouse->forEachPlant(visible, [this](Plant* plant, int row, int col) {
+        DrawPlantInCell(plant, row, col);
+        if (IsPlantDead(plant)) {
+            int x = gridStartX + col * cellSize;
+            int y = gridStartY + row * cellSize;
+            const char* skullIcon = "X";
+            int iconWidth = MeasureText(skullIcon, 30);
+            Color skullColor = manager->IsAlternativeColors()
+                ? Color{255, 140, 140, 255}  // Light red
+                : Color{200, 100, 100, 255}; // Red
+            DrawText(skullIcon, x + (cellSize - iconWidth) / 2, y + cellSize / 2 - 15, 30, skullColor);
         }
+    });
+
+    gridViewport.End();
+}
+
+void StaffGreenhouseScreen::DrawPlantSprite(Plant* plant, int row, int col) {
+    int sprite = manager->GetPlantSprite(plant);
+    if (!manager->IsSpriteReady(sprite)) {
+        return;
     }
+
+    int x = gridStartX + col * cellSize;
+    int y = gridStartY + row * cellSize;
+
+    Rectangle frame = manager->GetSpriteFrame(sprite);
+    int maxSize = cellSize - 20;
+    float scale = (float)maxSize / frame.height;
+
+    int scaledWidth  = (int)(frame.width * scale);
+    int scaledHeight = (int)(frame.height * scale);
+
+    int texX = x + (cellSize - scaledWidth) / 2;
+    int texY = y + (cellSize - scaledHeight) / 2 - 5;
+
+    Color tint = IsPlantDead(plant) ? Color{100, 100, 100, 255} : WHITE;
+    manager->DrawSprite(sprite, Vector2{(float)texX, (float)texY}, scale, tint);
 }
 
 void StaffGreenhouseScreen::DrawPlantInCell(Plant* plant, int row, int col) {
@@ -701,20 +798,14 @@ void StaffGreenhouseScreen::DrawPlantInCell(Plant* plant, int row, int col) {
     int y = gridStartY + row * cellSize;
 
     bool isDead = IsPlantDead(plant);
-    Texture2D plantTexture = manager->GetPlantTexture(plant->getName());
 
-    if (plantTexture.id != 0) {
+    if (manager->IsSpriteReady(manager->GetPlantSprite(plant))) {
+        // Drawn by DrawPlantSprite()
+    } else if (manager->AreAssetsLoading()) {
         int maxSize = cellSize - 20;
-        float scale = (float)maxSize / plantTexture.height;
-
-        int scaledWidth  = (int)(plantTexture.width * scale);
-        int scaledHeight = (int)(plantTexture.height * scale);
-
-        int texX = x + (cellSize - scaledWidth) / 2;
-        int texY = y + (cellSize - scaledHeight) / 2 - 5;
-
-        Color tint = isDead ? Color{100, 100, 100, 255} : WHITE;
-        DrawTextureEx(plantTexture, Vector2{(float)texX, (float)texY}, 0.0f, scale, tint);
+        manager->DrawTexturePlaceholder(Rectangle{(float)(x + (cellSize - maxSize) / 2),
+                                                  (float)(y + (cellSize - maxSize) / 2 - 5),
+                                                  (float)maxSize, (float)maxSize});
     } else {
         const char* name = plant->getName().c_str();
         int nameWidth = MeasureText(name, 10);
@@ -1007,10 +1098,9 @@ void StaffGreenhouseScreen::DrawSchedulerOverlay() {
 
         Greenhouse* greenhouse = manager->GetGreenhouse();
         if (greenhouse != nullptr) {
-            std::vector<Plant*> allPlants = greenhouse->getAllPlants();
             std::vector<std::string> taskList;
 
-            for (Plant* plant : allPlants) {
+            for (Plant* plant : greenhouse->getGrid().getAll()) {
                 if (plant != nullptr && !IsPlantDead(plant)) {
                     if (plant->getWaterLevel() < 30) {
                         std::ostringstream task;
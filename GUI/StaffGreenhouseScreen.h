@@ -2,6 +2,8 @@
 #define STAFF_GREENHOUSE_SCREEN_H
 
 #include "raylib.h"
+#include "GreenhouseViewport.h"
+#include "LayerCache.h"
 #include <string>
 #include <vector>
 
@@ -25,6 +27,11 @@ private:
     int cellSize;
     int gridStartX;
     int gridStartY;
+    GreenhouseViewport gridViewport;
+
+    // Cached layers, redrawn only when what they show changes
+    LayerCache infoLayer;
+    LayerCache gridLayer;
     
     // Selection state
     int selectedRow;
@@ -84,6 +91,7 @@ private:
     void DrawMiddlePanel();
     void DrawRightPanel();
     void DrawGrid();
+    void DrawPlantSprite(Plant* plant, int row, int col);
     void DrawPlantInCell(Plant* plant, int row, int col);
     void DrawButtons();
     void DrawSchedulerInfo();
@@ -101,6 +109,7 @@ private:
     void HandleRunAllScheduled();
     void HandleRunOneScheduled();
     void HandleRemoveDeadPlant();
+    void MarkGreenhouseChanged();
     
     int CountQueuedTasks();
     bool IsPlantDead(Plant* plant) const;
@@ -1,5 +1,6 @@
 #include "StaffSalesFloorScreen.h"
 #include "ScreenManager.h"
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 
@@ -100,7 +101,19 @@ void StaffSalesFloorScreen::Draw() {
     // soft sage bg overall
     ClearBackground(Color{216, 228, 220, 255});
 
-    DrawLeftPanel();
+    // plant details and the day counter only change with the sales floor
+    SalesFloor* sf = manager->GetSalesFloor();
+    uint64_t infoKey = sf ? sf->getChangeCount() : 0;
+    infoKey = LayerCache::Mix(infoKey, reinterpret_cast<uintptr_t>(selectedPlant));
+    infoKey = LayerCache::Mix(infoKey, static_cast<uint64_t>(manager->GetDaysCounter()));
+
+    Rectangle infoArea = {0, 0, (float)(leftPanelWidth + 1), (float)screenHeight};
+    if (infoLayer.BeginUpdate(infoArea, infoKey, Color{216, 228, 220, 255})) {
+        DrawLeftPanel();
+        infoLayer.EndUpdate();
+    }
+    infoLayer.Draw();
+
     DrawMiddlePanel();
     DrawRightPanel();
 }
@@ -182,7 +195,19 @@ void StaffSalesFloorScreen::DrawMiddlePanel() {
     int w = MeasureText(header, size);
     DrawText(header, leftPanelWidth + (middlePanelWidth - w)/2, 16, size, Color{85,107,95,255});
 
-    DrawGrid();
+    // grid only changes with the sales floor, the selection or the sprites arriving
+    SalesFloor* sf = manager->GetSalesFloor();
+    uint64_t gridKey = sf ? sf->getChangeCount() : 0;
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedRow));
+    gridKey = LayerCache::Mix(gridKey, static_cast<uint64_t>(selectedCol));
+    gridKey = LayerCache::Mix(gridKey, manager->AreAssetsLoading());
+
+    Rectangle gridArea = {(float)gridStartX, (float)gridStartY, (float)(gridCols*cellSize), (float)(gridRows*cellSize)};
+    if (gridLayer.BeginUpdate(gridArea, gridKey, Color{206, 237, 223, 255})) {
+        DrawGrid();
+        gridLayer.EndUpdate();
+    }
+    gridLayer.Draw();
 }
 
 void StaffSalesFloorScreen::DrawRightPanel() {
@@ -204,6 +229,7 @@ void StaffSalesFloorScreen::DrawGrid() {
     SalesFloor* sf = manager->GetSalesFloor();
     if (!sf) return;
 
+    // Cells, then sprites (one atlas batch), then labels
     for (int r = 0; r < gridRows; ++r) {
         for (int c = 0; c < gridCols; ++c) {
             int x = gridStartX + c*cellSize;
@@ -219,10 +245,33 @@ void StaffSalesFloorScreen::DrawGrid() {
 
             DrawRectangleLines(x+1, y+1, cellSize-2, cellSize-2,
                                dead ? Color{200,100,100,255} : Color{200,210,205,255});
-
-            if (p) DrawPlantInCell(p, r, c);
         }
     }
+
+    for (int r = 0; r < gridRows; ++r)
+        for (int c = 0; c < gridCols; ++c)
+            if (Plant* p = sf->getPlantAt(r, c)) DrawPlantSprite(p, r, c);
+
+    for (int r = 0; r < gridRows; ++r)
+        for (int c = 0; c < gridCols; ++c)
+            if (Plant* p = sf->getPlantAt(r, c)) DrawPlantInCell(p, r, c);
+}
+
+void StaffSalesFloorScreen::DrawPlantSprite(Plant* plant, int row, int col) {
+    int sprite = manager->GetPlantSprite(plant);
+    if (!manager->IsSpriteReady(sprite)) return;
+
+    int x = gridStartX + col*cellSize;
+    int y = gridStartY + row*cellSize;
+
+    Rectangle frame = manager->GetSpriteFrame(sprite);
+    int maxSize = cellSize - 22;
+    float scale = (float)maxSize / frame.height;
+    int sw = (int)(frame.width * scale);
+    int sh = (int)(frame.height * scale);
+    int tx = x + (cellSize - sw)/2;
+    int ty = y + (cellSize - sh)/2 - 4;
+    manager->DrawSprite(sprite, Vector2{(float)tx, (float)ty}, scale, IsPlantDead(plant) ? Color{110,110,110,255} : WHITE);
 }
 
 void StaffSalesFloorScreen::DrawPlantInCell(Plant* plant, int row, int col) {
@@ -230,16 +279,14 @@ void StaffSalesFloorScreen::DrawPlantInCell(Plant* plant, int row, int col) {
     int y = gridStartY + row*cellSize;
 
     bool dead = IsPlantDead(plant);
-    auto tex = manager->GetPlantTexture(plant->getName());
 
-    if (tex.id != 0) {
+    if (manager->IsSpriteReady(manager->GetPlantSprite(plant))) {
+        // Drawn by DrawPlantSprite()
+    } else if (manager->AreAssetsLoading()) {
         int maxSize = cellSize - 22;
-        float scale = (float)maxSize / tex.height;
-        int sw = (int)(tex.width * scale);
-        int sh = (int)(tex.height * scale);
-        int tx = x + (cellSize - sw)/2;
-        int ty = y + (cellSize - sh)/2 - 4;
-        DrawTextureEx(tex, Vector2{(float)tx, (float)ty}, 0.0f, scale, dead ? Color{110,110,110,255} : WHITE);
+        manager->DrawTexturePlaceholder(Rectangle{(float)(x + (cellSize - maxSize)/2),
+                                                  (float)(y + (cellSize - maxSize)/2 - 4),
+                                                  (float)maxSize, (float)maxSize});
     } else {
         const char* name = plant->getName().c_str();
         int w = MeasureText(name, 10);
@@ -1,5 +1,6 @@
 #pragma once
 #include "raylib.h"
+#include "LayerCache.h"
 #include <string>
 #include <vector>
 
@@ -28,6 +29,10 @@ private:
     int selectedRow{-1}, selectedCol{-1};
     Plant* selectedPlant{nullptr};
 
+    // cached layers, redrawn only when the backend or the selection changes
+    LayerCache infoLayer;
+    LayerCache gridLayer;
+
     // ui
     Rectangle backButton{};
     bool backHovered{false};
@@ -45,6 +50,7 @@ private:
     void DrawMiddlePanel();
     void DrawRightPanel();
     void DrawGrid();
+    void DrawPlantSprite(Plant* plant, int row, int col);
     void DrawPlantInCell(Plant* plant, int row, int col);
     void DrawDayCounter();
 
@@ -46,6 +46,19 @@ public:
      */
     virtual void execute();
 
+    /**
+     * @brief Gets the plant this command acts on.
+     * @return The target plant (may be nullptr).
+     */
+    virtual Plant* getTarget() const;
+
+    /**
+     * @brief Reports CareAction::AdjustSunlight so the scheduler can batch this command.
+     * @param action Set to CareAction::AdjustSunlight.
+     * @return Always true.
+     */
+    virtual bool getCareAction(CareAction& action) const;
+
 private:
     Plant* target_;
 };
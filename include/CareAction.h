@@ -0,0 +1,39 @@
+/**
+ * @file CareAction.h
+ * @brief Declares the CareAction enumeration and a helper for building care commands.
+ *
+ * A CareAction names one of the care operations a CareStrategy can perform,
+ * so that components such as threshold monitors can describe which command
+ * to schedule without constructing it up front.
+ */
+#ifndef CARE_ACTION_H
+#define CARE_ACTION_H
+
+class Command;
+class Plant;
+
+/**
+ * @enum CareAction
+ * @brief Care operations that can be scheduled for a plant.
+ */
+enum class CareAction {
+    Water,          ///< Schedules a WaterPlantCommand
+    Fertilize,      ///< Schedules a FertilizePlantCommand
+    AdjustSunlight  ///< Schedules an AdjustSunlightCommand
+};
+
+/**
+ * @brief Number of CareAction values, for tables indexed by action.
+ */
+constexpr int CARE_ACTION_COUNT = 3;
+
+/**
+ * @brief Creates the command that performs a care action on a plant.
+ *
+ * @param action The care action to perform.
+ * @param target Pointer to the plant the command acts on. Not owned.
+ * @return Newly allocated command. Ownership passes to the caller.
+ */
+Command* createCareCommand(CareAction action, Plant* target);
+
+#endif // CARE_ACTION_H
@@ -10,9 +10,17 @@
 #ifndef CARE_SCHEDULER_H
 #define CARE_SCHEDULER_H
 
+#include <cstddef>
+#include <unordered_map>
 #include <vector>
 
+#include "CareAction.h"
+#include "TimingWheel.h"
+
+class CareStrategy;
 class Command;
+class Plant;
+class PlantObserver;
 
 /**
  * @class CareScheduler
@@ -25,9 +33,33 @@ class Command;
  * 
  * The scheduler provides flexibility in command execution, allowing commands to be
  * executed individually or in batch, supporting various scheduling strategies.
+ * 
+ * Besides the run-now queue, commands can be scheduled for a later simulated
+ * day or on a fixed interval. These live in a TimingWheel and run as the
+ * scheduler's day is advanced with advanceDay() or advanceDays().
  */
 class CareScheduler {
 public:
+    /**
+     * @brief Identifies a delayed or recurring task. 0 is never a valid id.
+     */
+    using TaskId = TimingWheel::TaskId;
+
+    /**
+     * @brief What a runAllParallel() call did.
+     */
+    struct ParallelRunSummary {
+        size_t commandCount;    ///< Commands executed (or dropped for lacking a target)
+        size_t barrierCount;    ///< Commands that ran alone on the calling thread
+        unsigned workerCount;   ///< Threads used, including the calling thread
+        size_t largestShard;    ///< Most commands given to one worker between two barriers
+    };
+
+    /**
+     * @brief Parallel runs with fewer care commands than this between barriers stay on the calling thread.
+     */
+    static constexpr size_t MIN_PARALLEL_COMMANDS = 256;
+
     /**
      * @brief Default constructor.
      * Initializes an empty command queue.
@@ -65,6 +97,115 @@ public:
      * each one until the queue is empty.
      */
     void runAll();
+
+    /**
+     * @brief Executes and removes all commands, grouping plain care commands by action and strategy.
+     * 
+     * Commands that report a care action are partitioned by (action, concrete
+     * strategy) and each group is handed to CareStrategy::careForBatch(), so
+     * the strategy's method runs over many plants in a row instead of
+     * alternating between species. The i-th command on a plant always runs
+     * after its (i-1)-th, so each plant sees its commands in arrival order.
+     * Any other command is a barrier: everything queued before it finishes
+     * first, then it runs on its own.
+     */
+    void runAllBatched();
+
+    /**
+     * @brief Executes and removes all commands, spreading plain care commands over worker threads.
+     * 
+     * Commands that report a care action are sharded by target plant, so all
+     * commands for one plant run in arrival order on the same worker and no
+     * plant is touched by two threads. Caring for a plant that is tracked by
+     * a SimulationCalendar, has a state listener (such as its Greenhouse) or
+     * has observers writes state other plants share, so those plants all go
+     * to the calling thread's shard; only plants with none of these run on
+     * the other workers. Any other command is a barrier: the workers finish
+     * everything queued before it, then it runs alone on the calling thread.
+     * The built-in care strategies are stateless and safe to share between
+     * workers; a custom strategy must be too.
+     * 
+     * @param workerCount Threads to use, including the calling thread.
+     *                    0 uses one per hardware thread.
+     * @return Summary of the run.
+     */
+    ParallelRunSummary runAllParallel(unsigned workerCount = 0);
+
+    /**
+     * @brief Schedules a command to run once on a given simulated day.
+     * 
+     * @param cmd Command to run. Ownership is transferred; it is deleted after it runs.
+     * @param day Day to run on. A day that is not after getCurrentDay() runs on the next advance.
+     * @return Id for cancelTask(), or 0 if cmd is nullptr.
+     */
+    TaskId scheduleAt(Command* cmd, long long day);
+
+    /**
+     * @brief Schedules a command to run once, a number of days from now.
+     * 
+     * @param cmd Command to run. Ownership is transferred; it is deleted after it runs.
+     * @param delayDays Days from now; values below 1 mean the next day.
+     * @return Id for cancelTask(), or 0 if cmd is nullptr.
+     */
+    TaskId scheduleAfter(Command* cmd, int delayDays);
+
+    /**
+     * @brief Schedules a command to run repeatedly, e.g. watering every 2 days.
+     * 
+     * @param cmd Command to run. Ownership is transferred; it is deleted when cancelled
+     *            or when the scheduler is destroyed.
+     * @param intervalDays Days between runs; values below 1 mean every day.
+     * @param firstDelayDays Days until the first run; values below 1 mean one interval from now.
+     * @return Id for cancelTask(), or 0 if cmd is nullptr.
+     */
+    TaskId scheduleEvery(Command* cmd, int intervalDays, int firstDelayDays = 0);
+
+    /**
+     * @brief Cancels a delayed or recurring task and deletes its command.
+     * 
+     * @param id Id returned when the task was scheduled.
+     * @return true if the task was still scheduled.
+     */
+    bool cancelTask(TaskId id);
+
+    /**
+     * @brief Checks whether a delayed or recurring task will still run.
+     * 
+     * @param id Id returned when the task was scheduled.
+     * @return true if the task is scheduled.
+     */
+    bool isTaskScheduled(TaskId id) const;
+
+    /**
+     * @brief Advances the scheduler one simulated day and runs the tasks due on it.
+     * 
+     * @return Number of commands executed.
+     */
+    int advanceDay();
+
+    /**
+     * @brief Advances the scheduler several simulated days, running each day's tasks.
+     * 
+     * Days with nothing due are skipped without work.
+     * 
+     * @param days Days to advance. Non-positive values do nothing.
+     * @return Number of commands executed.
+     */
+    int advanceDays(int days);
+
+    /**
+     * @brief Gets the scheduler's current simulated day.
+     * 
+     * @return Days advanced since construction.
+     */
+    long long getCurrentDay() const;
+
+    /**
+     * @brief Gets the number of delayed and recurring tasks still scheduled.
+     * 
+     * @return Scheduled task count. Queued run-now commands are not included.
+     */
+    int getScheduledCount() const;
     
     /**
      * @brief Checks if the command queue is empty.
@@ -73,8 +214,77 @@ public:
      */
     bool empty() const;
 
+    /**
+     * @brief Gets the commands waiting in the queue, in the order they will run.
+     *
+     * Does not include commands on the timing wheel.
+     *
+     * @return The queued commands; still owned by the scheduler.
+     */
+    const std::vector<Command*>& getQueuedTasks() const;
+
+    /**
+     * @brief Attaches the scheduler's standard water, fertilize and sunlight observers to a plant.
+     * 
+     * The three observers are created once per scheduler and shared by every plant
+     * that uses it, so attaching them costs the plant no heap allocations. The
+     * scheduler owns them and must outlive the plants it watches.
+     * 
+     * @param plant Pointer to the Plant to monitor. Ignored if nullptr.
+     */
+    void attachStandardObservers(Plant* plant);
+
 private:
+    /**
+     * @brief A care command waiting in the current batch.
+     */
+    struct BatchedTask {
+        int wave;               ///< How many earlier commands in the batch target the same plant
+        CareAction action;
+        int strategyRank;       ///< Order in which the strategy first appeared in the batch
+        Plant* target;
+        CareStrategy* strategy;
+        Command* command;
+    };
+
+    /**
+     * @brief Runs and deletes the commands collected in batch_.
+     */
+    void flushBatch();
+
+    /**
+     * @brief Index of a task's (wave, action, strategy) group in the counting sort.
+     */
+    static size_t groupOf(const BatchedTask& task, int strategyCount);
+
+    /**
+     * @brief Runs and deletes the commands in shards_, one worker per shard.
+     */
+    void drainShards(ParallelRunSummary& summary);
+
+    /**
+     * @brief Worker index for a plant's commands.
+     */
+    static size_t shardOf(const Plant* plant, size_t shardCount);
+
+    /**
+     * @brief Checks whether caring for a plant writes state shared with other plants.
+     * @return true if the plant has a calendar, a state listener or observers.
+     */
+    static bool reachesSharedState(const Plant* plant);
+
     std::vector<Command*> queue_;
+    TimingWheel wheel_;                             ///< Delayed and recurring commands
+    std::vector<BatchedTask> batch_;                ///< Scratch for runAllBatched()
+    std::unordered_map<Plant*, int> batchWaves_;    ///< Commands per plant in the current batch
+    std::vector<CareStrategy*> batchStrategies_;    ///< Strategies in first-seen order
+    std::vector<Plant*> batchPlants_;               ///< Plants handed to careForBatch()
+    std::vector<BatchedTask> sortedBatch_;          ///< Counting-sort output
+    std::vector<size_t> groupStarts_;               ///< Counting-sort group offsets
+    std::vector<std::vector<Command*>> shards_;     ///< Per-worker commands for runAllParallel()
+    PlantObserver* waterObserver_;      ///< Shared water observer, created on first use
+    PlantObserver* fertilizeObserver_;  ///< Shared fertilize observer, created on first use
+    PlantObserver* sunlightObserver_;   ///< Shared sunlight observer, created on first use
 };
 
 #endif // CARE_SCHEDULER_H
@@ -1,6 +1,9 @@
 #ifndef CARESTRATEGY_H
 #define CARESTRATEGY_H
 
+#include "CareAction.h"
+#include <cstddef>
+
 class Plant;
 
 /**
@@ -35,6 +38,27 @@ class CareStrategy {
             prune(plant);
         }
 
+        /**
+         * @brief Applies one care action to a batch of plants that all use this strategy
+         *
+         * The default makes one virtual call per plant. Concrete strategies
+         * override it with their species' SpeciesKernel, which applies the
+         * care amounts inline and logs once for the whole batch.
+         *
+         * @param action Care action to apply
+         * @param plants Plants to care for
+         * @param count Number of plants
+         */
+        virtual void careForBatch(CareAction action, Plant* const* plants, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                switch (action) {
+                    case CareAction::Water:          water(plants[i]); break;
+                    case CareAction::Fertilize:      fertilize(plants[i]); break;
+                    case CareAction::AdjustSunlight: adjustSunlight(plants[i]); break;
+                }
+            }
+        }
+
 };
 
 #endif
\ No newline at end of file
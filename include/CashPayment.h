@@ -17,6 +17,13 @@
  * specific to cash transactions.
  */
 class CashPayment : public PaymentProcessor {
+public:
+    /**
+     * @brief Gets how this processor takes payment.
+     * @return PaymentMethod::Cash
+     */
+    PaymentMethod getPaymentMethod() const override;
+
 protected:
     /**
      * @brief Verifies if the customer has sufficient cash for payment.
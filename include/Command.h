@@ -9,6 +9,10 @@
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include "CareAction.h"
+
+class Plant;
+
 /**
  * @class Command
  * @brief Abstract base class defining the interface for commands.
@@ -33,6 +37,33 @@ public:
      * the specific action associated with the command.
      */
     virtual void execute() = 0;
+
+    /**
+     * @brief Gets the single plant this command acts on.
+     *
+     * Used by CareScheduler::runAllBatched() and runAllParallel() to keep
+     * commands on the same plant in order. Commands that touch several
+     * plants, or none, return nullptr.
+     *
+     * @return The target plant, or nullptr.
+     */
+    virtual Plant* getTarget() const { return nullptr; }
+
+    /**
+     * @brief Reports the care action this command performs, if it is a plain care command.
+     *
+     * A command that returns true must behave exactly like calling that
+     * action on its target's care strategy, so the scheduler may run it as
+     * part of a batch instead of calling execute(), or on a worker thread
+     * alongside commands for other plants.
+     *
+     * @param action Set to the command's care action when true is returned.
+     * @return true if the command can be batched.
+     */
+    virtual bool getCareAction(CareAction& action) const {
+        (void)action;
+        return false;
+    }
 };
 
 #endif // COMMAND_H
@@ -17,6 +17,13 @@
  * specific to credit card transactions.
  */
 class CreditCardPayment : public PaymentProcessor {
+public:
+    /**
+     * @brief Gets how this processor takes payment.
+     * @return PaymentMethod::CreditCard
+     */
+    PaymentMethod getPaymentMethod() const override;
+
 protected:
 
     /**
@@ -10,6 +10,7 @@
 #ifndef CUSTOMER_H
 #define CUSTOMER_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "Person.h"
@@ -35,6 +36,7 @@ protected:
     double budget;
     Request* currentRequest;
     ConcreteOrder* currentOrder;
+    uint64_t changeCount;
     
 public:
     /**
@@ -210,6 +212,12 @@ public:
      */
     bool deductFromBudget(double amount);
 
+    /**
+     * @brief Gets how many times the cart or budget has changed.
+     * @return Change count; equal values mean nothing in the cart or budget changed in between.
+     */
+    uint64_t getChangeCount() const;
+
     // ============ REMOVAL OPERATIONS ============
     /**
      * @brief Removes ribbon decoration from a cart item.
@@ -253,6 +261,7 @@ private:
 
     friend class NurseryMediator;
     friend class NurseryCoordinator;
+    friend class NurserySnapshot;
 };
 
 #endif
\ No newline at end of file
@@ -76,6 +76,18 @@ class Decorator : public Plant {
          */
         void dailyUpdate() override;
 
+        /**
+         * @brief Advances the wrapped plant by several days
+         * @param days Number of days to advance
+         */
+        void advanceDays(int days) override;
+
+        /**
+         * @brief Advances the wrapped plant by several days with its vitals held steady
+         * @param days Number of days to advance
+         */
+        void advanceDaysMaintained(int days) override;
+
         /**
          * @brief Returns string representation of the decorated plant
          * 
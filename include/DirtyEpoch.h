@@ -0,0 +1,45 @@
+/**
+ * @file DirtyEpoch.h
+ * @brief Declares DirtyEpoch, the change counter incremental checkpoints compare against.
+ *
+ * Plants, grid cells and finished orders stamp themselves with the current
+ * epoch whenever they change. A checkpoint writes everything stamped at or
+ * after the epoch it last closed, then advances the counter, so the next
+ * checkpoint only sees what changed after it.
+ */
+#ifndef DIRTY_EPOCH_H
+#define DIRTY_EPOCH_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class DirtyEpoch
+ * @brief Process-wide epoch counter.
+ *
+ * Reading the epoch is safe from the scheduler's worker threads; it is only
+ * advanced between ticks, by whoever takes checkpoints.
+ */
+class DirtyEpoch {
+public:
+    /**
+     * @brief Gets the epoch changes are currently stamped with.
+     * @return Current epoch; never 0, so 0 means "before any epoch".
+     */
+    static uint32_t current() {
+        return epoch_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Closes the current epoch.
+     * @return The new current epoch; objects stamped before it are clean from now on.
+     */
+    static uint32_t advance() {
+        return epoch_.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+private:
+    static inline std::atomic<uint32_t> epoch_{1};
+};
+
+#endif // DIRTY_EPOCH_H
@@ -51,6 +51,14 @@ public:
      * @param plant Pointer to the Plant object that triggered the notification.
      */
     virtual void update(Plant* plant) override;
+
+    /**
+     * @brief Checks a batch of plants' nutrient levels in one pass.
+     * 
+     * @param plants Plants that changed during a NotificationBatch.
+     * @param count Number of plants.
+     */
+    virtual void updateBatch(Plant* const* plants, size_t count) override;
 };
 
 #endif // FERTILIZE_OBSERVER_H
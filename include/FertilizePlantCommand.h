@@ -45,6 +45,19 @@ public:
      */
     virtual void execute();
 
+    /**
+     * @brief Gets the plant this command acts on.
+     * @return The target plant (may be nullptr).
+     */
+    virtual Plant* getTarget() const;
+
+    /**
+     * @brief Reports CareAction::Fertilize so the scheduler can batch this command.
+     * @param action Set to CareAction::Fertilize.
+     * @return Always true.
+     */
+    virtual bool getCareAction(CareAction& action) const;
+
 private:
     Plant* target_; 
 };
@@ -14,6 +14,7 @@
 
 #include "AbstractFinalOrder.h"
 #include "Order.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -31,6 +32,7 @@ private:
     std::vector<Order*> orderList;  ///< Collection of all orders in this final order.
     std::string customerName;       ///< Customer's name.
     double totalPrice;              ///< Cached total price.
+    uint32_t dirtyEpoch;            ///< DirtyEpoch of the last change, for incremental checkpoints.
 
 public:
     /**
@@ -86,6 +88,24 @@ public:
      */
     std::string getSummary() const override;
 
+    /**
+     * @brief Gets the top-level orders and items in the order they were added.
+     * @return The orders; still owned by this FinalOrder.
+     */
+    const std::vector<Order*>& getOrders() const;
+
+    /**
+     * @brief Gets the name of the customer the order was placed for.
+     * @return Customer name.
+     */
+    std::string getCustomerName() const;
+
+    /**
+     * @brief Gets the DirtyEpoch the order was created or last added to in.
+     * @return Epoch of the last change.
+     */
+    uint32_t getDirtyEpoch() const;
+
     /**
      * @brief Prints a structured invoice for this order to the console.
      *
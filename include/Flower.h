@@ -36,17 +36,24 @@ public:
      */
     virtual ~Flower();
 
-    /**
-     * @brief Performs daily update operations specific to flowers.
-     * Overrides the base Plant class implementation.
-     */
-    void dailyUpdate() override;
-
     /**
      * @brief Converts flower information to a string representation.
      * @return String containing flower-specific details.
      */
     std::string toString() const override;
+
+protected:
+    /**
+     * @brief Gets the water flowers lose each day.
+     * @return Water lost per dailyUpdate().
+     */
+    int getDailyWaterLoss() const override;
+
+    /**
+     * @brief Gets the nutrients flowers consume each day.
+     * @return Nutrients lost per dailyUpdate().
+     */
+    int getDailyNutrientLoss() const override;
 };
 
 #endif
\ No newline at end of file
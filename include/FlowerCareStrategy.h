@@ -12,6 +12,16 @@
 class FlowerCareStrategy : public CareStrategy {
 public:
 
+    /**
+     * @brief Returns the shared instance used by all flowering plants
+     *
+     * The strategy holds no per-plant state, so every plant of this kind
+     * references the same object instead of owning its own copy.
+     *
+     * @return Pointer to the shared strategy (never deleted by plants)
+     */
+    static FlowerCareStrategy* getInstance();
+
     /**
      * @brief Waters flowering plants with optimal moisture levels
      * 
@@ -51,6 +61,14 @@ public:
      * @param plant Pointer to the flower plant to be pruned
      */
     void prune(Plant* plant) override;
+
+    /**
+     * @brief Applies one care action to a batch of plants through SpeciesKernel<FlowerTraits>
+     * @param action Care action to apply
+     * @param plants Plants to care for
+     * @param count Number of plants
+     */
+    void careForBatch(CareAction action, Plant* const* plants, size_t count) override;
 };
 
 #endif
\ No newline at end of file
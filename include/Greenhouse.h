@@ -2,11 +2,27 @@
 #define GREENHOUSE_H
 
 #include "Colleague.h"
+#include "PlantStateListener.h"
+#include "PlantGrid.h"
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 class Plant;
 
+/**
+ * @struct PlantPlacement
+ * @brief A plant and the cell it should go in, for Greenhouse::addPlants()
+ */
+struct PlantPlacement {
+    Plant* plant;
+    int row;
+    int col;
+    bool placed;    ///< Set by addPlants(); a plant that was not placed stays with the caller
+};
+
 /**
  * @file Greenhouse.h
  * @brief Plant storage and growth Colleague in Mediator pattern
@@ -19,10 +35,16 @@ class Plant;
  * - Notifies when plants are ready for sale
  *
  * Implementation approach:
- * - Grid-based storage system for plants
+ * - Grid-based storage system for plants, held in one contiguous
+ *   PlantGrid buffer so rows, columns and regions can be walked in place
+ * - Optional sparse storage, so huge seasonal greenhouses only pay for
+ *   the cells that are actually occupied
+ * - Named zones (bays, benches) that region-wide care commands can target
  * - Plant lookup by name or position
  * - Capacity management
  * - Growth stage tracking
+ * - Per-state indexes kept current through the PlantStateListener hook,
+ *   so state counts and ready-plant lookups never scan the grid
  *
  * @author Kahlan Hagerman
  * @date 2025-10-26
@@ -32,13 +54,86 @@ class Plant;
  * @class Greenhouse
  * @brief Manages the plant inventory and plant growing areas
  */
-class Greenhouse: public Colleague{
+class Greenhouse: public Colleague, public PlantStateListener{
     private:
-        std::vector<std::vector<Plant*>> plantGrid;
+        PlantGrid plantGrid;
         int currentNumberOfPlants;
         int capacity;
         int rows;
         int cols;
+        uint64_t changeCount;
+
+        /**
+         * @brief Where a plant sits in the grid and in the state indexes
+         */
+        struct PlantSlot {
+            int row;
+            int col;
+            int stateBucket;
+            size_t stateIndex;
+            bool ready;
+        };
+
+        /**
+         * @brief Seedling, Growing, Mature, Flowering, Dead, and one bucket for anything else
+         */
+        static constexpr int STATE_BUCKET_COUNT = 6;
+
+        std::vector<Plant*> stateBuckets[STATE_BUCKET_COUNT];
+        std::map<long long, Plant*> readyPlants;   ///< Keyed by row-major cell, so they list in grid order
+        std::unordered_map<Plant*, PlantSlot> plantSlots;
+        std::unordered_map<std::string, int> speciesCounts;
+        std::unordered_map<std::string, GridRegion> zones;
+
+        /**
+         * @brief Maps a state name to its bucket
+         * @param stateName Name returned by PlantState::getStateName()
+         * @return Bucket index
+         */
+        static int stateBucketFor(const std::string& stateName);
+
+        /**
+         * @brief Gets the bucket for a plant's current state
+         * @param plant The plant
+         * @return Bucket index
+         */
+        static int stateBucketFor(const Plant* plant);
+
+        /**
+         * @brief Adds a plant to the position, state and species indexes
+         * @param plant The plant being placed
+         * @param row Row position
+         * @param col Column position
+         */
+        void indexPlant(Plant* plant, int row, int col);
+
+        /**
+         * @brief Removes a plant from every index and clears its listener
+         * @param plant The plant being removed
+         */
+        void unindexPlant(Plant* plant);
+
+        /**
+         * @brief Swap-removes a plant from its state bucket
+         */
+        void eraseFromStateBucket(PlantSlot& slot);
+
+        /**
+         * @brief Removes a plant from the ready index
+         */
+        void eraseFromReady(PlantSlot& slot);
+
+        /**
+         * @brief Gets the row-major key of a plant's cell
+         */
+        long long cellKey(const PlantSlot& slot) const;
+
+        /**
+         * @brief Sorts indexed plants into row-major grid order
+         * @param plants Plants held by this greenhouse
+         * @return The same plants ordered as getAllPlants() would list them
+         */
+        std::vector<Plant*> inGridOrder(std::vector<Plant*> plants) const;
 
     public:
         /**
@@ -46,8 +141,9 @@ class Greenhouse: public Colleague{
          * @param m Pointer to mediator
          * @param numRows Number of rows in greenhouse
          * @param numCols Number of columns in greenhouse
+         * @param storage GridStorage::Sparse for very large, lightly populated greenhouses
          */
-        Greenhouse(NurseryMediator* m, int numRows, int numCols);
+        Greenhouse(NurseryMediator* m, int numRows, int numCols, GridStorage storage = GridStorage::Dense);
 
         /**
          * @brief Destructor
@@ -63,6 +159,18 @@ class Greenhouse: public Colleague{
          */
         bool addPlant(Plant* plant, int row, int col);
 
+        /**
+         * @brief Add many plants at once
+         *
+         * Each placement is checked like addPlant(), but nothing is logged per
+         * plant and the mediator is notified once for the whole batch.
+         *
+         * @param placements Plants and cells; each placement's placed flag is set
+         * @param count Number of placements
+         * @return Number of plants placed
+         */
+        size_t addPlants(PlantPlacement* placements, size_t count);
+
         /**
          * @brief Remove a specific plant from the grid
          * @param plant The plant to remove
@@ -125,6 +233,12 @@ class Greenhouse: public Colleague{
          */
         bool isFull()const;
 
+        /**
+         * @brief Sizes the plant indexes for a number of plants about to be added
+         * @param plantCount Number of plants expected in the greenhouse
+         */
+        void reservePlants(size_t plantCount);
+
         /**
          * @brief Get all plants in a specific row
          * @param row Row number
@@ -158,7 +272,114 @@ class Greenhouse: public Colleague{
          * @return true if empty or out of bounds
          */
         bool isPositionEmpty(int row, int col) const;
-        
+
+        /**
+         * @brief Get read-only access to the grid for zero-copy row, column and region views
+         * @return The greenhouse grid
+         */
+        const PlantGrid& getGrid() const;
+
+        /**
+         * @brief Count a change the greenhouse cannot see itself, such as a day
+         * passing or care given to plants in place
+         *
+         * Adding and removing plants is counted automatically.
+         */
+        void markChanged();
+
+        /**
+         * @brief Get the number of changes counted so far
+         * @return Change count; equal values mean nothing was added, removed or marked in between
+         */
+        uint64_t getChangeCount() const;
+
+        /**
+         * @brief Visit every plant with its position without building a vector
+         * @param visit Callable taking (Plant*, int row, int col)
+         */
+        template <typename Visitor>
+        void forEachPlant(Visitor visit) const {
+            plantGrid.forEachPlant(visit);
+        }
+
+        /**
+         * @brief Visit every plant inside a region of the grid
+         * @param region Region to visit; clipped to the grid
+         * @param visit Callable taking (Plant*, int row, int col)
+         */
+        template <typename Visitor>
+        void forEachPlant(const GridRegion& region, Visitor visit) const {
+            plantGrid.forEachPlant(region, visit);
+        }
+
+        /**
+         * @brief Name a region of the greenhouse, replacing any zone with the same name
+         * @param name Zone name such as "Bay A"
+         * @param region Cells in the zone; clipped to the grid
+         * @return true if the clipped zone contains at least one cell
+         */
+        bool defineZone(const std::string& name, const GridRegion& region);
+
+        /**
+         * @brief Look up a named zone
+         * @param name Zone name
+         * @param region Set to the zone's region if found
+         * @return true if the zone exists
+         */
+        bool getZone(const std::string& name, GridRegion& region) const;
+
+        /**
+         * @brief Forget a named zone
+         * @param name Zone name
+         * @return true if the zone existed
+         */
+        bool removeZone(const std::string& name);
+
+        /**
+         * @brief Re-files a plant after its state or sale readiness changed
+         * @param plant The plant whose status changed
+         */
+        void plantStatusChanged(Plant* plant) override;
+
+        /**
+         * @brief Get the number of plants in a lifecycle state without scanning the grid
+         * @param stateName State name such as "Seedling" or "Dead"
+         * @return Number of plants in that state
+         */
+        int getStateCount(const std::string& stateName) const;
+
+        /**
+         * @brief Get the plants in a lifecycle state
+         * @param stateName State name such as "Mature"
+         * @return Vector of plants in grid order
+         */
+        std::vector<Plant*> getPlantsInState(const std::string& stateName) const;
+
+        /**
+         * @brief Get the plants that are ready for sale
+         * @return Vector of ready plants in grid order
+         */
+        std::vector<Plant*> getReadyPlants() const;
+
+        /**
+         * @brief Get the number of plants that are ready for sale
+         * @return Number of ready plants
+         */
+        int getReadyCount() const;
+
+        /**
+         * @brief Get the number of plants of a species
+         * @param plantName Species name such as "Rose"
+         * @return Number of plants with that name
+         */
+        int getSpeciesCount(const std::string& plantName) const;
+
+        /**
+         * @brief Remove and delete every dead plant in one sweep
+         * @return Number of plants removed
+         */
+        int removeDeadPlants();
+
 
         std::string toString() const;
 };
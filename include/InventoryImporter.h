@@ -0,0 +1,142 @@
+/**
+ * @file InventoryImporter.h
+ * @brief Declares InventoryImporter, which stocks a greenhouse from a supplier's CSV manifest.
+ *
+ * A manifest has one plant per line, with an optional header line:
+ * @code
+ * species,id,age,water,sunlight,nutrients,price,row,col
+ * Rose,SUP-000001,14,80,70,60,45.00,0,0
+ * Venus Fly Trap,,3,60,60,60,120,0,1
+ * @endcode
+ *
+ * Species names are matched ignoring case, spaces, underscores and hyphens,
+ * so "VenusFlyTrap" and "venus_fly_trap" both work. An empty id keeps the
+ * one the factory assigns. Fields may be wrapped in double quotes, which
+ * cannot themselves be escaped.
+ *
+ * The file is read in fixed-size chunks and each line is parsed in place,
+ * so the importer's own memory stays the same however long the manifest is.
+ * Plants are built by the factory for their species and reach the
+ * greenhouse in batches through Greenhouse::addPlants().
+ */
+#ifndef INVENTORY_IMPORTER_H
+#define INVENTORY_IMPORTER_H
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Greenhouse.h"
+
+class CareScheduler;
+class PlantFactory;
+
+/**
+ * @class InventoryImporter
+ * @brief Streams a CSV manifest into a greenhouse.
+ *
+ * A row that cannot be parsed, names an unknown species, or targets a cell
+ * that is taken or outside the greenhouse is skipped and counted; the rest
+ * of the manifest is still imported. The age, vitals and price of each row
+ * replace the factory's defaults, health follows from the vitals, and the
+ * plant's state then moves on as far as its age and health allow.
+ */
+class InventoryImporter {
+public:
+    static constexpr size_t DEFAULT_CHUNK_BYTES = 1 << 20;
+    static constexpr size_t BATCH_SIZE = 4096;
+    static constexpr size_t MAX_ROW_ERRORS = 20;
+    static constexpr int FIELD_COUNT = 9;
+
+    /**
+     * @brief Creates an importer for a greenhouse.
+     * @param greenhouse Greenhouse to stock. Not owned.
+     * @param scheduler Scheduler the factories attach care observers for. May be nullptr.
+     * @param chunkBytes Bytes read at a time; also the longest line accepted.
+     */
+    InventoryImporter(Greenhouse* greenhouse, CareScheduler* scheduler = nullptr,
+                      size_t chunkBytes = DEFAULT_CHUNK_BYTES);
+
+    /**
+     * @brief Imports a manifest file.
+     * @param path CSV file to read.
+     * @return true if the whole file was read, even if some rows were skipped; see getError() otherwise.
+     */
+    bool importFile(const std::string& path);
+
+    /**
+     * @brief Imports a manifest from a stream.
+     * @param in Stream to read to the end.
+     * @return true if the whole stream was read.
+     */
+    bool importStream(std::istream& in);
+
+    /**
+     * @brief Gets the number of plants the last import placed in the greenhouse.
+     * @return Imported plant count.
+     */
+    size_t getImportedCount() const;
+
+    /**
+     * @brief Gets the number of rows the last import skipped.
+     * @return Rejected row count.
+     */
+    size_t getRejectedCount() const;
+
+    /**
+     * @brief Gets the reasons for the first MAX_ROW_ERRORS skipped rows.
+     * @return Messages of the form "line N: reason".
+     */
+    const std::vector<std::string>& getRowErrors() const;
+
+    /**
+     * @brief Gets the reason the last import failed.
+     * @return Error message, or an empty string after a success.
+     */
+    const std::string& getError() const;
+
+private:
+    /**
+     * @brief Parses every complete line in data.
+     * @param final true when no more data follows, so a last line without a newline is complete.
+     * @return Bytes consumed; the rest is the start of a line still being read.
+     */
+    size_t parseLines(const char* data, size_t size, bool final);
+
+    /**
+     * @brief Parses one line, without its newline, and queues the plant it describes.
+     */
+    void parseLine(const char* begin, const char* end);
+
+    /**
+     * @brief Sends the queued plants to the greenhouse and deletes any it could not place.
+     */
+    void flushBatch();
+
+    /**
+     * @brief Counts a skipped row and keeps its reason if there is room.
+     */
+    void rejectRow(size_t line, const char* reason);
+
+    /**
+     * @brief Finds the factory for a species name.
+     * @return Factory, or nullptr for an unknown species.
+     */
+    static const PlantFactory* factoryFor(std::string_view species);
+
+    Greenhouse* greenhouse_;
+    CareScheduler* scheduler_;
+    std::vector<char> buffer_;
+    std::vector<PlantPlacement> batch_;
+    std::vector<size_t> batchLines_;    ///< Line number of each queued plant
+    size_t line_;
+    bool skipping_;                     ///< Discarding the rest of a line longer than the buffer
+    size_t imported_;
+    size_t rejected_;
+    std::vector<std::string> rowErrors_;
+    std::string error_;
+};
+
+#endif // INVENTORY_IMPORTER_H
@@ -0,0 +1,141 @@
+/**
+ * @file JournalReplay.h
+ * @brief Declares JournalReplay, which rebuilds the inventory and totals the sales and care in a TransactionJournal file.
+ */
+#ifndef JOURNAL_REPLAY_H
+#define JOURNAL_REPLAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "TransactionJournal.h"
+
+/**
+ * @class JournalReplay
+ * @brief Reads a journal front to back and keeps what its records add up to.
+ *
+ * Each plant's location is the one its last move left it in. A sale moves
+ * every plant still in that customer's cart to JournalLocation::Sold, since
+ * checkout orders the whole cart. New stock and discarded dead plants are
+ * journaled too, so a journal kept from the start rebuilds the whole
+ * inventory; plants stocked before it was opened only appear once they move.
+ *
+ * Reading stops at the first record that is torn, fails its checksum or is
+ * out of sequence; everything before it is kept.
+ */
+class JournalReplay {
+public:
+    JournalReplay();
+
+    /**
+     * @brief Replays a journal file, replacing the results of any earlier replay.
+     * @param path Journal to read.
+     * @return true if the file could be read; a damaged tail still counts as read.
+     */
+    bool replay(const std::string& path);
+
+    /**
+     * @brief Gets where a plant ended up.
+     * @param plantId Plant ID as journaled.
+     * @return Its last location, or JournalLocation::Unknown if it never appeared.
+     */
+    JournalLocation getLocation(const std::string& plantId) const;
+
+    /**
+     * @brief Gets the number of known plants at a location.
+     * @param location Location to count.
+     * @return Plant count.
+     */
+    size_t getPlantCount(JournalLocation location) const;
+
+    /**
+     * @brief Gets the number of sale records.
+     * @return Sale count.
+     */
+    size_t getSaleCount() const;
+
+    /**
+     * @brief Gets the sum of all sale amounts.
+     * @return Sales total.
+     */
+    double getSalesTotal() const;
+
+    /**
+     * @brief Gets the number of payment records.
+     * @return Payment count.
+     */
+    size_t getPaymentCount() const;
+
+    /**
+     * @brief Gets the sum of all payment amounts.
+     * @return Payments total.
+     */
+    double getPaymentsTotal() const;
+
+    /**
+     * @brief Gets the number of times a care action was journaled.
+     * @param action Care action to count.
+     * @return Care count.
+     */
+    size_t getCareCount(CareAction action) const;
+
+    /**
+     * @brief Gets the number of records replayed.
+     * @return Record count.
+     */
+    uint64_t getRecordCount() const;
+
+    /**
+     * @brief Checks whether reading stopped before the end of the file.
+     * @return true if a damaged record was found.
+     */
+    bool hasDamagedTail() const;
+
+    /**
+     * @brief Gets the reason the last replay failed.
+     * @return Error message, or an empty string after a success.
+     */
+    const std::string& getError() const;
+
+    /**
+     * @brief Prints the totals and where the plants the journal has seen ended up.
+     * @param out Stream to print to.
+     */
+    void printSummary(std::ostream& out) const;
+
+private:
+    /**
+     * @brief A plant the journal has seen.
+     */
+    struct PlantEntry {
+        JournalLocation location = JournalLocation::Unknown;
+        std::string customer;       ///< Cart the plant is in, if any
+    };
+
+    /**
+     * @brief Applies one valid record.
+     */
+    void apply(const JournalRecord& record);
+
+    /**
+     * @brief Clears the results of the last replay.
+     */
+    void reset();
+
+    std::unordered_map<std::string, PlantEntry> plants_;
+    std::unordered_map<std::string, std::vector<std::string>> carts_;  ///< Plant IDs by customer
+    size_t sales_;
+    double salesTotal_;
+    size_t payments_;
+    double paymentsTotal_;
+    size_t care_[CARE_ACTION_COUNT];
+    uint64_t records_;
+    bool damagedTail_;
+    std::string error_;
+};
+
+#endif // JOURNAL_REPLAY_H
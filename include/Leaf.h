@@ -107,6 +107,13 @@ class Leaf : public Order {
          * @return Plant name string
          */        
         std::string getName() const override;
+
+        /**
+         * @brief Returns the plant this leaf stands for
+         *
+         * @return Pointer to the plant (owned by the leaf only if it was created owning it)
+         */
+        Plant* getPlant() const;
         
         /**
          * @brief Creates an iterator for this leaf node
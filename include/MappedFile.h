@@ -0,0 +1,63 @@
+/**
+ * @file MappedFile.h
+ * @brief Declares MappedFile, a read-only view of a whole file.
+ */
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Read-only view of a whole file, memory-mapped where the platform allows.
+ *
+ * Used by the snapshot and checkpoint readers, which walk their records
+ * front to back once, and by the order history, which reads records in
+ * any order. Where mapping is not available the file is read into a
+ * buffer instead.
+ */
+class MappedFile {
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Maps a file, replacing any file mapped before.
+     * @param path File to open.
+     * @param sequential true if the data will be read front to back once, so the
+     *        system may read ahead and drop pages already read.
+     * @return true if the file could be opened; an empty file maps to no data.
+     */
+    bool open(const std::string& path, bool sequential = true);
+
+    /**
+     * @brief Gets the file's bytes.
+     * @return Start of the file, or nullptr if nothing is mapped.
+     */
+    const char* data() const;
+
+    /**
+     * @brief Gets the file's size.
+     * @return Size in bytes.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Unmaps the file, if any.
+     */
+    void close();
+
+private:
+#if defined(_WIN32)
+    std::vector<char> buffer_;
+#endif
+    const char* data_;
+    size_t size_;
+};
+
+#endif // MAPPED_FILE_H
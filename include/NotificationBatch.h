@@ -0,0 +1,116 @@
+/**
+ * @file NotificationBatch.h
+ * @brief Declares NotificationBatch, a scope that coalesces plant observer notifications.
+ *
+ * Normally Plant::notify() calls every attached observer straight away, so an
+ * observer can run several times for one plant in a single day and see the
+ * plant half-way through its update. While a NotificationBatch is open,
+ * notify() only marks the plant dirty. When the batch is flushed, each
+ * observer receives one PlantObserver::updateBatch() call covering all the
+ * dirty plants it watches, and sees them in their end-of-tick condition.
+ */
+#ifndef NOTIFICATION_BATCH_H
+#define NOTIFICATION_BATCH_H
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+class Plant;
+class PlantObserver;
+
+/**
+ * @class NotificationBatch
+ * @brief RAII scope that defers Plant::notify() until the end of a tick.
+ *
+ * Open one around a loop of dailyUpdate() calls. Batches nest: an inner batch
+ * collects the plants first notified while it is open and delivers them when
+ * it closes, while a plant already waiting in an outer batch stays there and
+ * is delivered when that batch closes. Batches belong to the thread that
+ * opened them and must be closed in reverse order.
+ *
+ * Example:
+ * @code
+ * {
+ *     NotificationBatch batch;
+ *     for (Plant* plant : plants) {
+ *         plant->dailyUpdate();
+ *     }
+ * } // observers are notified here, at most once per plant
+ * @endcode
+ */
+class NotificationBatch {
+public:
+    /**
+     * @brief Opens a batch; notifications on this thread are deferred until it closes.
+     */
+    NotificationBatch();
+
+    /**
+     * @brief Delivers any pending notifications and closes the batch.
+     */
+    ~NotificationBatch();
+
+    NotificationBatch(const NotificationBatch&) = delete;
+    NotificationBatch& operator=(const NotificationBatch&) = delete;
+
+    /**
+     * @brief Delivers the pending notifications now and keeps the batch open.
+     *
+     * Notifications raised by observers while they are being delivered are
+     * sent immediately rather than deferred.
+     */
+    void flush();
+
+    /**
+     * @brief Gets the number of plants waiting to be notified.
+     * @return Dirty plant count.
+     */
+    int getPendingCount() const;
+
+    /**
+     * @brief Gets the innermost open batch on this thread.
+     * @return The batch, or nullptr if notifications are immediate.
+     */
+    static NotificationBatch* getActive();
+
+    /**
+     * @brief Records a plant whose observers are owed a notification.
+     *
+     * Called by Plant::notify(); the plant remembers its position in the
+     * batch, so it is only deferred once and forget() needs no search.
+     *
+     * @param plant Plant to notify at the end of the batch.
+     */
+    void defer(Plant* plant);
+
+    /**
+     * @brief Drops a pending plant, e.g. because it is being deleted.
+     *
+     * Uses the position stored on the plant, so the cost does not depend on
+     * how many plants are pending.
+     *
+     * @param plant Plant to drop.
+     */
+    void forget(Plant* plant);
+
+private:
+    /**
+     * @brief Dirty plants watched by one observer.
+     */
+    struct ObserverGroup {
+        PlantObserver* observer;
+        std::vector<Plant*> plants;
+    };
+
+    NotificationBatch* outer_;                              ///< Batch that was active before this one
+    std::vector<Plant*> dirty_;                             ///< Plants in the order they first notified; nullptr once forgotten
+    size_t forgotten_;                                      ///< Entries of dirty_ cleared by forget()
+    std::vector<ObserverGroup> groups_;                     ///< Reused between flushes
+    std::unordered_map<PlantObserver*, size_t> groupIndex_; ///< Observer to its entry in groups_
+    std::vector<size_t> slotGroups_;                        ///< Last group seen at each observer slot
+
+    static thread_local NotificationBatch* active_;
+};
+
+#endif // NOTIFICATION_BATCH_H
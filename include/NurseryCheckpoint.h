@@ -0,0 +1,184 @@
+/**
+ * @file NurseryCheckpoint.h
+ * @brief Declares NurseryCheckpoint, incremental checkpoints chained to a full NurserySnapshot.
+ *
+ * Most of a large nursery is unchanged from one day to the next, so only the
+ * first checkpoint writes a full snapshot. Each later one writes a delta file
+ * holding just what changed since the previous checkpoint, found through the
+ * DirtyEpoch stamps on plants, grid cells and finished orders:
+ *
+ * - a grid cell whose occupant was added, removed or replaced is rewritten,
+ *   or recorded as emptied;
+ * - a plant that stayed in its cell but changed is rewritten;
+ * - a finished order that is new or was added to is rewritten whole;
+ * - customers, carts and the care queue are small and always rewritten.
+ *
+ * Deltas are named after the base, as "<base>.delta.1", "<base>.delta.2" and
+ * so on, and carry the base's snapshot identifier, so a delta left over from
+ * an older chain is never applied. After a set number of deltas the next
+ * checkpoint writes a fresh full snapshot and removes the chain.
+ *
+ * Delta file layout (native byte order, every section 8-byte aligned):
+ * @code
+ * DeltaHeader                          includes a SnapshotHeader for the sections below
+ * SnapshotCell[cellCount]              cells emptied since the previous checkpoint
+ * SnapshotOrderSlot[orderCount]        position of each rewritten order in the order list
+ * SnapshotPlant[...] ... char strings[...]   same sections as a snapshot
+ * @endcode
+ */
+#ifndef NURSERY_CHECKPOINT_H
+#define NURSERY_CHECKPOINT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "NurserySnapshot.h"
+
+/**
+ * @struct SnapshotCell
+ * @brief A greenhouse or sales-floor cell that is now empty.
+ */
+struct SnapshotCell {
+    uint8_t location;       ///< NurserySnapshot::InGreenhouse or OnSalesFloor
+    uint8_t reserved[3];
+    int32_t row;
+    int32_t col;
+    uint32_t reserved2;
+};
+
+/**
+ * @struct SnapshotOrderSlot
+ * @brief Position in the order list of the order record with the same index.
+ */
+struct SnapshotOrderSlot {
+    uint32_t index;
+    uint32_t reserved;
+};
+
+/**
+ * @struct DeltaHeader
+ * @brief First record of every delta file.
+ */
+struct DeltaHeader {
+    char magic[8];              ///< "NURDLTA" and a null
+    uint32_t version;
+    uint32_t headerSize;        ///< sizeof(DeltaHeader) when written
+    uint32_t baseId;            ///< SnapshotHeader::snapshotId of the base this delta follows
+    uint32_t sequence;          ///< 1 for the first delta after the base
+    uint32_t cellCount;         ///< Emptied cells
+    uint32_t orderTotal;        ///< Length of the order list when the delta was taken
+    SnapshotHeader sections;    ///< Counts of the snapshot-shaped sections that follow
+};
+
+/**
+ * @class NurseryCheckpoint
+ * @brief Writes a base snapshot plus deltas, and restores or compacts the chain.
+ *
+ * One NurseryCheckpoint should own a base path; the objects it checkpoints
+ * must be the same from one checkpoint to the next, since a delta only holds
+ * what their DirtyEpoch stamps say changed. The same limits as
+ * NurserySnapshot apply to commands, observers and order items.
+ */
+class NurseryCheckpoint {
+public:
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * @brief Creates a checkpoint writer for a base path.
+     * @param basePath File the full snapshot is kept in; deltas are written beside it.
+     * @param compactionInterval Deltas to write before the next checkpoint is a full snapshot.
+     */
+    explicit NurseryCheckpoint(const std::string& basePath, int compactionInterval = 8);
+
+    /**
+     * @brief Writes a delta, or a full snapshot if there is no base yet or the chain is due for compaction.
+     * @param contents The nursery to checkpoint.
+     * @return true on success; see getError() otherwise.
+     */
+    bool checkpoint(const NurseryContents& contents);
+
+    /**
+     * @brief Writes a full snapshot and starts a new chain.
+     * @param contents The nursery to checkpoint.
+     * @return true on success.
+     */
+    bool writeBase(const NurseryContents& contents);
+
+    /**
+     * @brief Restores the base with every delta of its chain applied, in order.
+     *
+     * Later checkpoints continue the restored chain. The same rules as
+     * NurserySnapshot::load() apply to contents.
+     *
+     * @param mediator Mediator for the restored objects. May be nullptr.
+     * @param contents Receives the restored objects.
+     * @return true on success; nothing is created on failure.
+     */
+    bool restore(NurseryMediator* mediator, NurseryContents& contents);
+
+    /**
+     * @brief Merges the base and its deltas into a new base on disk and removes the deltas.
+     *
+     * Needs no live objects, so a chain can be compacted offline.
+     *
+     * @return true on success.
+     */
+    bool compact();
+
+    /**
+     * @brief Gets the file a delta is written to.
+     * @param sequence 1 for the first delta after the base.
+     * @return Delta path.
+     */
+    std::string getDeltaPath(int sequence) const;
+
+    /**
+     * @brief Gets the number of deltas chained to the current base.
+     * @return Delta count.
+     */
+    int getDeltaCount() const;
+
+    /**
+     * @brief Checks whether the last checkpoint() wrote a full snapshot.
+     * @return true after a full snapshot, false after a delta.
+     */
+    bool wasLastFull() const;
+
+    /**
+     * @brief Gets the number of plant records the last checkpoint wrote.
+     * @return Plant records written.
+     */
+    size_t getLastPlantCount() const;
+
+    /**
+     * @brief Gets the reason the last call failed.
+     * @return Error message, or an empty string after a success.
+     */
+    const std::string& getError() const;
+
+private:
+    /**
+     * @brief Reads the base and applies the chain, leaving the result in snapshot_'s buffers.
+     * @param header Receives the header describing the merged buffers.
+     * @param deltas Receives the number of deltas applied.
+     */
+    bool merge(SnapshotHeader& header, int& deltas);
+
+    /**
+     * @brief Removes every delta file after the base.
+     */
+    void removeDeltas();
+
+    std::string basePath_;
+    int compactionInterval_;
+    uint32_t baseId_;           ///< Identifier of the current base, 0 before the first one
+    int deltaCount_;
+    uint32_t since_;            ///< First DirtyEpoch not yet covered by a checkpoint
+    bool lastFull_;
+    size_t lastPlantCount_;
+    NurserySnapshot snapshot_;
+    std::string error_;
+};
+
+#endif // NURSERY_CHECKPOINT_H
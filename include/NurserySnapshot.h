@@ -0,0 +1,387 @@
+/**
+ * @file NurserySnapshot.h
+ * @brief Declares NurserySnapshot, the versioned binary save file for a whole nursery.
+ *
+ * A snapshot holds the greenhouse and sales-floor grids, every plant's
+ * vitals, state, price and decorations, the care scheduler's queue, the
+ * customers' carts and any finished orders. It is written front to back in
+ * one pass and read back by mapping the file into memory and constructing
+ * the objects straight from the fixed-size records, so a large nursery can
+ * be restored without replaying its history through the factories.
+ *
+ * File layout (native byte order, every section 8-byte aligned):
+ * @code
+ * SnapshotHeader
+ * SnapshotPlant[plantCount]          greenhouse, sales floor, carts, order items
+ * SnapshotCustomer[customerCount]
+ * SnapshotCommand[commandCount]
+ * SnapshotOrder[orderCount]
+ * SnapshotOrderNode[orderNodeCount]  order trees in pre-order
+ * char strings[stringBytes]          IDs, names and pot colours
+ * @endcode
+ */
+#ifndef NURSERY_SNAPSHOT_H
+#define NURSERY_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class CareScheduler;
+class Customer;
+class FinalOrder;
+class Greenhouse;
+class NurseryMediator;
+class Order;
+class Plant;
+class SalesFloor;
+
+/**
+ * @struct NurseryContents
+ * @brief The objects a snapshot is taken from or restored into. None are owned.
+ */
+struct NurseryContents {
+    Greenhouse* greenhouse = nullptr;
+    SalesFloor* salesFloor = nullptr;
+    CareScheduler* scheduler = nullptr;
+    std::vector<Customer*> customers;
+    std::vector<FinalOrder*> orders;    ///< Previous orders, e.g. for reordering
+    long long day = 0;                  ///< Simulation day the snapshot was taken on
+};
+
+/**
+ * @struct SnapshotStringRef
+ * @brief Location of a string in the snapshot's string section.
+ */
+struct SnapshotStringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/**
+ * @struct SnapshotHeader
+ * @brief First record of every snapshot file.
+ */
+struct SnapshotHeader {
+    char magic[8];              ///< "NURSERY" and a null
+    uint32_t version;
+    uint32_t headerSize;        ///< sizeof(SnapshotHeader) when written
+    int64_t day;
+    int32_t greenhouseRows;
+    int32_t greenhouseCols;
+    int32_t salesFloorRows;
+    int32_t salesFloorCols;
+    uint8_t greenhouseStorage;  ///< GridStorage of the greenhouse
+    uint8_t reserved[7];
+    uint32_t plantCount;
+    uint32_t customerCount;
+    uint32_t commandCount;
+    uint32_t orderCount;
+    uint32_t orderNodeCount;
+    uint32_t snapshotId;        ///< Identifies the snapshot to the checkpoint deltas chained to it
+    uint64_t stringBytes;
+};
+
+/**
+ * @struct SnapshotPlant
+ * @brief One plant, wherever it is kept.
+ */
+struct SnapshotPlant {
+    static constexpr int MAX_DECORATIONS = 3;
+
+    uint8_t location;       ///< NurserySnapshot::Location
+    uint8_t state;          ///< NurserySnapshot::StateCode
+    uint8_t strategy;       ///< NurserySnapshot::StrategyCode
+    uint8_t readyForSale;
+    uint8_t decorationCount;
+    uint8_t decorations[MAX_DECORATIONS];   ///< NurserySnapshot::DecorationCode, innermost first
+    int32_t row;            ///< Grid row, or owning customer for carts
+    int32_t col;            ///< Grid column
+    int32_t age;
+    int32_t waterLevel;
+    int32_t sunlightExposure;
+    int32_t nutrientLevel;
+    int32_t healthLevel;
+    uint8_t kind;           ///< NurserySnapshot::PlantKind
+    uint8_t species;        ///< PlantSpecies, used to rebuild GenericPlant records
+    uint8_t reserved[2];
+    double price;           ///< Price of the undecorated plant
+    SnapshotStringRef name;         ///< Plant name, stored only for GenericPlant records
+    SnapshotStringRef id;
+    SnapshotStringRef potColour;    ///< Colour of the decorative pot, if any
+};
+
+/**
+ * @struct SnapshotCustomer
+ * @brief One customer; their cart is the plants whose location is InCart and row is this index.
+ */
+struct SnapshotCustomer {
+    uint8_t kind;           ///< NurserySnapshot::CustomerKind
+    uint8_t reserved[7];
+    double budget;
+    SnapshotStringRef name;
+    SnapshotStringRef id;
+};
+
+/**
+ * @struct SnapshotCommand
+ * @brief One queued care command.
+ */
+struct SnapshotCommand {
+    uint32_t plant;         ///< Index into the plant records
+    uint8_t action;         ///< CareAction
+    uint8_t reserved[3];
+};
+
+/**
+ * @struct SnapshotOrder
+ * @brief One finished order; its items are a run of order nodes.
+ */
+struct SnapshotOrder {
+    SnapshotStringRef customerName;
+    uint32_t firstNode;
+    uint32_t nodeCount;
+};
+
+/**
+ * @struct SnapshotOrderNode
+ * @brief A sub-order or a single plant within an order.
+ */
+struct SnapshotOrderNode {
+    uint32_t parent;        ///< Index of the enclosing sub-order, or NO_PARENT for top-level items
+    uint32_t plant;         ///< Index into the plant records for single plants
+    uint8_t isGroup;        ///< 1 for a sub-order (ConcreteOrder), 0 for a plant (Leaf)
+    uint8_t reserved[7];
+    SnapshotStringRef name; ///< Sub-order name
+};
+
+/**
+ * @class NurserySnapshot
+ * @brief Writes and restores nursery snapshots.
+ *
+ * Only commands waiting in the scheduler's queue whose care action and
+ * target are known are saved; delayed and recurring commands on the timing
+ * wheel, and commands on plants outside the snapshot, are counted as
+ * skipped. Plants are restored with the care strategy of their kind and
+ * without observers. Restored order items own copies of their plants.
+ */
+class NurserySnapshot {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFFu;
+
+    /**
+     * @brief Largest grid, in cells, a snapshot may describe.
+     */
+    static constexpr uint64_t MAX_GRID_CELLS = 1ull << 26;
+
+    /**
+     * @brief Dense grids up to this many cells are restored whatever they hold.
+     */
+    static constexpr uint64_t MIN_DENSE_CELLS = 1ull << 20;
+
+    /**
+     * @brief Larger dense grids need at least one plant record per this many cells.
+     *
+     * A dense grid allocates every cell up front, so a damaged header must
+     * not be able to ask for gigabytes on behalf of a handful of plants.
+     */
+    static constexpr uint64_t DENSE_CELLS_PER_PLANT = 64;
+
+    /**
+     * @brief Where a plant record belongs.
+     */
+    enum Location : uint8_t { InGreenhouse, OnSalesFloor, InCart, InOrder };
+
+    /**
+     * @brief Concrete class of a plant record.
+     *
+     * GenericPlant is rebuilt as the base class of its species, under its saved name.
+     */
+    enum PlantKind : uint8_t {
+        GenericPlant, RosePlant, DaisyPlant, StrelitziaPlant, CactusPlant, AloePlant,
+        PotatoPlant, RadishPlant, CarrotPlant, MonsteraPlant, VenusFlyTrapPlant, PLANT_KIND_COUNT
+    };
+
+    /**
+     * @brief Lifecycle state of a plant record.
+     */
+    enum StateCode : uint8_t { NoState, Seedling, Growing, Mature, Flowering, Dead };
+
+    /**
+     * @brief Care strategy of a plant record.
+     */
+    enum StrategyCode : uint8_t { NoStrategy, FlowerCare, SucculentCare, VegetableCare, OtherPlantCare };
+
+    /**
+     * @brief One layer of decoration on a plant record.
+     */
+    enum DecorationCode : uint8_t { Ribbon, GiftWrap, DecorativePot };
+
+    /**
+     * @brief Kind of customer record.
+     */
+    enum CustomerKind : uint8_t { Regular, Corporate, WalkIn };
+
+    NurserySnapshot();
+
+    /**
+     * @brief Writes a snapshot of the given objects.
+     * @param path File to create or replace.
+     * @param contents Objects to save; null members are saved as empty.
+     * @return true on success; see getError() otherwise.
+     */
+    bool save(const std::string& path, const NurseryContents& contents);
+
+    /**
+     * @brief Restores a snapshot into new objects.
+     *
+     * Creates the greenhouse, sales floor, customers and orders and stores
+     * them in contents; the caller owns them. Queued commands are added to
+     * contents.scheduler if it is set. Restoring does not log each plant.
+     *
+     * @param path Snapshot file to read.
+     * @param mediator Mediator for the new greenhouse, sales floor and customers. May be nullptr.
+     * @param contents Receives the restored objects; greenhouse and sales floor must be null.
+     * @return true on success; nothing is created on failure.
+     */
+    bool load(const std::string& path, NurseryMediator* mediator, NurseryContents& contents);
+
+    /**
+     * @brief Gets the number of plants written or restored by the last call.
+     * @return Plant count.
+     */
+    size_t getPlantCount() const;
+
+    /**
+     * @brief Gets the number of queued commands the last save or load could not keep.
+     * @return Skipped command count.
+     */
+    size_t getSkippedCommandCount() const;
+
+    /**
+     * @brief Gets the identifier of the snapshot last written or restored.
+     * @return Snapshot identifier, or 0 before the first success.
+     */
+    uint32_t getSnapshotId() const;
+
+    /**
+     * @brief Gets the reason the last save or load failed.
+     * @return Error message, or an empty string after a success.
+     */
+    const std::string& getError() const;
+
+private:
+    friend class NurseryCheckpoint;
+
+    /**
+     * @brief A snapshot's header and the start of each of its sections.
+     *
+     * The sections may live in a mapped file or in this object's buffers.
+     */
+    struct Sections {
+        SnapshotHeader header;
+        const SnapshotPlant* plants;
+        const SnapshotCustomer* customers;
+        const SnapshotCommand* commands;
+        const SnapshotOrder* orders;
+        const SnapshotOrderNode* orderNodes;
+        const char* strings;
+    };
+
+    /**
+     * @brief Checks a whole snapshot file's header and locates its sections.
+     */
+    bool parse(const char* data, size_t size, Sections& sections);
+
+    /**
+     * @brief Locates the sections described by sections.header, which must fill the data exactly.
+     */
+    bool locate(const char* data, size_t size, Sections& sections);
+
+    /**
+     * @brief Checks the grid sizes and every record, so build() cannot fail halfway on bad input.
+     * @param greenhousePlants Set to the number of greenhouse records.
+     */
+    bool validate(const Sections& sections, size_t& greenhousePlants);
+
+    /**
+     * @brief Constructs the objects described by validated sections.
+     */
+    bool build(const Sections& sections, size_t greenhousePlants,
+               NurseryMediator* mediator, NurseryContents& contents);
+
+    /**
+     * @brief Gets the sections held in this object's buffers.
+     */
+    Sections bufferedSections(const SnapshotHeader& header) const;
+
+    /**
+     * @brief Builds a header describing the buffers and the given grids.
+     */
+    SnapshotHeader makeHeader(const NurseryContents& contents) const;
+
+    /**
+     * @brief Picks an identifier that differs between snapshots written to the same place.
+     */
+    static uint32_t newSnapshotId();
+
+    /**
+     * @brief Appends a string to the string section.
+     */
+    SnapshotStringRef addString(const std::string& text);
+
+    /**
+     * @brief Appends one plant record, unwrapping any decorations.
+     */
+    uint32_t addPlant(Plant* plant, Location location, int row, int col);
+
+    /**
+     * @brief Appends an order subtree in pre-order.
+     */
+    void addOrderNode(Order* order, uint32_t parent);
+
+    /**
+     * @brief Appends the customers and the plants in their carts.
+     */
+    void addCustomers(const std::vector<Customer*>& customers);
+
+    /**
+     * @brief Appends the scheduler's queued commands whose targets have been added.
+     */
+    void addCommands(CareScheduler* scheduler);
+
+    /**
+     * @brief Appends one finished order and its items.
+     */
+    void addOrder(FinalOrder* order);
+
+    /**
+     * @brief Writes the given header bytes followed by the buffered sections.
+     *
+     * Writes beside the target and renames, so a failed write never leaves a torn file.
+     */
+    bool writeFile(const std::string& path, const std::string& header);
+
+    /**
+     * @brief Clears the buffers used while saving.
+     */
+    void reset();
+
+    std::vector<SnapshotPlant> plants_;
+    std::vector<SnapshotCustomer> customers_;
+    std::vector<SnapshotCommand> commands_;
+    std::vector<SnapshotOrder> orders_;
+    std::vector<SnapshotOrderNode> orderNodes_;
+    std::string strings_;
+    std::unordered_map<const Plant*, uint32_t> plantIndex_;    ///< Filled only when commands are queued
+    bool indexPlants_;
+    size_t plantCount_;
+    size_t skippedCommands_;
+    uint32_t snapshotId_;
+    std::string error_;
+};
+
+#endif // NURSERY_SNAPSHOT_H
@@ -0,0 +1,313 @@
+/**
+ * @file OrderHistory.h
+ * @brief Declares OrderHistory, the on-disk record of every customer's past orders.
+ *
+ * Each paid order is appended to one file as a self-contained record with
+ * no pointers in it: the order tree is stored in pre-order as fixed-size
+ * nodes, and every name, plant ID and pot colour is an offset into the
+ * record's own string section. The file is memory-mapped and read in
+ * place, so listing, searching and pricing past orders only touch mapped
+ * pages and allocate nothing per order.
+ *
+ * A reorder rebuilds a FinalOrder from a record. Plants are built fresh by
+ * the factory for their species at the recorded price and redecorated;
+ * rebuilding one item of an order allocates only that item's nodes.
+ *
+ * File layout (native byte order, every record 8-byte aligned):
+ * @code
+ * HistoryFileHeader
+ * record:  HistoryRecordHeader
+ *          HistoryNode[nodeCount]     order tree in pre-order
+ *          char strings[]             offsets are from the record header
+ *          padding to 8 bytes
+ * record:  ...
+ * @endcode
+ */
+#ifndef ORDER_HISTORY_H
+#define ORDER_HISTORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MappedFile.h"
+
+class CareScheduler;
+class FinalOrder;
+class Order;
+class Plant;
+
+/**
+ * @struct HistoryStringRef
+ * @brief Location of a string, counted from the start of its record.
+ */
+struct HistoryStringRef {
+    uint32_t offset;
+    uint32_t length;
+};
+
+/**
+ * @struct HistoryFileHeader
+ * @brief First bytes of every order history file.
+ */
+struct HistoryFileHeader {
+    char magic[8];          ///< "NURHIST" and a null
+    uint32_t version;
+    uint32_t headerSize;    ///< sizeof(HistoryFileHeader) when written
+};
+
+/**
+ * @struct HistoryRecordHeader
+ * @brief First bytes of one order's record.
+ */
+struct HistoryRecordHeader {
+    uint32_t recordBytes;   ///< Bytes from this header to the next one
+    uint32_t nodeCount;
+    uint32_t plantCount;    ///< Nodes that are single plants
+    int32_t day;            ///< Simulation day the order was paid on
+    uint64_t sequence;      ///< Position of the record in the file, from 0
+    double total;           ///< Order total, decorations included
+    HistoryStringRef customerId;
+    HistoryStringRef customerName;
+};
+
+/**
+ * @struct HistoryNode
+ * @brief A sub-order or a single plant within a recorded order.
+ */
+struct HistoryNode {
+    static constexpr int MAX_DECORATIONS = 3;
+
+    uint32_t parent;        ///< Index of the enclosing sub-order, or OrderHistory::NO_PARENT
+    uint32_t subtreeEnd;    ///< Index one past the last node inside this one
+    uint8_t isGroup;        ///< 1 for a sub-order (ConcreteOrder), 0 for a plant (Leaf)
+    uint8_t decorationCount;
+    uint8_t decorations[MAX_DECORATIONS];   ///< OrderHistory::DecorationCode, innermost first
+    uint8_t reserved[3];
+    double price;           ///< Price of the plant or the whole sub-order, decorations included
+    double basePrice;       ///< Price of the undecorated plant; 0 for sub-orders
+    HistoryStringRef name;  ///< Sub-order name or plant name
+    HistoryStringRef plantId;
+    HistoryStringRef potColour;
+};
+
+/**
+ * @class OrderHistory
+ * @brief Append-only history of paid orders, indexed by customer ID.
+ *
+ * Opening a file checks every record and drops a torn or damaged tail, so
+ * later appends follow the last good record. Only the offsets of each
+ * customer's records are kept in memory.
+ */
+class OrderHistory {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t NO_PARENT = 0xFFFFFFFFu;
+
+    /**
+     * @brief One layer of decoration on a recorded plant.
+     */
+    enum DecorationCode : uint8_t { Ribbon, GiftWrap, DecorativePot };
+
+    /**
+     * @class OrderView
+     * @brief Read-only view of one record in the mapped file.
+     *
+     * A view is a single pointer and is only valid until the next append or
+     * close, which may remap the file.
+     */
+    class OrderView {
+    public:
+        OrderView();
+
+        /**
+         * @brief Checks whether the view refers to a record.
+         * @return false for a view of no order.
+         */
+        bool isValid() const;
+
+        uint64_t getSequence() const;           ///< Position of the order in the file
+        int getDay() const;                     ///< Simulation day the order was paid on
+        double getTotal() const;                ///< Order total, decorations included
+        size_t getNodeCount() const;            ///< Sub-orders and plants in the order tree
+        size_t getPlantCount() const;           ///< Plants in the order
+        std::string_view getCustomerId() const;
+        std::string_view getCustomerName() const;
+
+        /**
+         * @brief Gets one node of the order tree.
+         * @param index Node index, below getNodeCount().
+         * @return The node.
+         */
+        const HistoryNode& getNode(size_t index) const;
+
+        /**
+         * @brief Gets a string of this record.
+         * @param ref A reference from this record's header or nodes.
+         * @return The string, still in the mapped file.
+         */
+        std::string_view getString(const HistoryStringRef& ref) const;
+
+        /**
+         * @brief Checks whether any plant in the order has the given name.
+         * @param plantName Plant name, e.g. "Rose".
+         * @return true if it was ordered.
+         */
+        bool containsPlant(std::string_view plantName) const;
+
+    private:
+        friend class OrderHistory;
+        explicit OrderView(const char* record);
+
+        const HistoryRecordHeader& header() const;
+
+        const char* record_;
+    };
+
+    OrderHistory();
+    ~OrderHistory();
+
+    OrderHistory(const OrderHistory&) = delete;
+    OrderHistory& operator=(const OrderHistory&) = delete;
+
+    /**
+     * @brief Opens a history file, creating it if it does not exist.
+     * @param path History file.
+     * @return true on success; see getError() otherwise.
+     */
+    bool open(const std::string& path);
+
+    /**
+     * @brief Closes the file. Views of it become invalid.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether a file is open.
+     * @return true if open.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Appends a paid order.
+     * @param order The order; it is not changed or kept.
+     * @param customerId ID of the customer who paid, e.g. "REG-001".
+     * @param day Simulation day of the sale.
+     * @return true if the record was written.
+     */
+    bool append(const FinalOrder* order, const std::string& customerId, int day = 0);
+
+    /**
+     * @brief Gets the number of orders in the file.
+     * @return Order count.
+     */
+    size_t getOrderCount() const;
+
+    /**
+     * @brief Gets the number of orders of one customer.
+     * @param customerId Customer ID.
+     * @return Order count.
+     */
+    size_t getOrderCount(const std::string& customerId) const;
+
+    /**
+     * @brief Lists a customer's orders.
+     * @param customerId Customer ID.
+     * @return Views of the orders, oldest first.
+     */
+    std::vector<OrderView> getOrders(const std::string& customerId) const;
+
+    /**
+     * @brief Gets a customer's most recent order.
+     * @param customerId Customer ID.
+     * @return View of the order, or an invalid view if they have none.
+     */
+    OrderView getLatestOrder(const std::string& customerId) const;
+
+    /**
+     * @brief Finds a customer's orders that included a plant.
+     * @param customerId Customer ID.
+     * @param plantName Plant name, e.g. "Rose".
+     * @return Views of the matching orders, oldest first.
+     */
+    std::vector<OrderView> findOrders(const std::string& customerId, std::string_view plantName) const;
+
+    /**
+     * @brief Adds up the totals of a customer's orders.
+     * @param customerId Customer ID.
+     * @return Amount spent.
+     */
+    double getTotalSpent(const std::string& customerId) const;
+
+    /**
+     * @brief Rebuilds a whole order for a reorder.
+     * @param order A valid view.
+     * @param scheduler Scheduler the factories attach care observers for. May be nullptr.
+     * @return New order owning new plants; the caller owns it. nullptr for an invalid view.
+     */
+    FinalOrder* materialize(const OrderView& order, CareScheduler* scheduler = nullptr) const;
+
+    /**
+     * @brief Rebuilds one item of an order and whatever it contains.
+     * @param order A valid view.
+     * @param node Index of the node to rebuild.
+     * @param scheduler Scheduler the factories attach care observers for. May be nullptr.
+     * @return New Leaf or ConcreteOrder; the caller owns it. nullptr if node is out of range.
+     */
+    Order* materializeItem(const OrderView& order, size_t node, CareScheduler* scheduler = nullptr) const;
+
+    /**
+     * @brief Gets the reason the last open or append failed.
+     * @return Error message, or an empty string after a success.
+     */
+    const std::string& getError() const;
+
+private:
+    /**
+     * @brief Gets the mapped file, remapping it first if records were appended.
+     */
+    const char* mapped() const;
+
+    /**
+     * @brief Checks one record of the mapped file.
+     * @return Bytes of the record, or 0 if it is torn or damaged.
+     */
+    static size_t checkRecord(const char* data, size_t offset, size_t size);
+
+    /**
+     * @brief Appends an order subtree to the buffers in pre-order.
+     */
+    void addNode(const Order* order, uint32_t parent);
+
+    /**
+     * @brief Appends a string to the string buffer.
+     */
+    HistoryStringRef addString(const std::string& text);
+
+    /**
+     * @brief Builds a node and its descendants.
+     */
+    Order* buildNode(const OrderView& order, size_t index, CareScheduler* scheduler) const;
+
+    /**
+     * @brief Builds the plant of a plant node, decorations included.
+     */
+    Plant* buildPlant(const OrderView& order, const HistoryNode& node, CareScheduler* scheduler) const;
+
+    std::string path_;
+    std::ofstream out_;
+    mutable MappedFile map_;
+    mutable bool stale_;        ///< Records were appended since the file was mapped
+    uint64_t fileBytes_;
+    std::unordered_map<std::string, std::vector<uint64_t>> customerRecords_;   ///< Record offsets per customer ID
+    size_t orderCount_;
+    std::vector<HistoryNode> nodes_;    ///< Scratch buffers for append()
+    std::string strings_;
+    std::string error_;
+};
+
+#endif // ORDER_HISTORY_H
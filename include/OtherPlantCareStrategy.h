@@ -11,6 +11,17 @@
  */
 class OtherPlantCareStrategy : public CareStrategy {
 public:
+
+    /**
+     * @brief Returns the shared instance used by all other plant types
+     *
+     * The strategy holds no per-plant state, so every plant of this kind
+     * references the same object instead of owning its own copy.
+     *
+     * @return Pointer to the shared strategy (never deleted by plants)
+     */
+    static OtherPlantCareStrategy* getInstance();
+
     /**
      * @brief Waters general plants with standard care
      * 
@@ -50,6 +61,14 @@ public:
      * @param plant Pointer to the plant to be pruned
      */
     void prune(Plant* plant) override;
+
+    /**
+     * @brief Applies one care action to a batch of plants through SpeciesKernel<OtherPlantTraits>
+     * @param action Care action to apply
+     * @param plants Plants to care for
+     * @param count Number of plants
+     */
+    void careForBatch(CareAction action, Plant* const* plants, size_t count) override;
 };
 
 #endif
\ No newline at end of file
@@ -10,6 +10,15 @@
 #include <iostream>
 #include "FinalOrder.h"
 
+/**
+ * @enum PaymentMethod
+ * @brief How an order was paid for.
+ */
+enum class PaymentMethod : unsigned char {
+    Cash,
+    CreditCard
+};
+
 /**
  * @class PaymentProcessor
  * @brief Defines the skeleton for processing payments using the Template Method pattern.
@@ -30,6 +39,12 @@ public:
      */
     void processTransaction(FinalOrder* order);
 
+    /**
+     * @brief Gets how this processor takes payment.
+     * @return The payment method.
+     */
+    virtual PaymentMethod getPaymentMethod() const = 0;
+
 protected:
     /**
      * @brief Verifies the payment details (e.g. card info, cash).
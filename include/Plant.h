@@ -10,12 +10,18 @@
 #ifndef PLANT_H
 #define PLANT_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
 #include "CareStrategy.h"
 #include "PlantState.h"
 #include "PlantObserver.h"
+#include "PlantStateListener.h"
+#include "SpeciesTraits.h"
+#include "DirtyEpoch.h"
+
+class SimulationCalendar;
 
 /**
  * @class Plant
@@ -38,15 +44,123 @@ private:
     int healthLevel;
     bool readyForSale;
     double price;
-    std::vector<PlantObserver*> observers;
-    std::vector<PlantObserver*> ownedObservers;
+
+    /**
+     * @brief Heap storage used only when a plant needs more than the inline slots.
+     * Holds observers attached past the inline capacity and any observers owned by the plant.
+     */
+    struct ObserverSpill {
+        std::vector<PlantObserver*> observers;
+        std::vector<PlantObserver*> owned;
+    };
+
+    /**
+     * @brief Number of observers stored inline in the plant without heap allocation.
+     * Covers the standard water, fertilize and sunlight watchers.
+     */
+    static constexpr int INLINE_OBSERVER_CAPACITY = 3;
+
+    PlantObserver* observerSlots[INLINE_OBSERVER_CAPACITY];
+    ObserverSpill* observerSpill;
+    unsigned char inlineObserverCount;
+    unsigned char thresholdMask;
+    PlantSpecies species;       ///< Traits the batch kernels may use instead of dailyUpdate()
+    uint32_t dirtyEpoch;        ///< DirtyEpoch of the last change, for incremental checkpoints
+    int spriteId;               ///< Sprite the GUI draws the plant with, or NO_SPRITE_ID before it is looked up
+    uint32_t pendingSlot;       ///< One past the plant's index in a NotificationBatch, or 0 when not waiting
+    PlantStateListener* stateListener;
+    SimulationCalendar* calendar;   ///< Calendar tracking the plant, or nullptr
+
+    /**
+     * @brief Brings a calendar-tracked plant up to the calendar's current day.
+     *
+     * Called by every getter and setter whose value depends on the days
+     * passed, so a plant the calendar has left behind is never read stale.
+     */
+    void syncWithCalendar() const;
+
+    /**
+     * @brief Returns the spill storage, allocating it on first use.
+     * @return Pointer to the spill storage.
+     */
+    ObserverSpill* getObserverSpill();
+
+    /**
+     * @brief Tells the state listener, if any, that the state or sale readiness changed.
+     */
+    void notifyStateListener();
+
+    /**
+     * @brief Stamps the plant with the current DirtyEpoch.
+     */
+    void markDirty() {
+        dirtyEpoch = DirtyEpoch::current();
+    }
+
+    friend class InventoryImporter;
+    friend class NotificationBatch;
+    friend class NurserySnapshot;
+    friend class SimulationCalendar;
+
+    template <typename Traits>
+    friend class SpeciesKernel;
+
+    /**
+     * @brief Advances the plant by whole state segments instead of single days.
+     * @param days Number of days to advance.
+     * @param waterLoss Water lost per day.
+     * @param nutrientLoss Nutrients lost per day.
+     */
+    void fastForward(int days, int waterLoss, int nutrientLoss);
+
+    /**
+     * @brief Projects health after some days of the given decay, without care.
+     * @param days Number of days ahead.
+     * @param waterLoss Water lost per day.
+     * @param nutrientLoss Nutrients lost per day.
+     * @return Projected health level.
+     */
+    int projectedHealth(int days, int waterLoss, int nutrientLoss) const;
+
+    /**
+     * @brief Finds the first day on which projected health drops below a threshold.
+     * @param threshold Health level to compare against.
+     * @param horizon Last day to consider.
+     * @param waterLoss Water lost per day.
+     * @param nutrientLoss Nutrients lost per day.
+     * @return Day in [1, horizon], or horizon + 1 if health stays at or above the threshold.
+     */
+    int firstDayHealthBelow(int threshold, int horizon, int waterLoss, int nutrientLoss) const;
+
+protected:
+    /**
+     * @brief Gets the water this kind of plant loses each day.
+     * @return Water lost per dailyUpdate().
+     */
+    virtual int getDailyWaterLoss() const;
+
+    /**
+     * @brief Gets the nutrients this kind of plant consumes each day.
+     * @return Nutrients lost per dailyUpdate().
+     */
+    virtual int getDailyNutrientLoss() const;
+
+    /**
+     * @brief Declares which SpeciesTraits describe this plant's daily decay.
+     *
+     * Set by the species constructors. A subclass that overrides
+     * dailyUpdate() or the daily losses must leave it at PlantSpecies::Custom.
+     *
+     * @param newSpecies Species whose traits match this plant.
+     */
+    void setSpecies(PlantSpecies newSpecies);
 
 public:
     /**
      * @brief Constructs a new Plant object.
      * @param name The name of the plant.
      * @param id Unique identifier for the plant.
-     * @param careStrategy Pointer to the care strategy for this plant.
+     * @param careStrategy Pointer to the shared care strategy for this plant (not owned).
      * @param initialState Pointer to the initial state of the plant.
      */
     Plant(const std::string& name, const std::string& id,
@@ -58,6 +172,11 @@ public:
      */
     Plant(const Plant& other);
 
+    /**
+     * @brief Copy assignment is disabled; observer storage cannot be shared.
+     */
+    Plant& operator=(const Plant& other) = delete;
+
     /**
      * @brief Virtual destructor.
      * Ensures proper cleanup of observers and owned resources.
@@ -81,8 +200,27 @@ public:
      */
     void setState(PlantState* newState);
 
+    /**
+     * @brief Sets the listener told about state and sale-readiness changes.
+     * @param listener Listener to notify, or nullptr for none. Not owned.
+     */
+    void setStateListener(PlantStateListener* listener);
+
+    /**
+     * @brief Gets the listener told about state and sale-readiness changes.
+     * @return Pointer to the listener, or nullptr if none.
+     */
+    PlantStateListener* getStateListener() const;
+
+    /**
+     * @brief Gets the calendar tracking the plant.
+     * @return Pointer to the calendar, or nullptr if the plant is not tracked.
+     */
+    SimulationCalendar* getCalendar() const;
+
     /**
      * @brief Sets a new care strategy for the plant.
+     * Strategies are shared and not owned, so this only swaps the pointer.
      * @param newStrategy Pointer to the new CareStrategy object.
      */
     void setStrategy(CareStrategy* newStrategy);
@@ -107,15 +245,72 @@ public:
 
     /**
      * @brief Notifies all attached observers of state changes.
+     * 
+     * Inside a NotificationBatch the plant is only marked dirty, and its
+     * observers are notified once when the batch is flushed.
      */
     void notify();
 
     /**
      * @brief Adds an observer to the owned observers list.
+     * Owned observers are deleted with the plant. Shared observers such as the
+     * CareScheduler's standard watchers should be attached instead.
      * @param observer Pointer to the PlantObserver that will be owned by this plant.
      */
     void addOwnedObserver(PlantObserver* observer);
 
+    /**
+     * @brief Gets the number of observers currently attached.
+     * @return Number of attached observers.
+     */
+    int getObserverCount() const;
+
+    /**
+     * @brief Gets the threshold mask maintained by a ThresholdMonitor.
+     * Bit i is set while the plant is inside the zone of the monitor's rule i.
+     * @return The current threshold mask.
+     */
+    unsigned char getThresholdMask() const;
+
+    /**
+     * @brief Sets the threshold mask. Used by ThresholdMonitor after each scan.
+     * @param mask The new threshold mask.
+     */
+    void setThresholdMask(unsigned char mask);
+
+    /**
+     * @brief Gets the species whose traits describe this plant.
+     * @return The species, or PlantSpecies::Custom if dailyUpdate() must be called.
+     */
+    PlantSpecies getSpecies() const;
+
+    /**
+     * @brief Gets the DirtyEpoch the plant last changed in.
+     * @return Epoch of the last change to its vitals, state, strategy, readiness or price.
+     */
+    uint32_t getDirtyEpoch() const;
+
+    /**
+     * @brief Value of getSpriteId() before a front end has cached a sprite.
+     */
+    static constexpr int NO_SPRITE_ID = -1;
+
+    /**
+     * @brief Gets the sprite a front end cached for this plant.
+     *
+     * Saves the front end looking the sprite up by name every frame. A
+     * decorator starts with the sprite of the plant it wraps.
+     *
+     * @return The cached sprite ID, or NO_SPRITE_ID.
+     */
+    int getSpriteId() const;
+
+    /**
+     * @brief Caches the sprite a front end draws this plant with.
+     * @param id Sprite ID; its meaning is up to the front end.
+     */
+    void setSpriteId(int id);
+
     /**
      * @brief Gets the name of the plant.
      * @return The plant's name as a string.
@@ -216,6 +411,61 @@ public:
      */
     virtual void dailyUpdate();
 
+    /**
+     * @brief Advances the plant by several days in one step.
+     *
+     * Produces the same vitals, state, sale readiness and price as calling
+     * dailyUpdate() the given number of times, but jumps from one state
+     * boundary to the next instead of simulating every day. Falls back to
+     * daily updates while observers are attached, since they expect one
+     * notification per day.
+     *
+     * @param days Number of days to advance. Non-positive values do nothing.
+     */
+    virtual void advanceDays(int days);
+
+    /**
+     * @brief Advances the plant by several days while its vitals are held steady.
+     *
+     * Equivalent to restoring water, nutrients and sunlight every day before
+     * the state is evaluated: age and lifecycle advance, vitals do not.
+     *
+     * @param days Number of days to advance. Non-positive values do nothing.
+     */
+    virtual void advanceDaysMaintained(int days);
+
+    /**
+     * @brief Projects the water level after some days of daily decay without care.
+     * @param days Number of days ahead.
+     * @return Projected water level.
+     */
+    int getWaterLevelAfter(int days) const;
+
+    /**
+     * @brief Projects the nutrient level after some days of daily decay without care.
+     * @param days Number of days ahead.
+     * @return Projected nutrient level.
+     */
+    int getNutrientLevelAfter(int days) const;
+
+    /**
+     * @brief Projects the health level after some days of daily decay without care.
+     * @param days Number of days ahead.
+     * @return Projected health level.
+     */
+    int getHealthLevelAfter(int days) const;
+
+    /**
+     * @brief Finds the next day on which dailyUpdate() would change the plant's state.
+     *
+     * Covers growth, blooming, the end of blooming and death, assuming no
+     * care is given in between.
+     *
+     * @param horizon Last day to consider.
+     * @return Number of days until the change, or horizon + 1 if there is none within the horizon.
+     */
+    int daysUntilStateChange(int horizon) const;
+
     /**
      * @brief Updates the plant's condition based on current levels.
      */
@@ -0,0 +1,111 @@
+/**
+ * @file PlantEventQueue.h
+ * @brief Declares PlantEvent and PlantEventQueue, the bounded lock-free ring that carries plant lifecycle events.
+ *
+ * Any number of threads may push while a single consumer pops. Each cell
+ * carries a sequence number that tells producers and the consumer whose turn
+ * it is, so neither side ever takes a lock; a full queue drops the new event
+ * and counts it instead of blocking the simulation.
+ */
+#ifndef PLANT_EVENT_QUEUE_H
+#define PLANT_EVENT_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+class Plant;
+
+/**
+ * @enum PlantEventType
+ * @brief What happened to a plant.
+ */
+enum class PlantEventType {
+    StateChanged,           ///< Entered a new lifecycle state; PlantEvent::detail holds its name
+    MovedToSalesFloor,      ///< Moved from the greenhouse to the sales floor at (row, col)
+    TransferredToCustomer,  ///< Taken off display (or out of the greenhouse) into a customer's cart
+    ReturnedToSalesFloor    ///< Put back on display at (row, col)
+};
+
+/**
+ * @struct PlantEvent
+ * @brief One lifecycle event, copied by value into each subscriber's queue.
+ *
+ * The plant pointer identifies the plant but may be stale by the time the
+ * event is read; only dereference it while the simulation is paused.
+ */
+struct PlantEvent {
+    static constexpr size_t DETAIL_SIZE = 16;
+
+    unsigned long long sequence;    ///< Stream-wide order of the event
+    PlantEventType type;
+    const Plant* plant;
+    int row;                        ///< Destination row, or -1
+    int col;                        ///< Destination column, or -1
+    char detail[DETAIL_SIZE];       ///< State name for StateChanged, else empty; always null-terminated
+};
+
+/**
+ * @class PlantEventQueue
+ * @brief Bounded multi-producer single-consumer ring of PlantEvents.
+ */
+class PlantEventQueue {
+public:
+    /**
+     * @brief Constructs an empty queue.
+     * @param capacity Minimum number of events held; rounded up to a power of two, at least 2.
+     */
+    explicit PlantEventQueue(size_t capacity = 1024);
+
+    PlantEventQueue(const PlantEventQueue&) = delete;
+    PlantEventQueue& operator=(const PlantEventQueue&) = delete;
+
+    /**
+     * @brief Appends an event. Safe to call from any number of threads at once.
+     * @param event Event to copy in.
+     * @return false if the queue was full and the event was dropped.
+     */
+    bool tryPush(const PlantEvent& event);
+
+    /**
+     * @brief Removes the oldest event. Only the consumer thread may call this.
+     * @param event Set to the removed event.
+     * @return false if the queue was empty.
+     */
+    bool tryPop(PlantEvent& event);
+
+    /**
+     * @brief Removes up to maxEvents events, appending them to out. Consumer thread only.
+     * @param out Receives the events in order.
+     * @param maxEvents Most events to remove.
+     * @return Number of events removed.
+     */
+    size_t drain(std::vector<PlantEvent>& out, size_t maxEvents = static_cast<size_t>(-1));
+
+    /**
+     * @brief Gets the number of slots in the ring.
+     * @return Capacity after rounding.
+     */
+    size_t getCapacity() const;
+
+    /**
+     * @brief Gets the number of events dropped because the queue was full.
+     * @return Dropped event count.
+     */
+    unsigned long long getDroppedCount() const;
+
+private:
+    struct Cell {
+        std::atomic<size_t> turn;   ///< Position this cell is next written (== pos) or read (== pos + 1) at
+        PlantEvent event;
+    };
+
+    size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> pushPos_;   ///< Shared by producers
+    alignas(64) size_t popPos_;                 ///< Owned by the consumer
+    std::atomic<unsigned long long> dropped_;
+};
+
+#endif // PLANT_EVENT_QUEUE_H
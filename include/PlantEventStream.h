@@ -0,0 +1,93 @@
+/**
+ * @file PlantEventStream.h
+ * @brief Declares PlantEventStream, the append-only feed of plant lifecycle events.
+ *
+ * Plant::setState(), the coordinator's relocation and the mediator's
+ * transfers publish here. Each subscriber (the UI, analytics, persistence)
+ * registers its own PlantEventQueue and reads it at its own pace; publishing
+ * never waits on a subscriber, and costs one atomic load when nobody is listening.
+ */
+#ifndef PLANT_EVENT_STREAM_H
+#define PLANT_EVENT_STREAM_H
+
+#include <atomic>
+#include <string>
+
+#include "PlantEventQueue.h"
+
+class Plant;
+
+/**
+ * @class PlantEventStream
+ * @brief Process-wide fan-out of lifecycle events to subscriber queues (Singleton).
+ *
+ * Events may be published from any thread. Subscribing and unsubscribing are
+ * meant for set-up and tear-down, but may also race with publishers:
+ * unsubscribe() waits until no publish() can still be pushing to the queue,
+ * so the queue can be destroyed as soon as it returns. Each slot counts the
+ * publishers delivering through it, so that wait is only for publishers that
+ * had already found the queue, not for traffic to the other subscribers.
+ */
+class PlantEventStream {
+public:
+    static constexpr int MAX_SUBSCRIBERS = 8;
+
+    /**
+     * @brief Gets the process-wide stream.
+     * @return Pointer to the single instance.
+     */
+    static PlantEventStream* getInstance();
+
+    /**
+     * @brief Starts delivering events to a queue.
+     * @param queue Queue to fill. Not owned; must outlive the subscription.
+     * @return false if the queue is null, already subscribed, or all slots are taken.
+     */
+    bool subscribe(PlantEventQueue* queue);
+
+    /**
+     * @brief Stops delivering events to a queue.
+     *
+     * Waits for publish() calls that had already found the queue to finish
+     * pushing to it; the slot is not reused until then. Must not be called
+     * while the calling thread is itself publishing.
+     *
+     * @param queue Queue to remove.
+     */
+    void unsubscribe(PlantEventQueue* queue);
+
+    /**
+     * @brief Checks whether anyone is listening.
+     * @return true if at least one queue is subscribed.
+     */
+    bool hasSubscribers() const;
+
+    /**
+     * @brief Sends an event to every subscribed queue.
+     * @param type What happened.
+     * @param plant Plant it happened to.
+     * @param detail State name for StateChanged; truncated to fit PlantEvent::detail.
+     * @param row Destination row, or -1.
+     * @param col Destination column, or -1.
+     */
+    void publish(PlantEventType type, const Plant* plant, const std::string& detail = std::string(),
+                 int row = -1, int col = -1);
+
+    /**
+     * @brief Gets the number of events published while someone was subscribed.
+     * @return Published event count.
+     */
+    unsigned long long getPublishedCount() const;
+
+private:
+    PlantEventStream();
+    PlantEventStream(const PlantEventStream&) = delete;
+    PlantEventStream& operator=(const PlantEventStream&) = delete;
+
+    std::atomic<PlantEventQueue*> subscribers_[MAX_SUBSCRIBERS];
+    std::atomic<int> subscriberCount_;
+    std::atomic<int> delivering_[MAX_SUBSCRIBERS];  ///< publish() calls currently delivering through each slot
+    std::atomic<unsigned long long> nextSequence_;
+};
+
+#endif // PLANT_EVENT_STREAM_H
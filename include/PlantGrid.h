@@ -0,0 +1,362 @@
+/**
+ * @file PlantGrid.h
+ * @brief Declares PlantGrid, the contiguous row-major plant storage shared by Greenhouse and SalesFloor.
+ *
+ * All cells live in one buffer, so rows are contiguous and columns are a
+ * fixed stride apart. Rows, columns and rectangles are exposed as
+ * PlantGridView objects that iterate the buffer in place, and
+ * forEachPlant() visits the plants in a region with their positions,
+ * so callers never need to build a temporary vector.
+ *
+ * Very large, lightly populated grids can use GridStorage::Sparse, which
+ * keeps only the occupied cells in an ordered map keyed by row-major index.
+ * Lookups are then logarithmic and whole-grid walks scale with the number
+ * of plants instead of the number of cells.
+ *
+ * The grid also lists the cells filled or emptied during the current
+ * DirtyEpoch, so a checkpoint can find them without comparing whole grids.
+ * The list is dropped once a checkpoint closes the epoch, which keeps it as
+ * small as the changes themselves.
+ */
+#ifndef PLANT_GRID_H
+#define PLANT_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <vector>
+
+class Plant;
+class PlantGrid;
+
+/**
+ * @enum GridStorage
+ * @brief How a PlantGrid stores its cells.
+ */
+enum class GridStorage {
+    Dense,  ///< One pointer per cell; best for small or well-filled grids
+    Sparse  ///< Only occupied cells; memory and scans scale with the plant count
+};
+
+/**
+ * @struct GridRegion
+ * @brief Rectangle of grid cells, given by its top-left cell and size.
+ */
+struct GridRegion {
+    int row;        ///< First row
+    int col;        ///< First column
+    int rowCount;   ///< Number of rows
+    int colCount;   ///< Number of columns
+};
+
+/**
+ * @class PlantGridView
+ * @brief Non-owning view of the occupied cells in a region of a PlantGrid.
+ *
+ * Iterates in row-major order and skips empty cells. A view reads the grid
+ * live, so it reflects plants added or removed after it was created. On a
+ * sparse grid, removing the plant an iterator points at invalidates that
+ * iterator; stop iterating (or use forEachPlant) when removing as you go.
+ */
+class PlantGridView {
+public:
+    /**
+     * @brief Forward iterator over the plants in the view.
+     */
+    class Iterator {
+    public:
+        Iterator(const PlantGrid* grid, const GridRegion& region, bool atEnd);
+
+        Plant* operator*() const;
+        Iterator& operator++();
+        bool operator!=(const Iterator& other) const;
+        bool operator==(const Iterator& other) const;
+
+        /**
+         * @brief Gets the row of the current plant.
+         * @return Row index.
+         */
+        int getRow() const;
+
+        /**
+         * @brief Gets the column of the current plant.
+         * @return Column index.
+         */
+        int getColumn() const;
+
+    private:
+        void skipEmpty();
+        void skipOutsideRegion();
+
+        const PlantGrid* grid_;
+        GridRegion region_;
+        int row_;
+        int col_;
+        std::map<long long, Plant*>::const_iterator sparsePos_;
+    };
+
+    /**
+     * @brief Constructs a view over a region of a grid.
+     * @param grid Grid to view.
+     * @param region Region to view, already clipped to the grid.
+     */
+    PlantGridView(const PlantGrid* grid, const GridRegion& region);
+
+    Iterator begin() const;
+    Iterator end() const;
+
+    /**
+     * @brief Gets the region this view covers.
+     * @return The clipped region.
+     */
+    const GridRegion& getRegion() const;
+
+    /**
+     * @brief Counts the plants in the view.
+     * @return Number of occupied cells.
+     */
+    int countPlants() const;
+
+    /**
+     * @brief Checks whether the view contains no plants.
+     * @return true if every cell in the region is empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Copies the plants in the view into a vector.
+     * @return Plants in row-major order.
+     */
+    std::vector<Plant*> toVector() const;
+
+private:
+    const PlantGrid* grid_;
+    GridRegion region_;
+};
+
+/**
+ * @class PlantGrid
+ * @brief Fixed-size grid of plant pointers stored in one row-major buffer or sparsely.
+ *
+ * The grid does not own its plants; Greenhouse and SalesFloor decide when
+ * plants are deleted.
+ */
+class PlantGrid {
+public:
+    /**
+     * @brief Constructs an empty grid.
+     * @param rows Number of rows.
+     * @param cols Number of columns.
+     * @param storage Dense buffer or sparse occupied-cell map.
+     */
+    PlantGrid(int rows, int cols, GridStorage storage = GridStorage::Dense);
+
+    int getRows() const;
+    int getColumns() const;
+    GridStorage getStorage() const;
+
+    /**
+     * @brief Gets the number of occupied cells.
+     * @return Number of plants in the grid.
+     */
+    int getPlantCount() const;
+
+    /**
+     * @brief Gets the number of cells.
+     * @return rows * cols.
+     */
+    int getCapacity() const;
+
+    /**
+     * @brief Checks whether a position lies inside the grid.
+     * @param row Row position.
+     * @param col Column position.
+     * @return true if in bounds.
+     */
+    bool isInBounds(int row, int col) const;
+
+    /**
+     * @brief Gets the plant at a position.
+     * @param row Row position.
+     * @param col Column position.
+     * @return Pointer to the plant, or nullptr if empty or out of bounds.
+     */
+    Plant* getPlantAt(int row, int col) const;
+
+    /**
+     * @brief Stores a plant (or nullptr) at a position. Out-of-bounds positions are ignored.
+     * @param row Row position.
+     * @param col Column position.
+     * @param plant Plant to store, or nullptr to clear the cell.
+     */
+    void setPlantAt(int row, int col, Plant* plant);
+
+    /**
+     * @brief Finds the position of a plant.
+     * @param plant Plant to look for.
+     * @param row Set to the plant's row if found.
+     * @param col Set to the plant's column if found.
+     * @return true if the plant is in the grid.
+     */
+    bool findPosition(const Plant* plant, int& row, int& col) const;
+
+    /**
+     * @brief Empties every cell without deleting the plants.
+     */
+    void clear();
+
+    /**
+     * @brief Clips a region to the grid.
+     * @param region Region to clip.
+     * @return The part of the region inside the grid; zero-sized if none.
+     */
+    GridRegion clip(const GridRegion& region) const;
+
+    /**
+     * @brief Builds the region covering a band of full rows.
+     * @param firstRow First row in the band.
+     * @param rowCount Number of rows.
+     * @return Region clipped to the grid.
+     */
+    GridRegion getRowRange(int firstRow, int rowCount) const;
+
+    /**
+     * @brief Builds the region covering a band of full columns.
+     * @param firstCol First column in the band.
+     * @param colCount Number of columns.
+     * @return Region clipped to the grid.
+     */
+    GridRegion getColumnRange(int firstCol, int colCount) const;
+
+    PlantGridView getAll() const;
+    PlantGridView getRow(int row) const;
+    PlantGridView getColumn(int col) const;
+    PlantGridView getRegion(const GridRegion& region) const;
+
+    /**
+     * @brief Calls visit(plant, row, col) for every plant in a region, in row-major order.
+     * @param region Region to visit; clipped to the grid.
+     * @param visit Callable taking (Plant*, int, int).
+     */
+    template <typename Visitor>
+    void forEachPlant(const GridRegion& region, Visitor visit) const {
+        GridRegion area = clip(region);
+        if (storage_ == GridStorage::Sparse) {
+            forEachSparsePlant(area, visit);
+            return;
+        }
+        for (int i = area.row; i < area.row + area.rowCount; i++) {
+            Plant* const* rowCells = cells_.data() + static_cast<size_t>(i) * cols_;
+            for (int j = area.col; j < area.col + area.colCount; j++) {
+                if (rowCells[j] != nullptr) {
+                    visit(rowCells[j], i, j);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls visit(plant, row, col) for every plant in the grid.
+     * @param visit Callable taking (Plant*, int, int).
+     */
+    template <typename Visitor>
+    void forEachPlant(Visitor visit) const {
+        forEachPlant(GridRegion{0, 0, rows_, cols_}, visit);
+    }
+
+    /**
+     * @brief Gets the DirtyEpoch a cell's occupant last changed in.
+     * @param row Row position.
+     * @param col Column position.
+     * @return Epoch, or 0 if the cell is out of bounds or has not changed
+     *         since the last closed epoch (dense grids may still report older epochs).
+     */
+    uint32_t getCellEpoch(int row, int col) const;
+
+    /**
+     * @brief Calls visit(plant, row, col) for every cell filled, emptied or refilled in or after an epoch.
+     *
+     * Changes to a plant that stays in its cell are tracked by the plant, not the cell.
+     * Only the open epoch's changes are kept: once DirtyEpoch advances, the
+     * next write drops the closed epoch's list, since the checkpoint that
+     * closed it has already written those cells. The cost is therefore
+     * proportional to the cells changed, not to the grid size.
+     *
+     * @param since First epoch to report.
+     * @param visit Callable taking (Plant*, int, int); the plant is nullptr for cells now empty.
+     */
+    template <typename Visitor>
+    void forEachCellChangedSince(uint32_t since, Visitor visit) const {
+        if (changedEpoch_ < since) {
+            return;
+        }
+        if (storage_ == GridStorage::Sparse) {
+            for (long long key : sparseChanged_) {
+                int row = static_cast<int>(key / cols_);
+                int col = static_cast<int>(key % cols_);
+                visit(getPlantAt(row, col), row, col);
+            }
+            return;
+        }
+        for (long long key : changedCells_) {
+            visit(cells_[static_cast<size_t>(key)], static_cast<int>(key / cols_), static_cast<int>(key % cols_));
+        }
+    }
+
+private:
+    friend class PlantGridView;
+    friend class PlantGridView::Iterator;
+
+    using SparseCells = std::map<long long, Plant*>;
+
+    long long keyOf(int row, int col) const {
+        return static_cast<long long>(row) * cols_ + col;
+    }
+
+    /**
+     * @brief Adds a cell to the open epoch's change list, dropping the list
+     * first if the epoch it belongs to has been closed.
+     */
+    void noteChange(long long key);
+
+    /**
+     * @brief Sparse forEachPlant: walks the occupied cells, jumping over
+     * columns outside the region, so the cost is bounded by the plant count.
+     */
+    template <typename Visitor>
+    void forEachSparsePlant(const GridRegion& area, Visitor visit) const {
+        int endRow = area.row + area.rowCount;
+        int endCol = area.col + area.colCount;
+        SparseCells::const_iterator it = sparseCells_.lower_bound(keyOf(area.row, area.col));
+        while (it != sparseCells_.end()) {
+            int row = static_cast<int>(it->first / cols_);
+            int col = static_cast<int>(it->first % cols_);
+            if (row >= endRow) {
+                break;
+            }
+            if (col < area.col) {
+                it = sparseCells_.lower_bound(keyOf(row, area.col));
+            } else if (col >= endCol) {
+                it = sparseCells_.lower_bound(keyOf(row + 1, area.col));
+            } else {
+                Plant* plant = it->second;
+                ++it;
+                visit(plant, row, col);
+            }
+        }
+    }
+
+    int rows_;
+    int cols_;
+    GridStorage storage_;
+    int plantCount_;
+    std::vector<Plant*> cells_;
+    SparseCells sparseCells_;
+    std::vector<uint32_t> cellEpochs_;   ///< Dense: epoch each cell last changed in
+    std::vector<long long> changedCells_; ///< Dense: cells changed in changedEpoch_
+    std::set<long long> sparseChanged_;   ///< Sparse: cells changed in changedEpoch_
+    uint32_t changedEpoch_;               ///< Epoch the change lists belong to
+};
+
+#endif // PLANT_GRID_H
@@ -9,6 +9,8 @@
 #ifndef PLANT_OBSERVER_H
 #define PLANT_OBSERVER_H
 
+#include <cstddef>
+
 class Plant;
 
 /**
@@ -38,6 +40,22 @@ public:
      * @param plant Pointer to the Plant object that triggered the notification.
      */
     virtual void update(Plant* plant) = 0;
+
+    /**
+     * @brief Notifies the observer of several plants at once.
+     * 
+     * Called when a NotificationBatch is flushed, with every dirty plant this
+     * observer watches, each at most once. The default calls update() for
+     * each plant; observers can override it to process the whole span in one pass.
+     * 
+     * @param plants Plants that changed during the batch.
+     * @param count Number of plants.
+     */
+    virtual void updateBatch(Plant* const* plants, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            update(plants[i]);
+        }
+    }
 };
 
 #endif // PLANT_OBSERVER_H
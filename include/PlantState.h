@@ -5,6 +5,22 @@
 
 class Plant;
 
+/**
+ * @enum LifecycleStage
+ * @brief Lifecycle stage a PlantState stands for
+ *
+ * Other marks states outside the standard lifecycle, such as test doubles;
+ * they are always evaluated one day at a time through handleChange().
+ */
+enum class LifecycleStage : unsigned char {
+    Seedling,
+    Growing,
+    Mature,
+    Flowering,
+    Dead,
+    Other
+};
+
 /**
  * @class PlantState
  * @brief Abstract base class representing a state in the plant lifecycle (state design pattern)
@@ -46,6 +62,16 @@ public:
      * @return std::string The name of the current state
      */
     virtual std::string getStateName() = 0;
+
+    /**
+     * @brief Get the lifecycle stage this state stands for
+     *
+     * Unlike getStateName() this needs no virtual call or string, so it is
+     * what the lifecycle code and indexes compare against.
+     *
+     * @return LifecycleStage The stage, or Other for states outside the standard lifecycle
+     */
+    LifecycleStage getStage() const { return stage; }
     
 protected:
     /**
@@ -53,7 +79,16 @@ protected:
      * 
      * Only concrete state classes can be instantiated
      */
-    PlantState() {}
+    PlantState() : stage(LifecycleStage::Other) {}
+
+    /**
+     * @brief Constructor for the standard lifecycle states
+     * @param stage The stage the concrete state stands for
+     */
+    explicit PlantState(LifecycleStage stage) : stage(stage) {}
+
+private:
+    LifecycleStage stage;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+ * @file PlantStateListener.h
+ * @brief Declares the PlantStateListener interface used by containers that index plants by state.
+ *
+ * Unlike a PlantObserver, which is notified on every daily update, a state
+ * listener is only told when a plant's lifecycle state or sale readiness
+ * actually changes. A plant has at most one listener: the container that
+ * currently holds it.
+ */
+#ifndef PLANT_STATE_LISTENER_H
+#define PLANT_STATE_LISTENER_H
+
+class Plant;
+
+/**
+ * @class PlantStateListener
+ * @brief Interface for objects that track plants by lifecycle state.
+ */
+class PlantStateListener {
+public:
+    /**
+     * @brief Virtual destructor.
+     */
+    virtual ~PlantStateListener() {}
+
+    /**
+     * @brief Called after a plant's state or ready-for-sale flag has changed.
+     * @param plant The plant whose status changed.
+     */
+    virtual void plantStatusChanged(Plant* plant) = 0;
+};
+
+#endif // PLANT_STATE_LISTENER_H
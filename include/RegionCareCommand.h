@@ -0,0 +1,86 @@
+/**
+ * @file RegionCareCommand.h
+ * @brief Declares the RegionCareCommand concrete class for zone-wide care operations.
+ *
+ * This class provides a concrete implementation of the Command interface
+ * that applies one care action to every plant in a region of a greenhouse,
+ * so irrigating or re-lighting a whole bay is a single scheduled task.
+ */
+#ifndef REGION_CARE_COMMAND_H
+#define REGION_CARE_COMMAND_H
+
+#include "Command.h"
+#include "CareAction.h"
+#include "PlantGrid.h"
+#include <string>
+#include <vector>
+
+class CareStrategy;
+class Greenhouse;
+class Plant;
+
+/**
+ * @class RegionCareCommand
+ * @brief Concrete command that applies a care action to every plant in a greenhouse region.
+ *
+ * The region is either fixed at construction (a row band, column band or
+ * rectangle) or a named zone that is looked up when the command runs. On
+ * execution the command walks the region once, groups the plants by their
+ * shared care strategy, and hands each group to CareStrategy::careForBatch().
+ * Neither the greenhouse nor its plants are owned by the command.
+ */
+class RegionCareCommand : public Command {
+public:
+    /**
+     * @brief Constructs a command for a fixed region.
+     *
+     * @param greenhouse Greenhouse holding the plants. Not owned.
+     * @param region Cells to care for, e.g. from PlantGrid::getRowRange().
+     * @param action The care action to apply.
+     */
+    RegionCareCommand(Greenhouse* greenhouse, const GridRegion& region, CareAction action);
+
+    /**
+     * @brief Constructs a command for a named zone of the greenhouse.
+     *
+     * @param greenhouse Greenhouse holding the plants and the zone. Not owned.
+     * @param zoneName Name given to Greenhouse::defineZone(); resolved on execute.
+     * @param action The care action to apply.
+     */
+    RegionCareCommand(Greenhouse* greenhouse, const std::string& zoneName, CareAction action);
+
+    /**
+     * @brief Virtual destructor.
+     * Ensures proper cleanup. Note that the greenhouse and plants are not deleted.
+     */
+    virtual ~RegionCareCommand() {}
+
+    /**
+     * @brief Applies the care action to every plant currently in the region.
+     */
+    virtual void execute();
+
+    /**
+     * @brief Gets the number of plants cared for by the last execution.
+     * @return Plant count, or 0 if the command has not run.
+     */
+    int getLastPlantCount() const;
+
+private:
+    /**
+     * @brief Plants in the region that share one care strategy.
+     */
+    struct StrategyBatch {
+        CareStrategy* strategy;
+        std::vector<Plant*> plants;
+    };
+
+    Greenhouse* greenhouse_;            ///< Greenhouse holding the plants (not owned)
+    GridRegion region_;                 ///< Fixed region, unused for named zones
+    std::string zoneName_;              ///< Zone to look up, empty for fixed regions
+    CareAction action_;                 ///< Action applied to each plant
+    int lastPlantCount_;                ///< Plants cared for by the last execute()
+    std::vector<StrategyBatch> batches_; ///< Reused between executions
+};
+
+#endif // REGION_CARE_COMMAND_H
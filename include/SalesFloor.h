@@ -2,6 +2,8 @@
 #define SALESFLOOR_H
 
 #include "Colleague.h"
+#include "PlantGrid.h"
+#include <cstdint>
 #include <vector>
 
 class Plant;
@@ -18,7 +20,8 @@ class Customer;
  * - Coordinates with Greenhouse for restocking
  *
  * Implementation details:
- * - Uses a 2D grid system for plant display
+ * - Uses a 2D grid system for plant display, stored contiguously in a
+ *   PlantGrid so rows, columns and regions can be walked without copying
  * - Maintains list of current customers
  * - Tracks capacity and occupancy
  * - Handles plant transfer requests through mediator
@@ -33,12 +36,13 @@ class Customer;
  */
 class SalesFloor: public Colleague{
     private:
-        std::vector<std::vector<Plant*>> displayGrid;
+        PlantGrid displayGrid;
         std::vector<Customer*> currentCustomers;
         int rows;
         int cols;
         int currentNumberOfPlants;
         int capacity;
+        uint64_t changeCount;
 
     public:
         /**
@@ -162,6 +166,44 @@ class SalesFloor: public Colleague{
          */
         bool isPositionEmpty(int row, int col)const;
 
+        /**
+         * @brief Get read-only access to the display grid for zero-copy views
+         * @return The display grid
+         */
+        const PlantGrid& getGrid()const;
+
+        /**
+         * @brief Count a change the sales floor cannot see itself, such as a day passing
+         *
+         * Adding and removing plants is counted automatically.
+         */
+        void markChanged();
+
+        /**
+         * @brief Get the number of changes counted so far
+         * @return Change count; equal values mean nothing was added, removed or marked in between
+         */
+        uint64_t getChangeCount()const;
+
+        /**
+         * @brief Visit every plant on display with its position without building a vector
+         * @param visit Callable taking (Plant*, int row, int col)
+         */
+        template <typename Visitor>
+        void forEachPlant(Visitor visit)const{
+            displayGrid.forEachPlant(visit);
+        }
+
+        /**
+         * @brief Visit every plant on display inside a region of the grid
+         * @param region Region to visit; clipped to the grid
+         * @param visit Callable taking (Plant*, int row, int col)
+         */
+        template <typename Visitor>
+        void forEachPlant(const GridRegion& region, Visitor visit)const{
+            displayGrid.forEachPlant(region, visit);
+        }
+
         std::string toString() const;
 };
 
@@ -0,0 +1,264 @@
+/**
+ * @file SalesLedger.h
+ * @brief Declares SalesLedger, the columnar record of every plant sold.
+ *
+ * Each plant in a paid order becomes one line item. Line items are kept
+ * column by column in chunks of CHUNK_ROWS rows, one array each for the
+ * day, customer type, species, decorations, price and payment method, so
+ * an aggregate query reads only the columns it needs as tight loops over
+ * contiguous values. Species names are stored once in a dictionary and
+ * referred to by a small code.
+ *
+ * Every chunk knows the first and last day it covers, so a query limited
+ * to a range of days skips whole chunks outside it. Optionally, once more
+ * than a set number of full chunks are held in memory, the oldest are
+ * written to a spill file and queried from there through a memory map.
+ *
+ * Spill file layout (native byte order, every column 8-byte aligned):
+ * @code
+ * LedgerChunkHeader
+ * double price[rowCount]
+ * int32_t day[rowCount]
+ * uint16_t species[rowCount]
+ * uint8_t customerType[rowCount]
+ * uint8_t decorations[rowCount]
+ * uint8_t paymentMethod[rowCount]
+ * padding to 8 bytes, then the next chunk
+ * @endcode
+ */
+#ifndef SALES_LEDGER_H
+#define SALES_LEDGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "PaymentProcessor.h"
+
+class Customer;
+class FinalOrder;
+class Order;
+
+/**
+ * @struct LedgerChunkHeader
+ * @brief First record of each chunk in a spill file.
+ */
+struct LedgerChunkHeader {
+    char magic[8];          ///< "NURLDGR" and a null
+    uint32_t rowCount;
+    int32_t firstDay;
+    int32_t lastDay;
+    uint32_t reserved;
+    uint64_t chunkBytes;    ///< Bytes from this header to the next one
+};
+
+/**
+ * @struct RevenueTable
+ * @brief Revenue per species for each week, as returned by SalesLedger::revenueBySpeciesPerWeek().
+ */
+struct RevenueTable {
+    int firstWeek = 0;                  ///< Week of the first row; week n covers days 7n to 7n + 6
+    int weekCount = 0;
+    std::vector<std::string> species;   ///< Column names, in the ledger's species-code order
+    std::vector<double> revenue;        ///< weekCount rows of species.size() values
+
+    /**
+     * @brief Gets the revenue of one species in one week.
+     * @param week Week number, not a row index.
+     * @param speciesName Species to look up.
+     * @return Revenue, or 0 if the week or species is not in the table.
+     */
+    double get(int week, const std::string& speciesName) const;
+};
+
+/**
+ * @class SalesLedger
+ * @brief Process-wide columnar sales ledger (Singleton).
+ *
+ * Customers' checkouts append to it once an order is paid for. It is not
+ * safe to append and query from different threads at the same time.
+ */
+class SalesLedger {
+public:
+    static constexpr size_t CHUNK_ROWS = 65536;
+
+    /**
+     * @brief Kind of customer a line item was sold to.
+     */
+    enum CustomerType : uint8_t { Regular, Corporate, WalkIn, OtherCustomer, CUSTOMER_TYPE_COUNT };
+
+    /**
+     * @brief Bits of the decorations column.
+     */
+    enum Decoration : uint8_t { Ribbon = 1, GiftWrap = 2, DecorativePot = 4, ANY_DECORATION = 7 };
+
+    /**
+     * @brief Gets the process-wide ledger.
+     * @return Pointer to the single instance.
+     */
+    static SalesLedger* getInstance();
+
+    /**
+     * @brief Sets the simulation day new line items are recorded on.
+     * @param day Current day.
+     */
+    void setDay(int day);
+
+    /**
+     * @brief Gets the simulation day new line items are recorded on.
+     * @return Current day.
+     */
+    int getDay() const;
+
+    /**
+     * @brief Appends one line item for every plant in a paid order.
+     * @param order The order that was paid for.
+     * @param customer Who paid; decides the customer type. May be nullptr.
+     * @param processor How they paid. May be nullptr for a cash sale.
+     * @return Number of line items added.
+     */
+    size_t recordOrder(const FinalOrder* order, const Customer* customer, const PaymentProcessor* processor);
+
+    /**
+     * @brief Appends one line item.
+     * @param day Day of the sale.
+     * @param customerType Who bought it.
+     * @param speciesCode Code from speciesCode().
+     * @param decorations Decoration bits.
+     * @param price Price paid, decorations included.
+     * @param method How it was paid for.
+     */
+    void addLineItem(int day, CustomerType customerType, uint16_t speciesCode, uint8_t decorations,
+                     double price, PaymentMethod method);
+
+    /**
+     * @brief Gets the dictionary code of a species, adding it if it is new.
+     * @param speciesName Plant name, e.g. "Rose".
+     * @return Species code.
+     */
+    uint16_t speciesCode(const std::string& speciesName);
+
+    /**
+     * @brief Writes full chunks beyond a number kept in memory to a file, from now on.
+     * @param path Spill file; replaced if it exists.
+     * @param residentChunks Full chunks to keep in memory.
+     * @return true if the file could be created.
+     */
+    bool setSpillFile(const std::string& path, size_t residentChunks = 4);
+
+    /**
+     * @brief Removes every line item, the species dictionary and any spill file.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of line items recorded.
+     * @return Line item count.
+     */
+    size_t getLineItemCount() const;
+
+    /**
+     * @brief Gets the number of line items that live in the spill file.
+     * @return Spilled line item count.
+     */
+    size_t getSpilledLineItemCount() const;
+
+    /**
+     * @brief Adds up the price of every line item sold between two days.
+     * @param firstDay First day to include.
+     * @param lastDay Last day to include.
+     * @return Revenue.
+     */
+    double revenue(int firstDay = INT32_MIN, int lastDay = INT32_MAX) const;
+
+    /**
+     * @brief Adds up revenue by customer type.
+     * @return CUSTOMER_TYPE_COUNT values, indexed by CustomerType.
+     */
+    std::vector<double> revenueByCustomerType() const;
+
+    /**
+     * @brief Adds up revenue per species for each week with sales.
+     * @param firstDay First day to include.
+     * @param lastDay Last day to include.
+     * @return The revenue table; empty if nothing was sold in the range.
+     */
+    RevenueTable revenueBySpeciesPerWeek(int firstDay = INT32_MIN, int lastDay = INT32_MAX) const;
+
+    /**
+     * @brief Gets the share of line items carrying any of the given decorations.
+     * @param decorations Decoration bits to look for.
+     * @return Fraction between 0 and 1; 0 if the ledger is empty.
+     */
+    double decorationAttachRate(uint8_t decorations = ANY_DECORATION) const;
+
+private:
+    SalesLedger();
+    SalesLedger(const SalesLedger&) = delete;
+    SalesLedger& operator=(const SalesLedger&) = delete;
+
+    /**
+     * @brief Columns of up to CHUNK_ROWS line items held in memory.
+     */
+    struct Chunk {
+        std::vector<double> price;
+        std::vector<int32_t> day;
+        std::vector<uint16_t> species;
+        std::vector<uint8_t> customerType;
+        std::vector<uint8_t> decorations;
+        std::vector<uint8_t> paymentMethod;
+        int32_t firstDay;
+        int32_t lastDay;
+    };
+
+    /**
+     * @brief Read-only columns of one chunk, in memory or in the mapped spill file.
+     */
+    struct ChunkView {
+        size_t rowCount;
+        int32_t firstDay;
+        int32_t lastDay;
+        const double* price;
+        const int32_t* day;
+        const uint16_t* species;
+        const uint8_t* customerType;
+        const uint8_t* decorations;
+        const uint8_t* paymentMethod;
+    };
+
+    /**
+     * @brief Calls visit(const ChunkView&) for every chunk, spilled ones first.
+     */
+    template <typename Visitor>
+    void forEachChunk(Visitor visit) const;
+
+    /**
+     * @brief Appends line items for an order subtree.
+     */
+    size_t recordNode(const Order* node, CustomerType customerType, PaymentMethod method);
+
+    /**
+     * @brief Starts a new chunk, spilling old ones if the spill file is set.
+     */
+    void startChunk();
+
+    /**
+     * @brief Writes the oldest resident chunk to the spill file and drops it.
+     */
+    bool spillOldest();
+
+    std::vector<Chunk> chunks_;
+    std::vector<std::string> speciesNames_;
+    std::unordered_map<std::string, uint16_t> speciesCodes_;
+    int day_;
+    size_t lineItems_;
+    std::string spillPath_;
+    std::ofstream spill_;
+    size_t residentChunks_;
+    size_t spilledLineItems_;
+};
+
+#endif // SALES_LEDGER_H
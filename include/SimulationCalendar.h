@@ -0,0 +1,159 @@
+/**
+ * @file SimulationCalendar.h
+ * @brief Declares the SimulationCalendar class, an event-driven alternative to daily updates.
+ *
+ * Stepping every plant through dailyUpdate() each day touches plants that
+ * are nowhere near a threshold. The calendar instead works out, per plant,
+ * the next day on which something observable happens (a state change or a
+ * threshold zone change) and keeps those days in a priority queue. Advancing
+ * the calendar only processes plants whose event has fallen due; everything
+ * else is brought up to date lazily with Plant::advanceDays().
+ */
+#ifndef SIMULATION_CALENDAR_H
+#define SIMULATION_CALENDAR_H
+
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+class Plant;
+class ThresholdMonitor;
+
+/**
+ * @class SimulationCalendar
+ * @brief Discrete-event engine that advances plants only when their next event is due.
+ *
+ * Produces the same plants and the same scheduled care as the day-by-day loop
+ * of calling dailyUpdate() on every plant and then ThresholdMonitor::scan()
+ * on the whole batch. Plants with observers attached are processed every day
+ * so that each notification is still delivered.
+ *
+ * Plants between events hold stale vitals, so the calendar marks the plants
+ * it tracks and their getters and setters call materialize() first; a plant
+ * is never read or changed as of an earlier day. Because reading a tracked
+ * plant can advance it, tracked plants must be used from the thread that
+ * advances the calendar. Call reschedule() after changing a plant outside
+ * the calendar (for example after running its care commands).
+ */
+class SimulationCalendar {
+public:
+    /**
+     * @brief Furthest a single lookup plans ahead; quiet plants wake up to re-plan after this.
+     */
+    static constexpr int LOOKAHEAD_DAYS = 1 << 16;
+
+    /**
+     * @brief Constructs a calendar at day 0.
+     * @param monitor Threshold monitor scanned on event days, or nullptr for none. Not owned.
+     */
+    explicit SimulationCalendar(ThresholdMonitor* monitor = nullptr);
+
+    /**
+     * @brief Stops tracking every plant, leaving each as of the day it was last brought up to.
+     */
+    ~SimulationCalendar();
+
+    SimulationCalendar(const SimulationCalendar&) = delete;
+    SimulationCalendar& operator=(const SimulationCalendar&) = delete;
+
+    /**
+     * @brief Starts tracking a plant from the current day.
+     * @param plant Plant to track. Not owned. Ignored if null or already tracked by any calendar.
+     */
+    void addPlant(Plant* plant);
+
+    /**
+     * @brief Brings a plant up to date and stops tracking it.
+     * @param plant Plant to remove.
+     */
+    void removePlant(Plant* plant);
+
+    /**
+     * @brief Advances the calendar, processing every event that falls due.
+     * @param days Number of days to advance. Non-positive values do nothing.
+     * @return Number of care commands scheduled by the threshold monitor.
+     */
+    int advance(int days);
+
+    /**
+     * @brief Brings a plant's vitals, state and price up to the current day.
+     * @param plant Tracked plant to update.
+     */
+    void materialize(Plant* plant);
+
+    /**
+     * @brief Brings every tracked plant up to the current day.
+     */
+    void materializeAll();
+
+    /**
+     * @brief Re-plans a plant's next event after it was changed outside the calendar.
+     *
+     * The plant should have been materialized before it was changed.
+     *
+     * @param plant Tracked plant to re-plan.
+     */
+    void reschedule(Plant* plant);
+
+    /**
+     * @brief Gets the current simulation day.
+     * @return Days advanced since construction.
+     */
+    int getCurrentDay() const;
+
+    /**
+     * @brief Gets the number of tracked plants.
+     * @return Tracked plant count.
+     */
+    int getPlantCount() const;
+
+    /**
+     * @brief Gets the number of plant events processed so far.
+     * @return Processed event count.
+     */
+    long long getProcessedEventCount() const;
+
+private:
+    struct Entry {
+        int syncedDay;                  ///< Day the plant's fields reflect
+        unsigned long long order;       ///< Registration order, used to order scans within a day
+        unsigned long long ticket;      ///< Ticket of the plant's live event
+    };
+
+    struct Event {
+        int day;
+        unsigned long long order;
+        unsigned long long ticket;
+        Plant* plant;
+    };
+
+    struct LaterEvent {
+        bool operator()(const Event& a, const Event& b) const {
+            if (a.day != b.day) {
+                return a.day > b.day;
+            }
+            return a.order > b.order;
+        }
+    };
+
+    friend class Plant;
+
+    void scheduleNext(Plant* plant, Entry& entry);
+
+    /**
+     * @brief Drops a plant that is being destroyed, without bringing it up to date.
+     */
+    void forget(Plant* plant);
+
+    ThresholdMonitor* monitor_;
+    int currentDay_;
+    unsigned long long nextOrder_;
+    unsigned long long nextTicket_;
+    long long processedEvents_;
+    bool syncing_;                      ///< Set while the calendar itself advances plants
+    std::unordered_map<Plant*, Entry> entries_;
+    std::priority_queue<Event, std::vector<Event>, LaterEvent> calendar_;
+    std::vector<Plant*> dueBatch_;
+};
+
+#endif // SIMULATION_CALENDAR_H
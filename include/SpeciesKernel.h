@@ -0,0 +1,114 @@
+/**
+ * @file SpeciesKernel.h
+ * @brief Declares the per-species batch kernels for daily decay and care.
+ *
+ * Plant::dailyUpdate() and the CareStrategy methods fetch each species'
+ * constants through virtual calls, one plant at a time. A SpeciesKernel is
+ * stamped out for one SpeciesTraits struct, so its loops see the decay rates
+ * and care amounts as literals and work on the plant's fields directly.
+ */
+#ifndef SPECIES_KERNEL_H
+#define SPECIES_KERNEL_H
+
+#include <algorithm>
+#include <cstddef>
+
+#include "CareAction.h"
+#include "DirtyEpoch.h"
+#include "Plant.h"
+#include "SpeciesTraits.h"
+
+/**
+ * @class SpeciesKernel
+ * @brief Daily update and care loops for a batch of plants of one species.
+ *
+ * Every plant passed in must be of the species the traits describe; use
+ * dailyUpdateBatch() for a mixed batch.
+ *
+ * @tparam Traits One of the structs in SpeciesTraits.h
+ */
+template <typename Traits>
+class SpeciesKernel {
+public:
+    /**
+     * @brief Runs one day for every plant, with the same effect as Plant::dailyUpdate().
+     *
+     * Observers and the state handler still run per plant: both log, and the
+     * handler may replace the plant's state.
+     *
+     * @param plants Plants to update, all of this species
+     * @param count Number of plants
+     */
+    static void dailyUpdate(Plant* const* plants, size_t count) {
+        uint32_t epoch = DirtyEpoch::current();
+        for (size_t i = 0; i < count; i++) {
+            Plant* plant = plants[i];
+            plant->syncWithCalendar();
+            plant->dirtyEpoch = epoch;
+            plant->age++;
+            plant->waterLevel = clampLevel(plant->waterLevel - Traits::DAILY_WATER_LOSS);
+            plant->nutrientLevel = clampLevel(plant->nutrientLevel - Traits::DAILY_NUTRIENT_LOSS);
+            plant->healthLevel = (plant->waterLevel + plant->nutrientLevel + plant->sunlightExposure) / 3;
+
+            plant->notify();
+            if (plant->state != nullptr) {
+                plant->state->handleChange(plant);
+            }
+        }
+    }
+
+    /**
+     * @brief Applies one care action to every plant, without per-plant logging.
+     * @param action Care action to apply
+     * @param plants Plants to care for
+     * @param count Number of plants
+     */
+    static void care(CareAction action, Plant* const* plants, size_t count) {
+        uint32_t epoch = DirtyEpoch::current();
+        for (size_t i = 0; i < count; i++) {
+            // Calendar-tracked plants catch up first, as the Plant setters do
+            plants[i]->syncWithCalendar();
+            plants[i]->dirtyEpoch = epoch;
+        }
+        switch (action) {
+            case CareAction::Water:
+                for (size_t i = 0; i < count; i++) {
+                    plants[i]->waterLevel = clampLevel(plants[i]->waterLevel + Traits::WATER_GAIN);
+                }
+                break;
+            case CareAction::Fertilize:
+                for (size_t i = 0; i < count; i++) {
+                    plants[i]->nutrientLevel = clampLevel(plants[i]->nutrientLevel + Traits::NUTRIENT_GAIN);
+                }
+                break;
+            case CareAction::AdjustSunlight:
+                for (size_t i = 0; i < count; i++) {
+                    plants[i]->sunlightExposure = clampLevel(Traits::SUNLIGHT_TARGET);
+                }
+                break;
+        }
+    }
+
+private:
+    /**
+     * @brief Clamps a vital to [0, 100], as the Plant setters do.
+     */
+    static int clampLevel(int level) {
+        return std::min(100, std::max(0, level));
+    }
+};
+
+/**
+ * @brief Runs one day for a batch of plants of any species.
+ *
+ * Consecutive plants of the same species go through that species' kernel;
+ * Custom plants go through their own dailyUpdate(). Plants are still updated
+ * in the order given, so observers and state changes fire in the same order
+ * as a plain dailyUpdate() loop.
+ *
+ * @param plants Plants to update
+ * @param count Number of plants
+ */
+void dailyUpdateBatch(Plant* const* plants, size_t count);
+
+#endif // SPECIES_KERNEL_H
@@ -0,0 +1,132 @@
+/**
+ * @file SpeciesTraits.h
+ * @brief Declares the compile-time traits table that describes each plant species.
+ *
+ * Every constant that used to be repeated across a species class, its care
+ * strategy and the observers lives here once: how fast the species dries out
+ * and uses up nutrients, what it sells for, how much one round of care
+ * restores, and the levels at which care is needed. The species classes and
+ * strategies read from this table, and SpeciesKernel specialises its batch
+ * loops on it.
+ */
+#ifndef SPECIES_TRAITS_H
+#define SPECIES_TRAITS_H
+
+/**
+ * @enum PlantSpecies
+ * @brief Species a plant's daily decay is taken from.
+ *
+ * Custom marks plants whose behaviour is not described by a traits struct,
+ * such as decorators and test doubles; they are always updated through
+ * Plant::dailyUpdate().
+ */
+enum class PlantSpecies : unsigned char {
+    Custom,
+    Flower,
+    Succulent,
+    Vegetable,
+    Other
+};
+
+/**
+ * @struct PlantTraits
+ * @brief Values shared by every species unless a species overrides them.
+ */
+struct PlantTraits {
+    static constexpr PlantSpecies SPECIES = PlantSpecies::Custom;
+
+    static constexpr int DAILY_WATER_LOSS = 10;     ///< Water lost per dailyUpdate()
+    static constexpr int DAILY_NUTRIENT_LOSS = 5;   ///< Nutrients lost per dailyUpdate()
+    static constexpr double BASE_PRICE = 0.0;       ///< Price set when the plant is built
+
+    static constexpr int WATER_GAIN = 20;           ///< Water added by one watering
+    static constexpr int NUTRIENT_GAIN = 10;        ///< Nutrients added by one feeding
+    static constexpr int SUNLIGHT_TARGET = 60;      ///< Exposure set by a sunlight adjustment
+
+    static constexpr int LOW_WATER = 30;            ///< Water below this needs watering
+    static constexpr int LOW_NUTRIENTS = 30;        ///< Nutrients below this need feeding
+    static constexpr int LOW_SUNLIGHT = 40;         ///< Exposure below this needs adjusting
+};
+
+/**
+ * @struct FlowerTraits
+ * @brief Flowers dry out and feed fastest while blooming.
+ */
+struct FlowerTraits : PlantTraits {
+    static constexpr PlantSpecies SPECIES = PlantSpecies::Flower;
+
+    static constexpr int DAILY_WATER_LOSS = 15;
+    static constexpr int DAILY_NUTRIENT_LOSS = 8;
+    static constexpr double BASE_PRICE = 25.0;
+
+    static constexpr int WATER_GAIN = 50;
+    static constexpr int NUTRIENT_GAIN = 20;
+    static constexpr int SUNLIGHT_TARGET = 70;
+};
+
+/**
+ * @struct SucculentTraits
+ * @brief Succulents hold water and want the most sun.
+ */
+struct SucculentTraits : PlantTraits {
+    static constexpr PlantSpecies SPECIES = PlantSpecies::Succulent;
+
+    static constexpr int DAILY_WATER_LOSS = 5;
+    static constexpr int DAILY_NUTRIENT_LOSS = 5;
+    static constexpr double BASE_PRICE = 15.0;
+
+    static constexpr int WATER_GAIN = 15;
+    static constexpr int NUTRIENT_GAIN = 10;
+    static constexpr int SUNLIGHT_TARGET = 85;
+};
+
+/**
+ * @struct VegetableTraits
+ * @brief Vegetables are heavy drinkers and feeders.
+ */
+struct VegetableTraits : PlantTraits {
+    static constexpr PlantSpecies SPECIES = PlantSpecies::Vegetable;
+
+    static constexpr int DAILY_WATER_LOSS = 12;
+    static constexpr int DAILY_NUTRIENT_LOSS = 10;
+    static constexpr double BASE_PRICE = 12.0;
+
+    static constexpr int WATER_GAIN = 100;
+    static constexpr int NUTRIENT_GAIN = 25;
+    static constexpr int SUNLIGHT_TARGET = 75;
+};
+
+/**
+ * @struct OtherPlantTraits
+ * @brief Everything else decays at the standard rate and gets standard care.
+ */
+struct OtherPlantTraits : PlantTraits {
+    static constexpr PlantSpecies SPECIES = PlantSpecies::Other;
+
+    static constexpr double BASE_PRICE = 20.0;
+};
+
+/**
+ * @struct LifecycleTraits
+ * @brief Ages and health levels at which plants move between lifecycle stages.
+ *
+ * The states apply these one day at a time; Plant::daysUntilStateChange()
+ * and Plant::fastForward() solve them for whole spans of days, which is how
+ * SimulationCalendar schedules plants.
+ */
+struct LifecycleTraits {
+    static constexpr int SEEDLING_GROWS_AT_AGE = 7;     ///< Seedling -> Growing
+    static constexpr int GROWING_MATURES_AT_AGE = 12;   ///< Growing -> Mature
+    static constexpr int MATURE_FLOWERS_AT_AGE = 35;    ///< Mature -> Flowering
+    static constexpr int FLOWERING_ENDS_AT_AGE = 50;    ///< Flowering -> Mature
+
+    static constexpr int YOUNG_DIES_BELOW = 20;         ///< Seedlings and growing plants die under this health
+    static constexpr int ADULT_DIES_BELOW = 10;         ///< Mature and flowering plants die under this health
+    static constexpr int GROWS_AT_HEALTH = 50;          ///< Health needed to leave Seedling or Growing
+    static constexpr int FLOWERS_AT_HEALTH = 80;        ///< Health needed to start Flowering
+
+    static constexpr double BLOOM_PRICE_MULTIPLIER = 1.5; ///< Daily price rise while Flowering
+    static constexpr double BLOOM_PRICE_CAP = 15.0;       ///< Prices at or above this stop rising
+};
+
+#endif // SPECIES_TRAITS_H
@@ -36,17 +36,24 @@ public:
      */
     virtual ~Succulent();
 
-    /**
-     * @brief Performs daily update operations specific to succulents.
-     * Overrides the base Plant class implementation.
-     */
-    void dailyUpdate() override;
-
     /**
      * @brief Converts succulent information to a string representation.
      * @return String containing succulent-specific details.
      */
     std::string toString() const override;
+
+protected:
+    /**
+     * @brief Gets the water succulents lose each day.
+     * @return Water lost per dailyUpdate().
+     */
+    int getDailyWaterLoss() const override;
+
+    /**
+     * @brief Gets the nutrients succulents consume each day.
+     * @return Nutrients lost per dailyUpdate().
+     */
+    int getDailyNutrientLoss() const override;
 };
 
 #endif
\ No newline at end of file
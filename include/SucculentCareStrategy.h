@@ -13,6 +13,16 @@
 class SucculentCareStrategy : public CareStrategy {
     public:
 
+        /**
+         * @brief Returns the shared instance used by all succulents
+         *
+         * The strategy holds no per-plant state, so every plant of this kind
+         * references the same object instead of owning its own copy.
+         *
+         * @return Pointer to the shared strategy (never deleted by plants)
+         */
+        static SucculentCareStrategy* getInstance();
+
         /**
          * @brief Waters succulents with minimal moisture
          * 
@@ -53,6 +63,14 @@ class SucculentCareStrategy : public CareStrategy {
          * @param plant Pointer to the succulent plant to be pruned
          */
         void prune(Plant* plant) override;
+
+        /**
+         * @brief Applies one care action to a batch of plants through SpeciesKernel<SucculentTraits>
+         * @param action Care action to apply
+         * @param plants Plants to care for
+         * @param count Number of plants
+         */
+        void careForBatch(CareAction action, Plant* const* plants, size_t count) override;
 };
 
 #endif
\ No newline at end of file
@@ -52,6 +52,14 @@ public:
      * @param plant Pointer to the Plant object that triggered the notification.
      */
     virtual void update(Plant* plant) override;
+
+    /**
+     * @brief Checks a batch of plants' sunlight levels in one pass.
+     * 
+     * @param plants Plants that changed during a NotificationBatch.
+     * @param count Number of plants.
+     */
+    virtual void updateBatch(Plant* const* plants, size_t count) override;
 };
 
 #endif // SUNLIGHT_OBSERVER_H
@@ -0,0 +1,149 @@
+/**
+ * @file ThresholdMonitor.h
+ * @brief Declares the ThresholdMonitor class for batch, edge-triggered vital monitoring.
+ *
+ * The ThresholdMonitor is the batch counterpart of the per-plant observers.
+ * Instead of every plant calling WaterObserver, FertilizeObserver and
+ * SunlightObserver on each notify(), thresholds are registered once as data
+ * (vital, comparator, level, action). After a simulation tick the monitor
+ * scans all plants together and schedules a command only when a plant
+ * crosses into a threshold's zone, never while it stays there.
+ */
+#ifndef THRESHOLD_MONITOR_H
+#define THRESHOLD_MONITOR_H
+
+#include <vector>
+
+#include "CareAction.h"
+
+class CareScheduler;
+class Plant;
+class PlantGridView;
+
+/**
+ * @enum PlantVital
+ * @brief Plant readings a threshold can be declared on.
+ */
+enum class PlantVital {
+    Water,      ///< Plant::getWaterLevel()
+    Nutrients,  ///< Plant::getNutrientLevel()
+    Sunlight,   ///< Plant::getSunlightExposure()
+    Health      ///< Plant::getHealthLevel()
+};
+
+/**
+ * @enum ThresholdComparator
+ * @brief How a vital is compared against the threshold level.
+ */
+enum class ThresholdComparator {
+    Below,      ///< vital <  level
+    AtOrBelow,  ///< vital <= level
+    Above,      ///< vital >  level
+    AtOrAbove   ///< vital >= level
+};
+
+/**
+ * @struct ThresholdRule
+ * @brief Declarative description of one watched threshold.
+ */
+struct ThresholdRule {
+    PlantVital vital;                 ///< Reading being watched
+    ThresholdComparator comparator;   ///< Comparison applied to the reading
+    int level;                        ///< Level the reading is compared against
+    CareAction action;                ///< Care command scheduled on entering the zone
+};
+
+/**
+ * @class ThresholdMonitor
+ * @brief Scans batches of plants and schedules care on threshold edges.
+ *
+ * Each rule owns one bit of the plant's threshold mask, which records whether
+ * the plant was inside the rule's zone after the previous scan. A scan gathers
+ * the vitals of all plants into contiguous arrays, evaluates every rule over
+ * the whole batch with SIMD compares (SSE2 where available, a scalar loop
+ * otherwise), and fires only on bits that went from 0 to 1.
+ */
+class ThresholdMonitor {
+public:
+    /**
+     * @brief Maximum number of rules, one per bit of the plant's threshold mask.
+     */
+    static constexpr int MAX_RULES = 8;
+
+    /**
+     * @brief Constructs a monitor that schedules commands on the given scheduler.
+     * @param scheduler Pointer to the CareScheduler receiving commands. Not owned.
+     */
+    explicit ThresholdMonitor(CareScheduler* scheduler);
+
+    /**
+     * @brief Registers a threshold.
+     * @param vital Reading to watch.
+     * @param comparator Comparison applied to the reading.
+     * @param level Level to compare against.
+     * @param action Care action scheduled when a plant enters the zone.
+     * @return Index of the new rule, or -1 if MAX_RULES are already registered.
+     */
+    int addThreshold(PlantVital vital, ThresholdComparator comparator, int level, CareAction action);
+
+    /**
+     * @brief Registers the thresholds used by the standard observers.
+     *
+     * Water below 30, nutrients below 30 and sunlight below 40, matching
+     * WaterObserver, FertilizeObserver and SunlightObserver.
+     */
+    void addStandardThresholds();
+
+    /**
+     * @brief Gets the registered rules.
+     * @return Vector of rules in registration order.
+     */
+    const std::vector<ThresholdRule>& getRules() const;
+
+    /**
+     * @brief Evaluates every rule over a batch of plants and fires on rising edges.
+     *
+     * Updates each plant's threshold mask and queues one command on the
+     * scheduler for every rule a plant has just entered. Null entries are skipped.
+     *
+     * @param plants Plants to scan.
+     * @return Number of commands scheduled.
+     */
+    int scan(const std::vector<Plant*>& plants);
+
+    /**
+     * @brief Scans the plants in a grid view without the caller building a vector.
+     * @param plants View over a Greenhouse or SalesFloor grid.
+     * @return Number of commands scheduled.
+     */
+    int scan(const PlantGridView& plants);
+
+    /**
+     * @brief Finds the next day on which a plant's zones would differ from its threshold mask.
+     *
+     * Vitals only decay between care actions, so each rule's zone can change
+     * at most once; the day is found by binary search over the projected vitals.
+     *
+     * @param plant Plant to look ahead for.
+     * @param horizon Last day to consider.
+     * @return Number of days until a scan would change the mask, or horizon + 1 if none.
+     */
+    int daysUntilZoneChange(const Plant* plant, int horizon) const;
+
+private:
+    /**
+     * @brief Runs the rules over the plants already gathered into batch_.
+     */
+    int scanBatch();
+
+    CareScheduler* scheduler_;
+    std::vector<ThresholdRule> rules_;
+
+    // Scratch buffers reused between scans to avoid per-tick allocation
+    std::vector<Plant*> batch_;
+    std::vector<int> vitals_[4];
+    std::vector<int> zoneMasks_;
+    std::vector<int> previousMasks_;
+};
+
+#endif // THRESHOLD_MONITOR_H
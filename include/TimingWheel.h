@@ -0,0 +1,157 @@
+/**
+ * @file TimingWheel.h
+ * @brief Declares TimingWheel, the day-keyed hierarchical timer used by CareScheduler for delayed and recurring commands.
+ *
+ * Tasks are filed in one of several wheels of 64 slots. The first wheel
+ * holds tasks due within the next 64 days, one slot per day; each further
+ * wheel covers 64 times the span of the one below it. When the first wheel
+ * wraps, the next slot of the wheel above is emptied and its tasks are filed
+ * again closer to their day. Scheduling and cancelling are O(1), and a tick
+ * only touches the tasks due that day (plus, once every 64 days, the tasks
+ * moving down a wheel), no matter how many tasks are pending.
+ */
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#include <cstdint>
+#include <vector>
+
+class Command;
+
+/**
+ * @class TimingWheel
+ * @brief Hierarchical timing wheel of one-shot and recurring commands keyed on simulated day.
+ *
+ * The wheel owns its commands. One-shot commands are deleted after they run;
+ * recurring commands are deleted when cancelled or when the wheel is destroyed.
+ * Tasks due on the same day run in no guaranteed order.
+ */
+class TimingWheel {
+public:
+    /**
+     * @brief Identifies a scheduled task. 0 is never a valid id.
+     */
+    using TaskId = std::uint64_t;
+
+    static constexpr int SLOT_BITS = 6;                 ///< log2 of the slots per wheel
+    static constexpr int SLOTS = 1 << SLOT_BITS;        ///< Slots per wheel
+    static constexpr int LEVELS = 4;                    ///< Wheels; tasks beyond 64^4 days wait in an overflow list
+
+    /**
+     * @brief Constructs an empty wheel at day 0.
+     */
+    TimingWheel();
+
+    /**
+     * @brief Destructor. Deletes every pending command.
+     */
+    ~TimingWheel();
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    /**
+     * @brief Schedules a command to run once on a given day.
+     * @param cmd Command to run. Ownership is transferred.
+     * @param day Day to run on. Days not after the current day run on the next tick.
+     * @return Id of the task, or 0 if cmd is nullptr.
+     */
+    TaskId scheduleAt(Command* cmd, long long day);
+
+    /**
+     * @brief Schedules a command to run every intervalDays days.
+     * @param cmd Command to run. Ownership is transferred.
+     * @param firstDay Day of the first run. Days not after the current day run on the next tick.
+     * @param intervalDays Days between runs; values below 1 are treated as 1.
+     * @return Id of the task, or 0 if cmd is nullptr.
+     */
+    TaskId scheduleEvery(Command* cmd, long long firstDay, int intervalDays);
+
+    /**
+     * @brief Cancels a pending task and deletes its command.
+     *
+     * A recurring task may cancel itself from inside its own execute(); it is
+     * deleted once execute() returns.
+     *
+     * @param id Task to cancel.
+     * @return true if the task was pending (or running) and is now cancelled.
+     */
+    bool cancel(TaskId id);
+
+    /**
+     * @brief Checks whether a task is still scheduled.
+     * @param id Task to look up.
+     * @return true if the task will run again.
+     */
+    bool isScheduled(TaskId id) const;
+
+    /**
+     * @brief Advances one day and runs every task due on it.
+     * @return Number of commands executed.
+     */
+    int tick();
+
+    /**
+     * @brief Advances several days, running each day's tasks in turn.
+     *
+     * Stretches with nothing pending are skipped without visiting each day.
+     *
+     * @param days Days to advance. Non-positive values do nothing.
+     * @return Number of commands executed.
+     */
+    int advance(long long days);
+
+    /**
+     * @brief Gets the current simulated day.
+     * @return Days ticked since construction.
+     */
+    long long getCurrentDay() const;
+
+    /**
+     * @brief Gets the number of scheduled tasks.
+     * @return One-shot plus recurring tasks still waiting to run.
+     */
+    int getPendingCount() const;
+
+private:
+    enum class NodeState { Free, Pending, Running, Cancelled };
+
+    /**
+     * @brief Pool entry; also used as the sentinel of each slot's circular list.
+     */
+    struct Node {
+        Command* command;
+        long long dueDay;
+        int interval;           ///< 0 for one-shot tasks
+        std::uint32_t generation;
+        int list;               ///< Slot the node was last filed in, or -1
+        int prev;
+        int next;
+        NodeState state;
+    };
+
+    static constexpr int OVERFLOW_LIST = LEVELS * SLOTS;    ///< Sentinel index of the overflow list
+    static constexpr int FIRING_LIST = OVERFLOW_LIST + 1;   ///< Sentinel index of the tasks running this tick
+    static constexpr int SENTINELS = FIRING_LIST + 1;
+
+    TaskId schedule(Command* cmd, long long day, int interval);
+    int allocateNode();
+    void releaseNode(int index);
+    void file(int index);
+    void linkBack(int list, int index);
+    void unlink(int index);
+    void moveAll(int fromList, int toList);
+    void cascade(long long day);
+    int fire();
+    long long nextBusyDay() const;
+    bool lookUp(TaskId id, int& index) const;
+    TaskId makeId(int index) const;
+
+    std::vector<Node> nodes_;
+    std::vector<int> freeNodes_;
+    std::vector<std::uint64_t> occupied_;   ///< One bit per slot, one word per wheel
+    long long currentDay_;
+    int pendingCount_;
+};
+
+#endif // TIMING_WHEEL_H
@@ -0,0 +1,272 @@
+/**
+ * @file TransactionJournal.h
+ * @brief Declares TransactionJournal, the append-only write-ahead log of sales, moves and care.
+ *
+ * New stock, payments, plant transfers, relocations, returns, care actions and
+ * discarded dead plants append a fixed-size JournalRecord here. Records are buffered and written in groups:
+ * one write and one fdatasync make every record in the group durable, so the
+ * cost of the sync is shared by all the transactions that arrived while the
+ * previous group was being written. JournalReplay reads a journal back.
+ *
+ * The journal is off until open() is called; while it is closed every
+ * record call returns after one atomic load. The front ends only open one
+ * when the NURSERY_JOURNAL environment variable names the file to keep.
+ */
+#ifndef TRANSACTION_JOURNAL_H
+#define TRANSACTION_JOURNAL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CareAction.h"
+
+class Plant;
+
+/**
+ * @enum JournalRecordType
+ * @brief What a journal record describes.
+ */
+enum class JournalRecordType : uint8_t {
+    Sale,           ///< PaymentProcessor charged for a finished order; party is the customer
+    Payment,        ///< A customer's budget was debited
+    Transfer,       ///< A plant went into a customer's cart; detail is where it came from
+    Relocation,     ///< A plant moved from the greenhouse to the sales floor at (row, col)
+    Return,         ///< A plant was put back on the sales floor at (row, col)
+    Care,           ///< A care action was performed; detail is the CareAction
+    Addition,       ///< A plant was stocked at (row, col); detail is the JournalLocation it went into
+    Discard         ///< A dead plant was thrown out of the greenhouse
+};
+
+/**
+ * @enum JournalLocation
+ * @brief Where a plant is, as far as the journal can tell.
+ */
+enum class JournalLocation : uint8_t {
+    Greenhouse,
+    SalesFloor,
+    Cart,
+    Sold,           ///< Only produced by replay, when the cart holding the plant is paid for
+    Unknown
+};
+
+/**
+ * @brief Number of JournalLocation values, for tables indexed by location.
+ */
+constexpr int JOURNAL_LOCATION_COUNT = 5;
+
+/**
+ * @struct JournalRecord
+ * @brief One journal entry, written as-is (native byte order).
+ */
+struct JournalRecord {
+    static constexpr size_t TEXT_SIZE = 32;
+
+    uint64_t sequence;      ///< Position in the journal, from 0
+    uint8_t type;           ///< JournalRecordType
+    uint8_t detail;         ///< Source JournalLocation for transfers, destination for additions, CareAction for care
+    uint8_t version;        ///< TransactionJournal::VERSION
+    uint8_t reserved;
+    int32_t row;            ///< Grid row, or -1
+    int32_t col;            ///< Grid column, or -1
+    uint32_t checksum;      ///< TransactionJournal::checksum() of the other fields
+    double amount;          ///< Rand value of sales and payments
+    char plantId[TEXT_SIZE];    ///< Null-terminated, truncated to fit
+    char party[TEXT_SIZE];      ///< Customer name, null-terminated, truncated to fit
+};
+
+/**
+ * @class TransactionJournal
+ * @brief Process-wide write-ahead journal with group commit (Singleton).
+ *
+ * Records may be appended from any thread, including the care scheduler's
+ * workers. A group is written when groupSize records are waiting or when
+ * someone calls commit(); records are durable once commit() returns true.
+ * While one thread writes a group, others keep appending to the next one,
+ * and a commit() that arrives meanwhile waits for that write instead of
+ * starting its own sync.
+ *
+ * Checkouts are the commit points: a finished order commits once, making its
+ * transfers, sale and payment durable together. Relocations, returns and care
+ * ride along with the next checkout or the next full group.
+ */
+class TransactionJournal {
+public:
+    static constexpr uint8_t VERSION = 1;
+    static constexpr size_t DEFAULT_GROUP_SIZE = 256;
+
+    /**
+     * @brief Environment variable holding the journal path the front ends open; unset leaves the journal off.
+     */
+    static constexpr const char* PATH_VARIABLE = "NURSERY_JOURNAL";
+
+    /**
+     * @brief Gets the process-wide journal.
+     * @return Pointer to the single instance.
+     */
+    static TransactionJournal* getInstance();
+
+    /**
+     * @brief Starts journaling to a file, appending to any records already in it.
+     *
+     * A torn record at the end of the file, left by a crash during a write,
+     * is cut off first. Closes any journal already open.
+     *
+     * @param path Journal file to create or extend.
+     * @param groupSize Records to collect before writing a group; 1 syncs every record.
+     * @return true on success; see getError() otherwise.
+     */
+    bool open(const std::string& path, size_t groupSize = DEFAULT_GROUP_SIZE);
+
+    /**
+     * @brief Commits every waiting record and stops journaling.
+     */
+    void close();
+
+    /**
+     * @brief Checks whether records are being kept.
+     * @return true between a successful open() and close().
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Writes and syncs every record appended so far.
+     * @return true once they are durable; false if the journal is closed or a write failed.
+     */
+    bool commit();
+
+    /**
+     * @brief Records a new plant being stocked.
+     * @param plant Plant added.
+     * @param where JournalLocation::Greenhouse or JournalLocation::SalesFloor.
+     * @param row Row it was placed in.
+     * @param col Column it was placed in.
+     */
+    void recordAddition(const Plant* plant, JournalLocation where, int row, int col);
+
+    /**
+     * @brief Records a dead plant being thrown out.
+     * @param plant Plant discarded; only its ID is read.
+     */
+    void recordDiscard(const Plant* plant);
+
+    /**
+     * @brief Records a finished order being charged.
+     * @param customer Customer the order was placed for.
+     * @param amount Order total.
+     */
+    void recordSale(const std::string& customer, double amount);
+
+    /**
+     * @brief Records a customer's budget being debited.
+     * @param customer Customer who paid.
+     * @param amount Amount deducted.
+     */
+    void recordPayment(const std::string& customer, double amount);
+
+    /**
+     * @brief Records a plant going into a customer's cart.
+     * @param plant Plant moved.
+     * @param customer Customer whose cart it went into.
+     * @param from Where it was taken from.
+     * @param row Row it was taken from, or -1.
+     * @param col Column it was taken from, or -1.
+     */
+    void recordTransfer(const Plant* plant, const std::string& customer, JournalLocation from,
+                        int row = -1, int col = -1);
+
+    /**
+     * @brief Records a plant moving from the greenhouse to the sales floor.
+     * @param plant Plant moved.
+     * @param row Sales-floor row.
+     * @param col Sales-floor column.
+     */
+    void recordRelocation(const Plant* plant, int row, int col);
+
+    /**
+     * @brief Records a plant being put back on the sales floor.
+     * @param plant Plant returned.
+     * @param row Sales-floor row.
+     * @param col Sales-floor column.
+     */
+    void recordReturn(const Plant* plant, int row, int col);
+
+    /**
+     * @brief Records a care action being performed on a plant.
+     * @param plant Plant cared for.
+     * @param action Care performed.
+     */
+    void recordCare(const Plant* plant, CareAction action);
+
+    /**
+     * @brief Gets the number of records appended since open().
+     * @return Appended record count.
+     */
+    uint64_t getAppendedCount() const;
+
+    /**
+     * @brief Gets the number of groups written and synced since open().
+     * @return Sync count.
+     */
+    uint64_t getSyncCount() const;
+
+    /**
+     * @brief Gets the reason the last open or write failed.
+     * @return Error message, or an empty string.
+     */
+    std::string getError() const;
+
+    /**
+     * @brief Computes the checksum stored in a record.
+     * @param record Record to check; its checksum field is ignored.
+     * @return FNV-1a hash of the other fields.
+     */
+    static uint32_t checksum(const JournalRecord& record);
+
+private:
+    TransactionJournal();
+    ~TransactionJournal();
+    TransactionJournal(const TransactionJournal&) = delete;
+    TransactionJournal& operator=(const TransactionJournal&) = delete;
+
+    /**
+     * @brief Fills the common fields of a record.
+     */
+    static JournalRecord makeRecord(JournalRecordType type, const Plant* plant, const std::string& party);
+
+    /**
+     * @brief Numbers a record and adds it to the waiting group, writing the group if it is full.
+     */
+    void append(JournalRecord& record);
+
+    /**
+     * @brief Writes and syncs the waiting group with the lock released; lock must be held on entry.
+     * @return false if the write failed, in which case the journal is closed.
+     */
+    bool flushGroup(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * @brief Closes the file; the lock must be held.
+     */
+    void closeFile();
+
+    mutable std::mutex mutex_;
+    std::condition_variable flushed_;
+    std::atomic<bool> open_;
+    int fd_;
+    size_t groupSize_;
+    bool flushing_;                     ///< A group is being written with the lock released
+    std::vector<JournalRecord> pending_;
+    std::vector<JournalRecord> writing_;
+    uint64_t nextSequence_;
+    uint64_t durableSequence_;          ///< Every record before this one is on disk
+    uint64_t appended_;
+    uint64_t syncs_;
+    std::string error_;
+};
+
+#endif // TRANSACTION_JOURNAL_H
@@ -36,17 +36,24 @@ public:
      */
     virtual ~Vegetable();
 
-    /**
-     * @brief Performs daily update operations specific to vegetables.
-     * Overrides the base Plant class implementation.
-     */
-    void dailyUpdate() override;
-
     /**
      * @brief Converts vegetable information to a string representation.
      * @return String containing vegetable-specific details.
      */
     std::string toString() const override;
+
+protected:
+    /**
+     * @brief Gets the water vegetables lose each day.
+     * @return Water lost per dailyUpdate().
+     */
+    int getDailyWaterLoss() const override;
+
+    /**
+     * @brief Gets the nutrients vegetables consume each day.
+     * @return Nutrients lost per dailyUpdate().
+     */
+    int getDailyNutrientLoss() const override;
 };
 
 #endif
\ No newline at end of file
@@ -12,6 +12,16 @@
 class VegetableCareStrategy : public CareStrategy {
 public:
 
+    /**
+     * @brief Returns the shared instance used by all vegetables
+     *
+     * The strategy holds no per-plant state, so every plant of this kind
+     * references the same object instead of owning its own copy.
+     *
+     * @return Pointer to the shared strategy (never deleted by plants)
+     */
+    static VegetableCareStrategy* getInstance();
+
     /**
      * @brief Waters vegetable plants on regular schedule
      * 
@@ -52,6 +62,14 @@ public:
      * @param plant Pointer to the vegetable plant to be pruned
      */
     void prune(Plant* plant) override;
+
+    /**
+     * @brief Applies one care action to a batch of plants through SpeciesKernel<VegetableTraits>
+     * @param action Care action to apply
+     * @param plants Plants to care for
+     * @param count Number of plants
+     */
+    void careForBatch(CareAction action, Plant* const* plants, size_t count) override;
 };
 
 #endif
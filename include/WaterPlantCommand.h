@@ -45,6 +45,19 @@ public:
      */
     virtual void execute();
 
+    /**
+     * @brief Gets the plant this command acts on.
+     * @return The target plant (may be nullptr).
+     */
+    virtual Plant* getTarget() const;
+
+    /**
+     * @brief Reports CareAction::Water so the scheduler can batch this command.
+     * @param action Set to CareAction::Water.
+     * @return Always true.
+     */
+    virtual bool getCareAction(CareAction& action) const;
+
 private:
     Plant* target_; ///< Pointer to the target plant (not owned by this command)
 };
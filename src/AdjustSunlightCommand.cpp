@@ -1,6 +1,7 @@
 #include "include/AdjustSunlightCommand.h"
 #include "include/Plant.h"
 #include "include/CareStrategy.h"
+#include "include/TransactionJournal.h"
 #include <iostream>
 
 AdjustSunlightCommand::AdjustSunlightCommand(Plant* target) 
@@ -10,6 +11,15 @@ AdjustSunlightCommand::AdjustSunlightCommand(Plant* target)
 void AdjustSunlightCommand::execute() {
     if (target_ != nullptr && target_->getStrategy() != nullptr) {
         target_->getStrategy()->adjustSunlight(target_);
+        TransactionJournal::getInstance()->recordCare(target_, CareAction::AdjustSunlight);
     }
 }
 
+Plant* AdjustSunlightCommand::getTarget() const {
+    return target_;
+}
+
+bool AdjustSunlightCommand::getCareAction(CareAction& action) const {
+    action = CareAction::AdjustSunlight;
+    return true;
+}
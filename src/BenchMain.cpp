@@ -0,0 +1,1380 @@
+/**
+ * @file BenchMain.cpp
+ * @brief Stand-alone benchmark and footprint report for the nursery backend.
+ *
+ * Builds large numbers of plants through the real factories and reports
+ * object sizes, heap allocations and timings. Console chatter from the
+ * backend is silenced while measuring so that I/O does not skew results.
+ *
+ * Run with: make bench
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "include/Plant.h"
+#include "include/PlantFactory.h"
+#include "include/CareScheduler.h"
+#include "include/ThresholdMonitor.h"
+#include "include/SimulationCalendar.h"
+#include "include/NotificationBatch.h"
+#include "include/SpeciesKernel.h"
+#include "include/NurserySnapshot.h"
+#include "include/NurseryCheckpoint.h"
+#include "include/TransactionJournal.h"
+#include "include/JournalReplay.h"
+#include "include/InventoryImporter.h"
+#include "include/SalesLedger.h"
+#include "include/OrderHistory.h"
+#include "include/FinalOrder.h"
+#include "include/ConcreteOrder.h"
+#include "include/Leaf.h"
+#include "include/RibbonDecorator.h"
+#include "include/SalesFloor.h"
+#include "include/Greenhouse.h"
+#include "include/RegionCareCommand.h"
+#include "include/WaterPlantCommand.h"
+#include "include/CareAction.h"
+#include "include/Command.h"
+#include "include/RoseFactory.h"
+#include "include/CactusFactory.h"
+#include "include/PotatoFactory.h"
+#include "include/MonsteraFactory.h"
+
+// ============================================================================
+// Allocation counting
+// ============================================================================
+
+// Every replaceable form of new and delete is defined, so no allocation
+// bypasses the counters and every delete matches the allocator it frees.
+// The counters are atomic because some sections run worker threads.
+
+static std::atomic<size_t> g_allocCount{0};
+static std::atomic<size_t> g_allocBytes{0};
+
+/**
+ * @brief Counts and performs one allocation.
+ * @param size Bytes requested
+ * @param alignment Required alignment, or 0 for the default
+ * @return The block, or nullptr when out of memory
+ */
+static void* countedAlloc(std::size_t size, std::size_t alignment) {
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    g_allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (size == 0) {
+        size = 1;
+    }
+    if (alignment <= alignof(std::max_align_t)) {
+        return std::malloc(size);
+    }
+    // aligned_alloc wants the size to be a multiple of the alignment
+    return std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+}
+
+static void* countedAllocOrThrow(std::size_t size, std::size_t alignment) {
+    void* p = countedAlloc(size, alignment);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void* operator new(std::size_t size) {
+    return countedAllocOrThrow(size, 0);
+}
+
+void* operator new[](std::size_t size) {
+    return countedAllocOrThrow(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return countedAllocOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    return countedAllocOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, 0);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return countedAlloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    std::free(p);
+}
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+/**
+ * @brief Stream buffer that discards everything written to it.
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+/**
+ * @brief Silences std::cout for the lifetime of the object.
+ */
+class QuietScope {
+public:
+    QuietScope() : saved(std::cout.rdbuf(&sink)) {}
+    ~QuietScope() { std::cout.rdbuf(saved); }
+
+private:
+    NullBuffer sink;
+    std::streambuf* saved;
+};
+
+struct AllocSnapshot {
+    size_t count;
+    size_t bytes;
+};
+
+static AllocSnapshot takeSnapshot() {
+    return AllocSnapshot{g_allocCount.load(), g_allocBytes.load()};
+}
+
+static void printRow(const std::string& label, double value, const std::string& unit) {
+    std::cout << "  " << std::left << std::setw(38) << label
+              << std::right << std::setw(12) << std::fixed << std::setprecision(2)
+              << value << " " << unit << "\n";
+}
+
+static void printHeader(const std::string& title) {
+    std::cout << "\n========================================\n";
+    std::cout << "  " << title << "\n";
+    std::cout << "========================================\n";
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+
+/**
+ * @brief Reports object sizes and per-plant heap cost of factory-built plants.
+ * @param plantCount Number of plants to build per scenario
+ */
+static void benchMemoryFootprint(int plantCount) {
+    printHeader("MEMORY FOOTPRINT");
+
+    printRow("sizeof(Plant)", sizeof(Plant), "bytes");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    for (int withScheduler = 0; withScheduler < 2; withScheduler++) {
+        std::vector<Plant*> plants;
+        plants.reserve(plantCount);
+
+        CareScheduler* scheduler = nullptr;
+        AllocSnapshot before;
+        AllocSnapshot after;
+        {
+            QuietScope quiet;
+            scheduler = withScheduler ? new CareScheduler() : nullptr;
+            before = takeSnapshot();
+            for (int i = 0; i < plantCount; i++) {
+                plants.push_back(factories[i % factories.size()]->buildPlant(scheduler));
+            }
+            after = takeSnapshot();
+        }
+
+        std::string suffix = withScheduler ? " (with scheduler)" : " (no scheduler)";
+        printRow("allocations per plant" + suffix,
+                 double(after.count - before.count) / plantCount, "allocs");
+        printRow("heap bytes per plant" + suffix,
+                 double(after.bytes - before.bytes) / plantCount, "bytes");
+
+        QuietScope quiet;
+        for (Plant* plant : plants) {
+            delete plant;
+        }
+        delete scheduler;
+    }
+}
+
+/**
+ * @brief Compares ageing plants day by day against the closed-form fast-forward.
+ * @param plantCount Number of plants to age per scenario
+ */
+static void benchFastForward(int plantCount) {
+    printHeader("SEEDING (AGE 0-54 DAYS)");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    for (int fastForward = 0; fastForward < 2; fastForward++) {
+        std::vector<Plant*> plants;
+        plants.reserve(plantCount);
+        double ms = 0.0;
+        {
+            QuietScope quiet;
+            for (int i = 0; i < plantCount; i++) {
+                plants.push_back(factories[i % factories.size()]->buildPlant(nullptr));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < plantCount; i++) {
+                int days = i % 55;
+                if (fastForward) {
+                    plants[i]->advanceDays(days);
+                } else {
+                    for (int day = 0; day < days; day++) {
+                        plants[i]->dailyUpdate();
+                    }
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+            for (Plant* plant : plants) {
+                delete plant;
+            }
+        }
+
+        printRow(fastForward ? "advanceDays()" : "dailyUpdate() loop", ms, "ms");
+    }
+}
+
+/**
+ * @brief Compares a year of day-by-day updates against the event-driven calendar.
+ * @param plantCount Number of plants in the simulated nursery
+ */
+static void benchSimulationCalendar(int plantCount) {
+    printHeader("ONE YEAR, ONE DAY AT A TIME (" + std::to_string(plantCount) + " plants)");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    for (int evented = 0; evented < 2; evented++) {
+        std::vector<Plant*> plants;
+        plants.reserve(plantCount);
+        double ms = 0.0;
+        int scheduled = 0;
+        long long events = 0;
+        {
+            QuietScope quiet;
+            CareScheduler scheduler;
+            ThresholdMonitor monitor(&scheduler);
+            monitor.addStandardThresholds();
+            SimulationCalendar calendar(&monitor);
+
+            for (int i = 0; i < plantCount; i++) {
+                Plant* plant = factories[i % factories.size()]->buildPlant(nullptr);
+                plant->advanceDays(i % 55);
+                plants.push_back(plant);
+                if (evented) {
+                    calendar.addPlant(plant);
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int day = 0; day < 365; day++) {
+                if (evented) {
+                    scheduled += calendar.advance(1);
+                } else {
+                    for (Plant* plant : plants) {
+                        plant->dailyUpdate();
+                    }
+                    scheduled += monitor.scan(plants);
+                }
+            }
+            calendar.materializeAll();
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+            events = evented ? calendar.getProcessedEventCount() : 365LL * plantCount;
+
+            for (Plant* plant : plants) {
+                delete plant;
+            }
+        }
+
+        std::string label = evented ? "SimulationCalendar" : "dailyUpdate() + scan()";
+        printRow(label, ms, "ms");
+        printRow(label + " plant updates", double(events), "");
+        printRow(label + " care tasks", scheduled, "");
+    }
+}
+
+/**
+ * @brief Compares dense and sparse storage for a huge greenhouse that is 10% occupied.
+ * @param plantCount Number of plants placed in the greenhouse
+ */
+static void benchSparseGreenhouse(int plantCount) {
+    int side = static_cast<int>(std::ceil(std::sqrt(plantCount * 10.0)));
+    printHeader("GREENHOUSE " + std::to_string(side) + "x" + std::to_string(side) +
+                " (" + std::to_string(plantCount) + " plants)");
+
+    RoseFactory roseFactory;
+
+    for (int sparse = 0; sparse < 2; sparse++) {
+        GridStorage storage = sparse ? GridStorage::Sparse : GridStorage::Dense;
+        double scanMs = 0.0;
+        size_t gridBytes = 0;
+        size_t found = 0;
+        {
+            QuietScope quiet;
+            AllocSnapshot before = takeSnapshot();
+            Greenhouse greenhouse(nullptr, side, side, storage);
+            gridBytes = takeSnapshot().bytes - before.bytes;
+
+            for (int i = 0; i < plantCount; i++) {
+                int cell = static_cast<int>((static_cast<long long>(i) * 7919) % (side * side));
+                while (!greenhouse.isPositionEmpty(cell / side, cell % side)) {
+                    cell = (cell + 1) % (side * side);
+                }
+                greenhouse.addPlant(roseFactory.buildPlant(nullptr), cell / side, cell % side);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int pass = 0; pass < 20; pass++) {
+                found += greenhouse.getAllPlants().size();
+                found += greenhouse.findPlant("Nonexistent") != nullptr;
+                found += greenhouse.getGrid().getColumn(pass).countPlants();
+            }
+            auto end = std::chrono::steady_clock::now();
+            scanMs = std::chrono::duration<double, std::milli>(end - start).count();
+        }
+
+        std::string label = sparse ? "Sparse" : "Dense";
+        printRow(label + " empty grid heap", double(gridBytes) / 1024.0, "KB");
+        printRow(label + " 20x scans", scanMs, "ms");
+        printRow(label + " plants seen", double(found), "");
+    }
+}
+
+/**
+ * @brief Compares irrigating a greenhouse with one command per plant against one region command.
+ * @param plantCount Number of plants in the greenhouse
+ */
+static void benchRegionCare(int plantCount) {
+    int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(plantCount))));
+    printHeader("IRRIGATE " + std::to_string(plantCount) + " PLANTS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    for (int regional = 0; regional < 2; regional++) {
+        double ms = 0.0;
+        size_t allocs = 0;
+        {
+            QuietScope quiet;
+            Greenhouse greenhouse(nullptr, side, side);
+            for (int i = 0; i < plantCount; i++) {
+                greenhouse.addPlant(factories[i % factories.size()]->buildPlant(nullptr), i / side, i % side);
+            }
+
+            CareScheduler scheduler;
+            AllocSnapshot before = takeSnapshot();
+            auto start = std::chrono::steady_clock::now();
+            if (regional) {
+                scheduler.addTask(new RegionCareCommand(&greenhouse, greenhouse.getGrid().getRowRange(0, side), CareAction::Water));
+            } else {
+                greenhouse.forEachPlant([&scheduler](Plant* plant, int, int) {
+                    scheduler.addTask(new WaterPlantCommand(plant));
+                });
+            }
+            scheduler.runAll();
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+            allocs = takeSnapshot().count - before.count;
+        }
+
+        std::string label = regional ? "RegionCareCommand" : "WaterPlantCommand each";
+        printRow(label, ms, "ms");
+        printRow(label + " allocations", double(allocs), "");
+    }
+}
+
+/**
+ * @brief Compares in-order and strategy-grouped execution of a mixed care queue.
+ * @param commandCount Number of commands queued per run
+ */
+static void benchBatchedRunAll(int commandCount) {
+    printHeader("RUN " + std::to_string(commandCount) + " MIXED CARE COMMANDS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+    const CareAction actions[] = {CareAction::Water, CareAction::Fertilize, CareAction::AdjustSunlight};
+
+    std::vector<Plant*> plants;
+    {
+        QuietScope quiet;
+        for (int i = 0; i < 1000; i++) {
+            plants.push_back(factories[i % factories.size()]->buildPlant(nullptr));
+        }
+    }
+
+    const char* labels[] = {"execute() loop", "runAll()", "runAllBatched()"};
+    for (int mode = 0; mode < 3; mode++) {
+        double ms = 0.0;
+        {
+            QuietScope quiet;
+            CareScheduler scheduler;
+            std::vector<Command*> commands;
+            unsigned int seed = 12345;
+            for (int i = 0; i < commandCount; i++) {
+                seed = seed * 1103515245u + 12345u;
+                Plant* plant = plants[(seed >> 8) % plants.size()];
+                commands.push_back(createCareCommand(actions[(seed >> 20) % 3], plant));
+            }
+
+            if (mode != 0) {
+                for (Command* cmd : commands) {
+                    scheduler.addTask(cmd);
+                }
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            if (mode == 0) {
+                for (Command* cmd : commands) {
+                    cmd->execute();
+                    delete cmd;
+                }
+            } else {
+                if (mode == 1) {
+                    scheduler.runAll();
+                } else {
+                    scheduler.runAllBatched();
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+        }
+        printRow(labels[mode], ms, "ms");
+    }
+
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+}
+
+/**
+ * @brief Command that only counts how often it runs.
+ */
+class CountingCommand : public Command {
+public:
+    explicit CountingCommand(long long* counter) : counter_(counter) {}
+    void execute() override { (*counter_)++; }
+
+private:
+    long long* counter_;
+};
+
+/**
+ * @brief Times scheduling, cancelling and firing a large number of delayed and recurring tasks.
+ * @param taskCount Number of tasks to keep pending
+ */
+static void benchTimingWheel(int taskCount) {
+    printHeader("TIMING WHEEL WITH " + std::to_string(taskCount) + " PENDING TASKS");
+
+    long long executed = 0;
+    CareScheduler* scheduler = nullptr;
+    std::vector<CareScheduler::TaskId> ids;
+    ids.reserve(static_cast<size_t>(taskCount));
+    {
+        QuietScope quiet;
+        scheduler = new CareScheduler();
+    }
+
+    // 1 in 10 tasks recurs every 1-30 days; the rest fire once within ~3 years
+    unsigned int seed = 2024;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < taskCount; i++) {
+        seed = seed * 1103515245u + 12345u;
+        Command* cmd = new CountingCommand(&executed);
+        if (i % 10 == 0) {
+            int interval = 1 + static_cast<int>((seed >> 8) % 30);
+            ids.push_back(scheduler->scheduleEvery(cmd, interval));
+        } else {
+            ids.push_back(scheduler->scheduleAfter(cmd, 1 + static_cast<int>((seed >> 8) % 1000)));
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    double scheduleMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    int cancelled = 0;
+    for (size_t i = 3; i < ids.size(); i += 7) {
+        cancelled += scheduler->cancelTask(ids[i]) ? 1 : 0;
+    }
+    end = std::chrono::steady_clock::now();
+    double cancelMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int day = 0; day < 365; day++) {
+        scheduler->advanceDay();
+    }
+    end = std::chrono::steady_clock::now();
+    double tickMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+    printRow("schedule", scheduleMs, "ms");
+    printRow("per schedule", scheduleMs * 1e6 / taskCount, "ns");
+    printRow("cancel (" + std::to_string(cancelled) + ")", cancelMs, "ms");
+    printRow("365 daily ticks", tickMs, "ms");
+    printRow("commands executed", static_cast<double>(executed), "");
+    printRow("per executed command", executed > 0 ? tickMs * 1e6 / executed : 0.0, "ns");
+    printRow("still scheduled", static_cast<double>(scheduler->getScheduledCount()), "");
+
+    QuietScope quiet;
+    delete scheduler;
+}
+
+/**
+ * @brief Times runAllParallel() on a large mixed care queue with 1..N workers.
+ * @param commandCount Number of care commands to queue per run
+ */
+static void benchParallelRunAll(int commandCount) {
+    printHeader("PARALLEL RUN OF " + std::to_string(commandCount) + " CARE COMMANDS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+    const CareAction actions[] = {CareAction::Water, CareAction::Fertilize, CareAction::AdjustSunlight};
+
+    std::vector<Plant*> plants;
+    {
+        QuietScope quiet;
+        for (int i = 0; i < 10000; i++) {
+            plants.push_back(factories[i % factories.size()]->buildPlant(nullptr));
+        }
+    }
+
+    unsigned hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    printRow("hardware threads", hardwareThreads, "");
+
+    double singleMs = 0.0;
+    for (unsigned workers = 1; workers <= hardwareThreads; workers *= 2) {
+        double ms = 0.0;
+        {
+            QuietScope quiet;
+            CareScheduler scheduler;
+            unsigned int seed = 777;
+            for (int i = 0; i < commandCount; i++) {
+                seed = seed * 1103515245u + 12345u;
+                Plant* plant = plants[(seed >> 8) % plants.size()];
+                scheduler.addTask(createCareCommand(actions[(seed >> 20) % 3], plant));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            scheduler.runAllParallel(workers);
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+        }
+        if (workers == 1) {
+            singleMs = ms;
+        }
+        printRow(std::to_string(workers) + " workers", ms, "ms");
+        printRow(std::to_string(workers) + " workers speed-up", ms > 0.0 ? singleMs / ms : 0.0, "x");
+        if (workers < hardwareThreads && workers * 2 > hardwareThreads) {
+            workers = hardwareThreads / 2;  // Always finish on the full thread count
+        }
+    }
+
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+}
+
+/**
+ * @brief Compares immediate observer notification with a NotificationBatch around the daily loop.
+ * @param plantCount Number of observed plants
+ */
+static void benchCoalescedNotify(int plantCount) {
+    printHeader("DAILY UPDATE OF " + std::to_string(plantCount) + " OBSERVED PLANTS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    std::vector<PlantFactory*> factories = {&roseFactory, &cactusFactory};
+
+    for (int batched = 0; batched < 2; batched++) {
+        double ms = 0.0;
+        {
+            QuietScope quiet;
+            CareScheduler scheduler;
+            std::vector<Plant*> plants;
+            for (int i = 0; i < plantCount; i++) {
+                Plant* plant = factories[i % factories.size()]->buildPlant(nullptr);
+                scheduler.attachStandardObservers(plant);
+                plants.push_back(plant);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int day = 0; day < 10; day++) {
+                if (batched) {
+                    NotificationBatch batch;
+                    for (Plant* plant : plants) {
+                        plant->dailyUpdate();
+                    }
+                } else {
+                    for (Plant* plant : plants) {
+                        plant->dailyUpdate();
+                    }
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+            for (Plant* plant : plants) {
+                delete plant;
+            }
+        }
+        printRow(batched ? "10 days, NotificationBatch" : "10 days, immediate notify()", ms, "ms");
+    }
+}
+
+/**
+ * @brief Compares virtual dailyUpdate() calls with the per-species batch kernels.
+ * @param plantCount Number of plants, a quarter of each species
+ */
+static void benchSpeciesKernels(int plantCount) {
+    printHeader("10 DAYS OF DECAY, " + std::to_string(plantCount) + " PLANTS BY SPECIES");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    // Sections of 64 plants of one species, as a greenhouse is usually planted
+    const int SECTION = 64;
+    for (int kernel = 0; kernel < 2; kernel++) {
+        double ms = 0.0;
+        {
+            QuietScope quiet;
+            std::vector<Plant*> plants;
+            plants.reserve(plantCount);
+            for (int i = 0; i < plantCount; i++) {
+                plants.push_back(factories[(i / SECTION) % factories.size()]->buildPlant(nullptr));
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            for (int day = 0; day < 10; day++) {
+                if (kernel) {
+                    dailyUpdateBatch(plants.data(), plants.size());
+                } else {
+                    for (Plant* plant : plants) {
+                        plant->dailyUpdate();
+                    }
+                }
+            }
+            auto end = std::chrono::steady_clock::now();
+            ms = std::chrono::duration<double, std::milli>(end - start).count();
+
+            for (Plant* plant : plants) {
+                delete plant;
+            }
+        }
+        printRow(kernel ? "dailyUpdateBatch()" : "dailyUpdate() loop", ms, "ms");
+    }
+}
+
+/**
+ * @brief Compares building a nursery through the factories with restoring it from a snapshot.
+ * @param plantCount Number of greenhouse plants
+ */
+static void benchSnapshot(int plantCount) {
+    printHeader("SNAPSHOT OF " + std::to_string(plantCount) + " PLANTS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    int side = 1;
+    while (side * side < plantCount) {
+        side++;
+    }
+    const std::string path = "bench_nursery.snap";
+
+    double buildMs = 0.0;
+    double saveMs = 0.0;
+    double loadMs = 0.0;
+    long long fileBytes = 0;
+    bool restoredAll = false;
+    {
+        QuietScope quiet;
+        NurseryContents original;
+        auto start = std::chrono::steady_clock::now();
+        original.greenhouse = new Greenhouse(nullptr, side, side);
+        original.salesFloor = new SalesFloor(nullptr, 5, 5);
+        for (int i = 0; i < plantCount; i++) {
+            Plant* plant = factories[i % factories.size()]->buildPlant(nullptr);
+            plant->advanceDays(i % 11);
+            original.greenhouse->addPlant(plant, i / side, i % side);
+        }
+        auto built = std::chrono::steady_clock::now();
+        buildMs = std::chrono::duration<double, std::milli>(built - start).count();
+
+        NurserySnapshot snapshot;
+        start = std::chrono::steady_clock::now();
+        snapshot.save(path, original);
+        auto saved = std::chrono::steady_clock::now();
+        saveMs = std::chrono::duration<double, std::milli>(saved - start).count();
+
+        std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+        fileBytes = static_cast<long long>(in.tellg());
+
+        NurseryContents restored;
+        start = std::chrono::steady_clock::now();
+        restoredAll = snapshot.load(path, nullptr, restored) &&
+                      restored.greenhouse->getNumberOfPlants() == plantCount;
+        auto loaded = std::chrono::steady_clock::now();
+        loadMs = std::chrono::duration<double, std::milli>(loaded - start).count();
+
+        delete original.greenhouse;
+        delete original.salesFloor;
+        delete restored.greenhouse;
+        delete restored.salesFloor;
+        std::remove(path.c_str());
+    }
+
+    printRow("build through factories", buildMs, "ms");
+    printRow("save()", saveMs, "ms");
+    printRow("load()", loadMs, "ms");
+    printRow("file size", fileBytes / (1024.0 * 1024.0), "MB");
+    printRow("restored every plant", restoredAll ? 1.0 : 0.0, "");
+}
+
+static long long fileSize(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+    return in ? static_cast<long long>(in.tellg()) : 0;
+}
+
+static void benchCheckpoint(int plantCount) {
+    printHeader("CHECKPOINTS OF " + std::to_string(plantCount) + " PLANTS");
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    int side = 1;
+    while (side * side < plantCount) {
+        side++;
+    }
+    const std::string path = "bench_checkpoint.snap";
+    const int changeStrides[] = {1000, 100, 10, 2};
+    const char* const changePercents[] = {"0.1", "1", "10", "50"};
+
+    struct Row {
+        std::string label;
+        double value;
+        std::string unit;
+    };
+    std::vector<Row> rows;
+    {
+        QuietScope quiet;
+        NurseryContents live;
+        live.greenhouse = new Greenhouse(nullptr, side, side);
+        std::vector<Plant*> plants;
+        plants.reserve(plantCount);
+        for (int i = 0; i < plantCount; i++) {
+            Plant* plant = factories[i % factories.size()]->buildPlant(nullptr);
+            live.greenhouse->addPlant(plant, i / side, i % side);
+            plants.push_back(plant);
+        }
+
+        NurseryCheckpoint checkpoint(path, 8);
+        auto start = std::chrono::steady_clock::now();
+        checkpoint.checkpoint(live);
+        double fullMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"full snapshot", fullMs, "ms"});
+        rows.push_back({"  size", fileSize(path) / (1024.0 * 1024.0), "MB"});
+
+        for (int r = 0; r < 4; r++) {
+            int stride = changeStrides[r];
+            for (int i = 0; i < plantCount; i += stride) {
+                plants[i]->setWaterLevel(plants[i]->getWaterLevel() - 1);
+            }
+            start = std::chrono::steady_clock::now();
+            checkpoint.checkpoint(live);
+            double deltaMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            rows.push_back({std::string("delta, ") + changePercents[r] + "% changed", deltaMs, "ms"});
+            rows.push_back({"  size", fileSize(checkpoint.getDeltaPath(checkpoint.getDeltaCount())) / (1024.0 * 1024.0), "MB"});
+        }
+
+        NurseryCheckpoint reader(path);
+        NurseryContents restored;
+        start = std::chrono::steady_clock::now();
+        bool ok = reader.restore(nullptr, restored);
+        double restoreMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"restore base + " + std::to_string(reader.getDeltaCount()) + " deltas", restoreMs, "ms"});
+        rows.push_back({"restored every plant",
+                        ok && restored.greenhouse->getNumberOfPlants() == plantCount ? 1.0 : 0.0, ""});
+
+        start = std::chrono::steady_clock::now();
+        reader.compact();
+        double compactMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"compact chain on disk", compactMs, "ms"});
+
+        delete live.greenhouse;
+        delete restored.greenhouse;
+        delete restored.salesFloor;
+        std::remove(path.c_str());
+    }
+
+    for (const Row& row : rows) {
+        printRow(row.label, row.value, row.unit);
+    }
+}
+
+/**
+ * @brief Stocks a greenhouse from a generated CSV manifest, against stocking it one addPlant() at a time.
+ * @param plantCount Number of manifest rows
+ */
+static void benchImport(int plantCount) {
+    printHeader("CSV IMPORT OF " + std::to_string(plantCount) + " PLANTS");
+
+    const char* const species[] = {"Rose", "Cactus", "Potato", "Monstera"};
+    int side = 1;
+    while (side * side < plantCount) {
+        side++;
+    }
+    const std::string path = "bench_manifest.csv";
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << "species,id,age,water,sunlight,nutrients,price,row,col\n";
+        for (int i = 0; i < plantCount; i++) {
+            out << species[i % 4] << ",SUP-" << i << "," << i % 11 << ",80,70,60,"
+                << 20 + i % 50 << ".50," << i / side << "," << i % side << "\n";
+        }
+    }
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    PotatoFactory potatoFactory;
+    MonsteraFactory monsteraFactory;
+    std::vector<PlantFactory*> factories = {
+        &roseFactory, &cactusFactory, &potatoFactory, &monsteraFactory
+    };
+
+    double singleMs = 0.0;
+    double importMs = 0.0;
+    size_t singleAllocs = 0;
+    size_t importAllocs = 0;
+    size_t imported = 0;
+    {
+        QuietScope quiet;
+        Greenhouse* greenhouse = new Greenhouse(nullptr, side, side);
+        AllocSnapshot before = takeSnapshot();
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < plantCount; i++) {
+            Plant* plant = factories[i % factories.size()]->buildPlant(nullptr);
+            plant->advanceDays(i % 11);
+            plant->setPrice(20 + i % 50 + 0.5);
+            greenhouse->addPlant(plant, i / side, i % side);
+        }
+        singleMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        singleAllocs = takeSnapshot().count - before.count;
+        delete greenhouse;
+
+        greenhouse = new Greenhouse(nullptr, side, side);
+        InventoryImporter importer(greenhouse);
+        before = takeSnapshot();
+        start = std::chrono::steady_clock::now();
+        importer.importFile(path);
+        importMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        importAllocs = takeSnapshot().count - before.count;
+        imported = importer.getImportedCount();
+        delete greenhouse;
+    }
+
+    printRow("manifest size", fileSize(path) / (1024.0 * 1024.0), "MB");
+    printRow("one addPlant() at a time", singleMs, "ms");
+    printRow("  allocations per plant", static_cast<double>(singleAllocs) / plantCount, "");
+    printRow("importFile()", importMs, "ms");
+    printRow("  per row", importMs * 1e6 / plantCount, "ns");
+    printRow("  allocations per plant", static_cast<double>(importAllocs) / plantCount, "");
+    printRow("  imported every row", imported == static_cast<size_t>(plantCount) ? 1.0 : 0.0, "");
+    std::remove(path.c_str());
+}
+
+/**
+ * @brief Journals one checkout: the plant going into the cart, the sale and the payment.
+ */
+static void journalCheckout(TransactionJournal* journal, const Plant* plant, int i) {
+    journal->recordTransfer(plant, "Bench Customer", JournalLocation::SalesFloor, i % 64, i % 32);
+    journal->recordSale("Bench Customer", 50.0);
+    journal->recordPayment("Bench Customer", 50.0);
+}
+
+static void benchJournal(int transactionCount) {
+    printHeader("TRANSACTION JOURNAL, " + std::to_string(transactionCount) + " CHECKOUTS OF 3 RECORDS");
+
+    const std::string path = "bench_transactions.journal";
+    const int syncedCount = std::min(transactionCount, 2000);
+    const int threadCount = 4;
+    TransactionJournal* journal = TransactionJournal::getInstance();
+    Plant plant("Rose", "ROSE_1", nullptr, nullptr);
+
+    struct Row {
+        std::string label;
+        double value;
+        std::string unit;
+    };
+    std::vector<Row> rows;
+    {
+        QuietScope quiet;
+        std::remove(path.c_str());
+
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < transactionCount; i++) {
+            journalCheckout(journal, &plant, i);
+        }
+        double closedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"journal closed", closedUs * 1000.0 / transactionCount, "ns/checkout"});
+
+        // Every record written and synced on its own
+        journal->open(path, 1);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < syncedCount; i++) {
+            journalCheckout(journal, &plant, i);
+        }
+        double syncedUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        journal->close();
+        std::remove(path.c_str());
+        rows.push_back({"sync per record (" + std::to_string(syncedCount) + " checkouts)",
+                        syncedUs / syncedCount, "us/checkout"});
+
+        // Groups of DEFAULT_GROUP_SIZE records, then one commit for the tail
+        journal->open(path);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < transactionCount; i++) {
+            journalCheckout(journal, &plant, i);
+        }
+        journal->commit();
+        double groupUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"group commit", groupUs / transactionCount, "us/checkout"});
+        rows.push_back({"  syncs", static_cast<double>(journal->getSyncCount()), ""});
+        journal->close();
+
+        JournalReplay replay;
+        start = std::chrono::steady_clock::now();
+        replay.replay(path);
+        double replayMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"replay", replayMs, "ms"});
+        rows.push_back({"  sales replayed", static_cast<double>(replay.getSaleCount()), ""});
+        std::remove(path.c_str());
+
+        // Each checkout waits until it is durable; concurrent checkouts share syncs
+        journal->open(path, static_cast<size_t>(-1));
+        int perThread = syncedCount / threadCount;
+        start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int t = 0; t < threadCount; t++) {
+            threads.emplace_back([journal, &plant, perThread]() {
+                for (int i = 0; i < perThread; i++) {
+                    journalCheckout(journal, &plant, i);
+                    journal->commit();
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+        double durableUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        rows.push_back({"commit per checkout, " + std::to_string(threadCount) + " threads",
+                        durableUs / (perThread * threadCount), "us/checkout"});
+        rows.push_back({"  checkouts per sync",
+                        static_cast<double>(perThread * threadCount) / journal->getSyncCount(), ""});
+        journal->close();
+        std::remove(path.c_str());
+    }
+
+    for (const Row& row : rows) {
+        printRow(row.label, row.value, row.unit);
+    }
+}
+
+/**
+ * @brief One sale kept as a row, the way an order history would hold it.
+ */
+struct SaleRow {
+    int day;
+    SalesLedger::CustomerType customerType;
+    std::string species;
+    unsigned char decorations;
+    double price;
+    PaymentMethod method;
+};
+
+static void benchLedger(int lineItemCount) {
+    printHeader("SALES LEDGER OF " + std::to_string(lineItemCount) + " LINE ITEMS");
+
+    const char* const species[] = {"Rose", "Daisy", "Cactus", "Aloe", "Potato",
+                                   "Radish", "Carrot", "Monstera", "Strelitzia", "VenusFlyTrap"};
+    const int speciesCount = 10;
+    const int salesPerDay = 2000;
+    const int weekCount = (lineItemCount / salesPerDay) / 7 + 1;
+    const std::string path = "bench_ledger.spill";
+    SalesLedger* ledger = SalesLedger::getInstance();
+
+    auto timeMs = [](auto&& work) {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // Row-wise baseline
+    std::vector<SaleRow> rows;
+    AllocSnapshot before = takeSnapshot();
+    double rowAppendMs = timeMs([&]() {
+        for (int i = 0; i < lineItemCount; i++) {
+            rows.push_back({i / salesPerDay, static_cast<SalesLedger::CustomerType>(i % 3), species[i % speciesCount],
+                            static_cast<unsigned char>(i % 5 == 0 ? SalesLedger::Ribbon : 0),
+                            20.0 + i % 50, i % 2 ? PaymentMethod::Cash : PaymentMethod::CreditCard});
+        }
+    });
+    size_t rowBytes = takeSnapshot().bytes - before.bytes;
+
+    std::vector<double> rowTable;
+    size_t rowDecorated = 0;
+    double rowWeeklyMs = timeMs([&]() {
+        std::unordered_map<std::string, int> column;
+        for (int s = 0; s < speciesCount; s++) {
+            column[species[s]] = s;
+        }
+        rowTable.assign(static_cast<size_t>(weekCount) * speciesCount, 0.0);
+        for (const SaleRow& row : rows) {
+            rowTable[static_cast<size_t>(row.day / 7) * speciesCount + column[row.species]] += row.price;
+        }
+    });
+    double rowAttachMs = timeMs([&]() {
+        for (const SaleRow& row : rows) {
+            rowDecorated += (row.decorations & SalesLedger::ANY_DECORATION) != 0;
+        }
+    });
+    rows.clear();
+    rows.shrink_to_fit();
+
+    // Columnar, everything in memory
+    ledger->clear();
+    uint16_t codes[speciesCount];
+    for (int s = 0; s < speciesCount; s++) {
+        codes[s] = ledger->speciesCode(species[s]);
+    }
+    auto fillLedger = [&]() {
+        for (int i = 0; i < lineItemCount; i++) {
+            ledger->addLineItem(i / salesPerDay, static_cast<SalesLedger::CustomerType>(i % 3), codes[i % speciesCount],
+                                static_cast<uint8_t>(i % 5 == 0 ? SalesLedger::Ribbon : 0), 20.0 + i % 50,
+                                i % 2 ? PaymentMethod::Cash : PaymentMethod::CreditCard);
+        }
+    };
+    before = takeSnapshot();
+    double ledgerAppendMs = timeMs(fillLedger);
+    size_t ledgerBytes = takeSnapshot().bytes - before.bytes;
+
+    RevenueTable table;
+    double attachRate = 0.0;
+    double ledgerWeeklyMs = timeMs([&]() { table = ledger->revenueBySpeciesPerWeek(); });
+    double ledgerAttachMs = timeMs([&]() { attachRate = ledger->decorationAttachRate(); });
+    double lastWeek = 0.0;
+    int lastDay = (lineItemCount - 1) / salesPerDay;
+    double ledgerRangeMs = timeMs([&]() { lastWeek = ledger->revenue(lastDay - 6, lastDay); });
+
+    bool same = table.revenue.size() == rowTable.size();
+    for (size_t cell = 0; same && cell < rowTable.size(); cell++) {
+        same = std::fabs(table.revenue[cell] - rowTable[cell]) < 1e-6 * (1.0 + rowTable[cell]);
+    }
+    same = same && attachRate == static_cast<double>(rowDecorated) / lineItemCount;
+
+    // Columnar, all but two full chunks spilled to disk
+    ledger->clear();
+    for (int s = 0; s < speciesCount; s++) {
+        ledger->speciesCode(species[s]);
+    }
+    double spilledWeeklyMs = 0.0;
+    double spilledAppendMs = 0.0;
+    size_t spilled = 0;
+    {
+        QuietScope quiet;
+        ledger->setSpillFile(path, 2);
+        spilledAppendMs = timeMs(fillLedger);
+        spilled = ledger->getSpilledLineItemCount();
+        spilledWeeklyMs = timeMs([&]() { table = ledger->revenueBySpeciesPerWeek(); });
+    }
+    ledger->clear();
+
+    printRow("rows: append", rowAppendMs, "ms");
+    printRow("  bytes allocated", rowBytes / (1024.0 * 1024.0), "MB");
+    printRow("  revenue by species per week", rowWeeklyMs, "ms");
+    printRow("  decoration attach rate", rowAttachMs, "ms");
+    printRow("columns: append", ledgerAppendMs, "ms");
+    printRow("  bytes allocated", ledgerBytes / (1024.0 * 1024.0), "MB");
+    printRow("  revenue by species per week", ledgerWeeklyMs, "ms");
+    printRow("  decoration attach rate", ledgerAttachMs, "ms");
+    printRow("  revenue of the last week", ledgerRangeMs, "ms");
+    printRow("  same answers as rows", same ? 1.0 : 0.0, "");
+    printRow("spilled: append", spilledAppendMs, "ms");
+    printRow("  line items on disk", static_cast<double>(spilled), "");
+    printRow("  revenue by species per week", spilledWeeklyMs, "ms");
+}
+
+static void benchOrderHistory(int orderCount) {
+    printHeader("ORDER HISTORY OF " + std::to_string(orderCount) + " ORDERS");
+
+    const int customerCount = 100;
+    const std::string path = "bench_orders.history";
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    MonsteraFactory monsteraFactory;
+
+    // Each order: a bundle of three plants, one with a ribbon, and a plant on its own
+    std::vector<FinalOrder*> orders;
+    std::vector<std::string> customerIds;
+    {
+        QuietScope quiet;
+        for (int c = 0; c < customerCount; c++) {
+            customerIds.push_back("CUST-" + std::to_string(c));
+        }
+        for (int i = 0; i < orderCount; i++) {
+            FinalOrder* order = new FinalOrder("Customer " + std::to_string(i % customerCount));
+            ConcreteOrder* bundle = new ConcreteOrder("Bundle");
+            bundle->add(new Leaf(new RibbonDecorator(roseFactory.buildPlant(nullptr))));
+            bundle->add(new Leaf(cactusFactory.buildPlant(nullptr)));
+            bundle->add(new Leaf(roseFactory.buildPlant(nullptr)));
+            order->addOrder(bundle);
+            order->addOrder(new Leaf(monsteraFactory.buildPlant(nullptr)));
+            orders.push_back(order);
+        }
+    }
+
+    auto timeMs = [](auto&& work) {
+        auto start = std::chrono::steady_clock::now();
+        work();
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // Baseline: the orders kept as object trees and priced through their iterators
+    double treeTotal = 0.0;
+    AllocSnapshot before = takeSnapshot();
+    double treePriceMs = timeMs([&]() {
+        for (FinalOrder* order : orders) {
+            treeTotal += order->calculateTotalPrice();
+        }
+    });
+    size_t treePriceAllocs = takeSnapshot().count - before.count;
+    size_t treeMatches = 0;
+    double treeSearchMs = timeMs([&]() {
+        for (FinalOrder* order : orders) {
+            for (Order* item : order->getOrders()) {
+                ConcreteOrder* group = dynamic_cast<ConcreteOrder*>(item);
+                if (group == nullptr) {
+                    continue;
+                }
+                bool found = false;
+                for (Order* child : group->getChildren()) {
+                    found = found || child->getName() == "Cactus";
+                }
+                treeMatches += found ? 1 : 0;
+            }
+        }
+    });
+    FinalOrder* clone = nullptr;
+    double cloneMs = 0.0;
+    {
+        QuietScope quiet;
+        cloneMs = timeMs([&]() { clone = orders.back()->clone(); });
+    }
+    delete clone;
+
+    std::remove(path.c_str());
+    double appendMs = 0.0;
+    {
+        OrderHistory history;
+        history.open(path);
+        appendMs = timeMs([&]() {
+            for (int i = 0; i < orderCount; i++) {
+                history.append(orders[i], customerIds[i % customerCount], i / customerCount);
+            }
+        });
+    }
+    for (FinalOrder* order : orders) {
+        delete order;
+    }
+    orders.clear();
+
+    OrderHistory history;
+    double openMs = timeMs([&]() { history.open(path); });
+    double historyTotal = 0.0;
+    before = takeSnapshot();
+    double historyPriceMs = timeMs([&]() {
+        for (const std::string& id : customerIds) {
+            historyTotal += history.getTotalSpent(id);
+        }
+    });
+    size_t historyPriceAllocs = takeSnapshot().count - before.count;
+    size_t historyMatches = 0;
+    double historySearchMs = timeMs([&]() {
+        for (const std::string& id : customerIds) {
+            historyMatches += history.findOrders(id, "Cactus").size();
+        }
+    });
+    FinalOrder* reorder = nullptr;
+    double materializeMs = 0.0;
+    {
+        QuietScope quiet;
+        materializeMs = timeMs([&]() {
+            reorder = history.materialize(history.getLatestOrder(customerIds.back()));
+        });
+    }
+    delete reorder;
+    history.close();
+
+    printRow("history file", fileSize(path) / (1024.0 * 1024.0), "MB");
+    printRow("object trees: price every order", treePriceMs, "ms");
+    printRow("  allocations", static_cast<double>(treePriceAllocs), "");
+    printRow("  search for a plant", treeSearchMs, "ms");
+    printRow("  clone one order", cloneMs * 1000.0, "us");
+    printRow("history: append every order", appendMs, "ms");
+    printRow("  open and index", openMs, "ms");
+    printRow("  price every order", historyPriceMs, "ms");
+    printRow("  allocations", static_cast<double>(historyPriceAllocs), "");
+    printRow("  search for a plant", historySearchMs, "ms");
+    printRow("  rebuild one order", materializeMs * 1000.0, "us");
+    printRow("  same totals and matches",
+             std::fabs(historyTotal - treeTotal) < 1e-6 * (1.0 + treeTotal) && historyMatches == treeMatches ? 1.0 : 0.0,
+             "");
+    std::remove(path.c_str());
+}
+
+int main(int argc, char* argv[]) {
+    int plantCount = 100000;
+    if (argc > 1) {
+        plantCount = std::atoi(argv[1]);
+        if (plantCount <= 0) {
+            plantCount = 100000;
+        }
+    }
+
+    std::cout << "=== NURSERY BENCHMARK (" << plantCount << " plants) ===\n";
+
+    benchMemoryFootprint(plantCount);
+    benchFastForward(plantCount);
+    benchSimulationCalendar(plantCount / 10 > 0 ? plantCount / 10 : 1);
+    benchSparseGreenhouse(plantCount / 10 > 0 ? plantCount / 10 : 1);
+    benchRegionCare(plantCount / 10 > 0 ? plantCount / 10 : 1);
+    benchBatchedRunAll(plantCount / 10 > 0 ? plantCount / 10 : 1);
+    benchCoalescedNotify(plantCount / 10 > 0 ? plantCount / 10 : 1);
+    benchSpeciesKernels(plantCount);
+    benchSnapshot(plantCount * 10);
+    benchCheckpoint(plantCount * 10);
+    benchJournal(plantCount);
+    benchImport(plantCount * 10);
+    benchLedger(plantCount * 20);
+    benchOrderHistory(plantCount);
+    benchTimingWheel(plantCount * 10);
+    benchParallelRunAll(plantCount * 2);
+
+    return 0;
+}
@@ -2,27 +2,19 @@
 #include "include/Cactus.h"
 #include "include/SucculentCareStrategy.h"
 #include "include/SeedlingState.h"
-#include "include/WaterObserver.h"
-#include "include/FertilizeObserver.h"
-#include "include/SunlightObserver.h"
 #include "include/CareScheduler.h"
 
 Plant* CactusFactory::buildPlant(CareScheduler* scheduler) const {
     static int cactusCounter = 1;
     std::string plantId = "CACTUS_" + std::to_string(cactusCounter++);
-    CareStrategy* careStrategy = new SucculentCareStrategy();
+    CareStrategy* careStrategy = SucculentCareStrategy::getInstance();
     PlantState* initialState = new SeedlingState();
     
     Cactus* plant = new Cactus(plantId, careStrategy, initialState, "Columnar", "Saguaro");
     
+    // Standard observers are shared per scheduler, so they cost the plant no allocations
     if (scheduler != nullptr) {
-        WaterObserver* waterObs = new WaterObserver(scheduler, plant);
-        FertilizeObserver* fertObs = new FertilizeObserver(scheduler, plant);
-        SunlightObserver* sunObs = new SunlightObserver(scheduler, plant);
-        
-        plant->addOwnedObserver(waterObs);
-        plant->addOwnedObserver(fertObs);
-        plant->addOwnedObserver(sunObs);
+        scheduler->attachStandardObservers(plant);
     }
     
     return plant;
@@ -0,0 +1,16 @@
+#include "include/CareAction.h"
+#include "include/WaterPlantCommand.h"
+#include "include/FertilizePlantCommand.h"
+#include "include/AdjustSunlightCommand.h"
+
+Command* createCareCommand(CareAction action, Plant* target) {
+    switch (action) {
+        case CareAction::Water:
+            return new WaterPlantCommand(target);
+        case CareAction::Fertilize:
+            return new FertilizePlantCommand(target);
+        case CareAction::AdjustSunlight:
+            return new AdjustSunlightCommand(target);
+    }
+    return nullptr;
+}
@@ -1,9 +1,20 @@
 
 #include "include/CareScheduler.h"
 #include "include/Command.h"
+#include "include/Plant.h"
+#include "include/CareStrategy.h"
+#include "include/WaterObserver.h"
+#include "include/FertilizeObserver.h"
+#include "include/SunlightObserver.h"
+#include "include/TransactionJournal.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <thread>
 
-CareScheduler::CareScheduler() {
+CareScheduler::CareScheduler()
+    : waterObserver_(nullptr), fertilizeObserver_(nullptr), sunlightObserver_(nullptr) {
     std::cout << "[CareScheduler] Scheduler created" << std::endl;
 }
 
@@ -13,6 +24,9 @@ CareScheduler::~CareScheduler() {
         delete cmd;
     }
     queue_.clear();
+    delete waterObserver_;
+    delete fertilizeObserver_;
+    delete sunlightObserver_;
     std::cout << "[CareScheduler] Scheduler destroyed, cleaned up " 
               << queue_.size() << " remaining commands" << std::endl;
 }
@@ -61,8 +75,276 @@ void CareScheduler::runAll() {
      std::cout << "[CareScheduler] All " << taskCount << " tasks completed" << std::endl;
 }
 
+void CareScheduler::runAllBatched() {
+    if (queue_.empty()) {
+        std::cout << "[CareScheduler] No tasks to execute" << std::endl;
+        return;
+    }
+
+    size_t taskCount = 0;
+    std::vector<Command*> pending;
+    std::cout << "[CareScheduler] Executing all " << queue_.size() << " queued tasks in batches..." << std::endl;
+
+    // Tasks queued while running are picked up afterwards, as runAll() does
+    while (!queue_.empty()) {
+        pending.clear();
+        pending.swap(queue_);
+        taskCount += pending.size();
+
+        for (size_t i = 0; i < pending.size(); i++) {
+            Command* cmd = pending[i];
+            CareAction action;
+            if (!cmd->getCareAction(action)) {
+                // Barrier: finish everything queued before it, then run it alone
+                flushBatch();
+                cmd->execute();
+                delete cmd;
+                continue;
+            }
+
+            Plant* target = cmd->getTarget();
+            CareStrategy* strategy = (target != nullptr) ? target->getStrategy() : nullptr;
+            if (strategy == nullptr) {
+                delete cmd;  // Nothing to care for; execute() would be a no-op
+                continue;
+            }
+
+            size_t rank = std::find(batchStrategies_.begin(), batchStrategies_.end(), strategy) - batchStrategies_.begin();
+            if (rank == batchStrategies_.size()) {
+                batchStrategies_.push_back(strategy);
+            }
+            batch_.push_back(BatchedTask{batchWaves_[target]++, action, static_cast<int>(rank),
+                                         target, strategy, cmd});
+        }
+        flushBatch();
+    }
+
+    std::cout << "[CareScheduler] All " << taskCount << " tasks completed" << std::endl;
+}
+
+size_t CareScheduler::groupOf(const BatchedTask& task, int strategyCount) {
+    return (static_cast<size_t>(task.wave) * CARE_ACTION_COUNT + static_cast<size_t>(task.action)) * strategyCount
+           + task.strategyRank;
+}
+
+void CareScheduler::flushBatch() {
+    if (batch_.empty()) {
+        return;
+    }
+
+    // Counting sort on (wave, action, strategy); stable, so arrival order holds within a group.
+    // Waves keep per-plant order; within a wave each plant appears at most once.
+    int strategyCount = static_cast<int>(batchStrategies_.size());
+    int maxWave = 0;
+    for (const BatchedTask& task : batch_) {
+        maxWave = std::max(maxWave, task.wave);
+    }
+    size_t groupCount = static_cast<size_t>(maxWave + 1) * CARE_ACTION_COUNT * strategyCount;
+    groupStarts_.assign(groupCount + 1, 0);
+    for (const BatchedTask& task : batch_) {
+        groupStarts_[groupOf(task, strategyCount) + 1]++;
+    }
+    for (size_t g = 0; g < groupCount; g++) {
+        groupStarts_[g + 1] += groupStarts_[g];
+    }
+    sortedBatch_.resize(batch_.size());
+    for (const BatchedTask& task : batch_) {
+        sortedBatch_[groupStarts_[groupOf(task, strategyCount)]++] = task;
+    }
+    batch_.swap(sortedBatch_);
+
+    TransactionJournal* journal = TransactionJournal::getInstance();
+    bool journaling = journal->isOpen();
+    size_t start = 0;
+    while (start < batch_.size()) {
+        const BatchedTask& first = batch_[start];
+        size_t end = start;
+        batchPlants_.clear();
+        while (end < batch_.size() && batch_[end].wave == first.wave &&
+               batch_[end].action == first.action && batch_[end].strategy == first.strategy) {
+            batchPlants_.push_back(batch_[end].target);
+            end++;
+        }
+        first.strategy->careForBatch(first.action, batchPlants_.data(), batchPlants_.size());
+        if (journaling) {
+            for (Plant* plant : batchPlants_) {
+                journal->recordCare(plant, first.action);
+            }
+        }
+        start = end;
+    }
+
+    for (BatchedTask& task : batch_) {
+        delete task.command;
+    }
+    batch_.clear();
+    batchWaves_.clear();
+    batchStrategies_.clear();
+}
+
+
+
+CareScheduler::ParallelRunSummary CareScheduler::runAllParallel(unsigned workerCount) {
+    if (workerCount == 0) {
+        workerCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    ParallelRunSummary summary{0, 0, workerCount, 0};
+    if (queue_.empty()) {
+        std::cout << "[CareScheduler] No tasks to execute" << std::endl;
+        return summary;
+    }
+
+    std::vector<Command*> pending;
+    std::cout << "[CareScheduler] Executing all " << queue_.size() << " queued tasks on "
+              << workerCount << " workers..." << std::endl;
+    shards_.resize(workerCount);
+
+    // Tasks queued while running are picked up afterwards, as runAll() does
+    while (!queue_.empty()) {
+        pending.clear();
+        pending.swap(queue_);
+        summary.commandCount += pending.size();
+
+        for (Command* cmd : pending) {
+            CareAction action;
+            if (!cmd->getCareAction(action)) {
+                // Barrier: finish everything queued before it, then run it alone
+                drainShards(summary);
+                cmd->execute();
+                delete cmd;
+                summary.barrierCount++;
+                continue;
+            }
+            Plant* target = cmd->getTarget();
+            if (target == nullptr) {
+                delete cmd;  // execute() would be a no-op
+                continue;
+            }
+            // Shard 0 is drained by the calling thread, so shared state is only written from there
+            size_t shard = reachesSharedState(target) ? 0 : shardOf(target, shards_.size());
+            shards_[shard].push_back(cmd);
+        }
+        drainShards(summary);
+    }
+
+    std::cout << "[CareScheduler] All " << summary.commandCount << " tasks completed ("
+              << summary.barrierCount << " barriers, largest shard " << summary.largestShard
+              << ")" << std::endl;
+    return summary;
+}
 
+void CareScheduler::drainShards(ParallelRunSummary& summary) {
+    size_t total = 0;
+    for (const std::vector<Command*>& shard : shards_) {
+        total += shard.size();
+        summary.largestShard = std::max(summary.largestShard, shard.size());
+    }
+    if (total == 0) {
+        return;
+    }
+
+    auto drain = [](std::vector<Command*>& shard) {
+        for (Command* cmd : shard) {
+            cmd->execute();
+            delete cmd;
+        }
+        shard.clear();
+    };
+
+    // Small batches are not worth the thread start-up; shard order still keeps per-plant order
+    if (total < MIN_PARALLEL_COMMANDS || shards_.size() == 1) {
+        for (std::vector<Command*>& shard : shards_) {
+            drain(shard);
+        }
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(shards_.size() - 1);
+    for (size_t i = 1; i < shards_.size(); i++) {
+        if (!shards_[i].empty()) {
+            workers.emplace_back(drain, std::ref(shards_[i]));
+        }
+    }
+    drain(shards_[0]);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+size_t CareScheduler::shardOf(const Plant* plant, size_t shardCount) {
+    // Heap addresses share their low bits, so mix them before taking the remainder
+    std::uint64_t key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(plant));
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key % shardCount);
+}
+
+bool CareScheduler::reachesSharedState(const Plant* plant) {
+    return plant->getCalendar() != nullptr || plant->getStateListener() != nullptr ||
+           plant->getObserverCount() > 0;
+}
+
+CareScheduler::TaskId CareScheduler::scheduleAt(Command* cmd, long long day) {
+    return wheel_.scheduleAt(cmd, day);
+}
+
+CareScheduler::TaskId CareScheduler::scheduleAfter(Command* cmd, int delayDays) {
+    return wheel_.scheduleAt(cmd, wheel_.getCurrentDay() + std::max(delayDays, 1));
+}
+
+CareScheduler::TaskId CareScheduler::scheduleEvery(Command* cmd, int intervalDays, int firstDelayDays) {
+    int interval = std::max(intervalDays, 1);
+    int delay = firstDelayDays > 0 ? firstDelayDays : interval;
+    return wheel_.scheduleEvery(cmd, wheel_.getCurrentDay() + delay, interval);
+}
+
+bool CareScheduler::cancelTask(TaskId id) {
+    return wheel_.cancel(id);
+}
+
+bool CareScheduler::isTaskScheduled(TaskId id) const {
+    return wheel_.isScheduled(id);
+}
+
+int CareScheduler::advanceDay() {
+    return wheel_.tick();
+}
+
+int CareScheduler::advanceDays(int days) {
+    return wheel_.advance(days);
+}
+
+long long CareScheduler::getCurrentDay() const {
+    return wheel_.getCurrentDay();
+}
+
+int CareScheduler::getScheduledCount() const {
+    return wheel_.getPendingCount();
+}
 
 bool CareScheduler::empty() const {
     return queue_.empty();
 }
+
+const std::vector<Command*>& CareScheduler::getQueuedTasks() const {
+    return queue_;
+}
+
+void CareScheduler::attachStandardObservers(Plant* plant) {
+    if (plant == nullptr) {
+        return;
+    }
+    // Shared observers are built without a plant so they never attach or detach themselves
+    if (waterObserver_ == nullptr) {
+        waterObserver_ = new WaterObserver(this, nullptr);
+        fertilizeObserver_ = new FertilizeObserver(this, nullptr);
+        sunlightObserver_ = new SunlightObserver(this, nullptr);
+    }
+    plant->attach(waterObserver_);
+    plant->attach(fertilizeObserver_);
+    plant->attach(sunlightObserver_);
+}
@@ -2,27 +2,19 @@
 #include "include/Carrot.h"
 #include "include/VegetableCareStrategy.h"
 #include "include/SeedlingState.h"
-#include "include/WaterObserver.h"
-#include "include/FertilizeObserver.h"
-#include "include/SunlightObserver.h"
 #include "include/CareScheduler.h"
 
 Plant* CarrotFactory::buildPlant(CareScheduler* scheduler) const {
     static int CarrotCounter = 1;
     std::string plantId = "Carrot_" + std::to_string(CarrotCounter++);
-    CareStrategy* careStrategy = new VegetableCareStrategy();
+    CareStrategy* careStrategy = VegetableCareStrategy::getInstance();
     PlantState* initialState = new SeedlingState();
     
     Carrot* plant = new Carrot(plantId, careStrategy, initialState, "Russet", "Brown");
     
+    // Standard observers are shared per scheduler, so they cost the plant no allocations
     if (scheduler != nullptr) {
-        WaterObserver* waterObs = new WaterObserver(scheduler, plant);
-        FertilizeObserver* fertObs = new FertilizeObserver(scheduler, plant);
-        SunlightObserver* sunObs = new SunlightObserver(scheduler, plant);
-        
-        plant->addOwnedObserver(waterObs);
-        plant->addOwnedObserver(fertObs);
-        plant->addOwnedObserver(sunObs);
+        scheduler->attachStandardObservers(plant);
     }
     
     return plant;
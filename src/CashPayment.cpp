@@ -20,3 +20,7 @@ void CashPayment::printReceipt(FinalOrder* order) {
     std::cout << "[Receipt] Printing cash payment receipt:\n";
     order->printInvoice();
 }
+
+PaymentMethod CashPayment::getPaymentMethod() const {
+    return PaymentMethod::Cash;
+}
@@ -20,3 +20,7 @@ void CreditCardPayment::printReceipt(FinalOrder* order) {
     std::cout << "[Receipt] Printing credit card payment receipt:\n";
     order->printInvoice();
 }
+
+PaymentMethod CreditCardPayment::getPaymentMethod() const {
+    return PaymentMethod::CreditCard;
+}
@@ -9,12 +9,13 @@
 #include "include/GiftWrapDecorator.h"
 #include "include/DecorativePotDecorator.h"
 #include "include/StaffMembers.h"
+#include "include/TransactionJournal.h"
 #include <algorithm>
 #include <iostream>
 
 Customer::Customer(NurseryMediator* m, const std::string& name, 
                    const std::string& id, double initialBudget)
-    : Person(m, name, id), budget(initialBudget), currentRequest(nullptr), currentOrder(nullptr) {
+    : Person(m, name, id), budget(initialBudget), currentRequest(nullptr), currentOrder(nullptr), changeCount(0) {
     std::cout << "[Customer] " << name << " created with budget R" << initialBudget << "\n";
 }
 
@@ -111,6 +112,7 @@ bool Customer::returnPlantToSalesFloor(int cartIndex) {
     if (success) {
         // Remove from cart (either nullptr or the plant if it wasn't decorated)
         cart.erase(cart.begin() + cartIndex);
+        changeCount++;
         std::cout << "[Customer] Successfully returned plant to sales floor.\n";
     } else {
         std::cout << "[Customer] Failed to return plant to sales floor.\n";
@@ -131,6 +133,7 @@ void Customer::clearCart() {
         delete plant;
     }
     cart.clear();
+    changeCount++;
     std::cout << "[Customer] Cart cleared.\n";
 }
 
@@ -166,6 +169,7 @@ void Customer::decorateCartItemWithRibbon(int index) {
     
     Plant* decorated = new RibbonDecorator(originalPlant);
     cart[index] = decorated;
+    changeCount++;
     
     std::cout << "[Customer] Added ribbon to plant at cart position " << index 
               << ". New price: R" << decorated->getPrice() << "\n";
@@ -185,6 +189,7 @@ void Customer::decorateCartItemWithGiftWrap(int index) {
     
     Plant* decorated = new GiftWrapDecorator(originalPlant);
     cart[index] = decorated;
+    changeCount++;
     
     std::cout << "[Customer] Added gift wrap to plant at cart position " << index 
               << ". New price: R" << decorated->getPrice() << "\n";
@@ -204,6 +209,7 @@ void Customer::decorateCartItemWithPot(int index, std::string color) {
     
     Plant* decorated = new DecorativePotDecorator(originalPlant, color);
     cart[index] = decorated;
+    changeCount++;
     
     std::cout << "[Customer] Added " << color << " pot to plant at cart position " << index 
               << ". New price: R" << decorated->getPrice() << "\n";
@@ -235,6 +241,7 @@ void Customer::removeRibbonFromCartItem(int index) {
     if (hadGiftWrap) { rebuilt = new GiftWrapDecorator(rebuilt); }
     if (hadPot)      { rebuilt = new DecorativePotDecorator(rebuilt, potColor); }
     cart[index] = rebuilt;
+    changeCount++;
     std::cout << "[Customer] Removed ribbon for cart index " << index << "\n";
 }
 
@@ -262,6 +269,7 @@ void Customer::removePotFromCartItem(int index) {
     if (hadGiftWrap) { rebuilt = new GiftWrapDecorator(rebuilt); }
     if (hadRibbon)   { rebuilt = new RibbonDecorator(rebuilt); }
     cart[index] = rebuilt;
+    changeCount++;
     std::cout << "[Customer] Removed pot for cart index " << index << "\n";
 }
 
@@ -274,6 +282,7 @@ void Customer::clearDecorationsForCartItem(int index) {
 
     Plant* base = Decorator::stripDecorations(item);
     cart[index] = base;
+    changeCount++;
     std::cout << "[Customer] Cleared all decorations for cart index " << index << "\n";
 }
 
@@ -419,6 +428,7 @@ double Customer::getBudget() const {
 void Customer::setBudget(double amount) {
     if (amount >= 0) {
         budget = amount;
+        changeCount++;
         std::cout << "[Customer] Budget set to R" << budget << "\n";
     }
 }
@@ -436,11 +446,17 @@ bool Customer::deductFromBudget(double amount) {
     }
     
     budget -= amount;
+    changeCount++;
+    TransactionJournal::getInstance()->recordPayment(getName(), amount);
     std::cout << "[Customer] Deducted R" << amount << " from budget. Remaining: R" 
               << budget << "\n";
     return true;
 }
 
+uint64_t Customer::getChangeCount() const {
+    return changeCount;
+}
+
 // ============ PRIVATE METHODS (friend access only) ============
 
 void Customer::addToCart(Plant* plant) {
@@ -456,6 +472,7 @@ void Customer::addToCart(Plant* plant) {
     }
     
     cart.push_back(plant);
+    changeCount++;
     std::cout << "[Customer] Added plant " << plant->getID() << " to cart.\n";
 }
 
@@ -467,6 +484,7 @@ void Customer::removeFromCart(Plant* plant) {
     auto it = std::find(cart.begin(), cart.end(), plant);
     if (it != cart.end()) {
         cart.erase(it);
+        changeCount++;
         std::cout << "[Customer] Removed plant " << plant->getID() << " from cart.\n";
     }
 }
\ No newline at end of file
@@ -1,9 +1,10 @@
 #include "include/DeadState.h"
 #include "include/Plant.h"
+#include "include/SpeciesTraits.h"
 #include <iostream>
 
 
-DeadState::DeadState() {
+DeadState::DeadState() : PlantState(LifecycleStage::Dead) {
     std::cout << "Plant has died." << std::endl;
 }
 
@@ -14,6 +14,18 @@ void Decorator::dailyUpdate() {
     }
 }
 
+void Decorator::advanceDays(int days) {
+    if (plant != nullptr) {
+        plant->advanceDays(days);
+    }
+}
+
+void Decorator::advanceDaysMaintained(int days) {
+    if (plant != nullptr) {
+        plant->advanceDaysMaintained(days);
+    }
+}
+
 std::string Decorator::toString() const {
     if (plant != nullptr) {
         return plant->toString();
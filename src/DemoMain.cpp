@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <cstdlib>
 #include <ctime>
 #include <sstream>
 #include <limits>
@@ -27,6 +28,8 @@
 #include "include/PaymentProcessor.h"
 #include "include/CashPayment.h"
 #include "include/CreditCardPayment.h"
+#include "include/SalesLedger.h"
+#include "include/TransactionJournal.h"
 #include "include/Plant.h"
 #include "include/RibbonDecorator.h"
 #include "include/GiftWrapDecorator.h"
@@ -274,6 +277,13 @@ void systemSetUp() {
     // connecting salesFloor and greenhouse to mediator
     coordinator->registerColleague(salesFloor);
     coordinator->registerColleague(greenhouse);
+
+    // Stock, sales, moves and care are journaled from here on when a journal is asked for;
+    // checkouts commit them
+    const char* journalPath = std::getenv(TransactionJournal::PATH_VARIABLE);
+    if (journalPath != nullptr && !TransactionJournal::getInstance()->open(journalPath)) {
+        cout << YELLOW << "Journal disabled: " << TransactionJournal::getInstance()->getError() << "\n" << RESET;
+    }
     
     // cout << CYAN << "✓ Sales Floor created (5x5 grid)\n" << RESET;
     // cout << CYAN << "✓ Greenhouse created (6x6 grid)\n" << RESET;
@@ -468,12 +478,14 @@ void systemSetUp() {
 }
 
 void cleanupSystem() {
+    TransactionJournal::getInstance()->close();
     delete assistant;
     delete manager;
     delete owner;
-    delete scheduler;
+    // Plants go before the scheduler their standard observers point at
     delete salesFloor;
     delete greenhouse;
+    delete scheduler;
     delete coordinator;
 }
 
@@ -924,8 +936,11 @@ void customerCheckout(Customer* customer) {
     cout << "\n";
     processor->processTransaction(finalOrder);
     
-    customer->deductFromBudget(total);
+    if (customer->deductFromBudget(total)) {
+        SalesLedger::getInstance()->recordOrder(finalOrder, customer, processor);
+    }
     customer->clearCart();
+    TransactionJournal::getInstance()->commit();
     
     cout << "\n" << GREEN << BOLD << "✓ Purchase complete!\n" << RESET;
     cout << "Remaining budget: " << GREEN << formatPrice(customer->getBudget()) << RESET << "\n";
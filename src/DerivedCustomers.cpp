@@ -5,6 +5,8 @@
 #include "include/FinalOrder.h"
 #include "include/ConcreteOrder.h"
 #include "include/Plant.h"
+#include "include/SalesLedger.h"
+#include "include/TransactionJournal.h"
 #include <iostream>
 
 // ============ CorporateCustomer ============
@@ -59,9 +61,12 @@ void CorporateCustomer::checkOut() {
     processor->processTransaction(finalOrder);
     
     if (deductFromBudget(total)) {
+        SalesLedger::getInstance()->recordOrder(finalOrder, this, processor);
         std::cout << "Corporate purchase successful!\n";
         clearCart();
     }
+    // The checkout is the commit point: the sale, payment and cart transfers become durable together
+    TransactionJournal::getInstance()->commit();
     
     delete processor;
     delete finalOrder;
@@ -115,9 +120,12 @@ void RegularCustomer::checkOut() {
     processor->processTransaction(finalOrder);
     
     if (deductFromBudget(total)) {
+        SalesLedger::getInstance()->recordOrder(finalOrder, this, processor);
         std::cout << "Purchase successful! Thank you for shopping with us.\n";
         clearCart();
     }
+    // The checkout is the commit point: the sale, payment and cart transfers become durable together
+    TransactionJournal::getInstance()->commit();
     
     delete processor;
     delete finalOrder;
@@ -171,9 +179,12 @@ void WalkInCustomer::checkOut() {
     processor->processTransaction(finalOrder);
     
     if (deductFromBudget(total)) {
+        SalesLedger::getInstance()->recordOrder(finalOrder, this, processor);
         std::cout << "Purchase complete! Have a great day.\n";
         clearCart();
     }
+    // The checkout is the commit point: the sale, payment and cart transfers become durable together
+    TransactionJournal::getInstance()->commit();
     
     delete processor;
     delete finalOrder;
@@ -17,8 +17,16 @@ FertilizeObserver::~FertilizeObserver() {
 }
 
 void FertilizeObserver::update(Plant* plant) {
-    if (plant->getNutrientLevel() < 30) {
+    if (plant->getNutrientLevel() < PlantTraits::LOW_NUTRIENTS) {
         Command* cmd = new FertilizePlantCommand(plant);
         scheduler_->addTask(cmd);
     }
 }
+
+void FertilizeObserver::updateBatch(Plant* const* plants, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (plants[i]->getNutrientLevel() < PlantTraits::LOW_NUTRIENTS) {
+            scheduler_->addTask(new FertilizePlantCommand(plants[i]));
+        }
+    }
+}
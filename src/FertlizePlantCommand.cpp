@@ -1,6 +1,7 @@
 #include "include/FertilizePlantCommand.h"
 #include "include/Plant.h"
 #include "include/CareStrategy.h"
+#include "include/TransactionJournal.h"
 #include <iostream>
 
 FertilizePlantCommand::FertilizePlantCommand(Plant* target) 
@@ -12,5 +13,15 @@ FertilizePlantCommand::FertilizePlantCommand(Plant* target)
 void FertilizePlantCommand::execute() {
     if (target_ != nullptr && target_->getStrategy() != nullptr) {
         target_->getStrategy()->fertilize(target_);
+        TransactionJournal::getInstance()->recordCare(target_, CareAction::Fertilize);
     }
-}
\ No newline at end of file
+}
+
+Plant* FertilizePlantCommand::getTarget() const {
+    return target_;
+}
+
+bool FertilizePlantCommand::getCareAction(CareAction& action) const {
+    action = CareAction::Fertilize;
+    return true;
+}
@@ -3,15 +3,16 @@
 #include "include/Iterator.h"
 #include "include/ConcreteIterator.h"
 #include "include/ConcreteOrder.h"
+#include "include/DirtyEpoch.h"
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 
 FinalOrder::FinalOrder(const std::string& name)
-    : customerName(name), totalPrice(0.0) {}
+    : customerName(name), totalPrice(0.0), dirtyEpoch(DirtyEpoch::current()) {}
 
 FinalOrder::FinalOrder(const FinalOrder& other)
-    : customerName(other.customerName), totalPrice(other.totalPrice) {
+    : customerName(other.customerName), totalPrice(other.totalPrice), dirtyEpoch(DirtyEpoch::current()) {
     for (auto* o : other.orderList) {
         if (o) {
             orderList.push_back(o->clone());
@@ -43,9 +44,22 @@ void FinalOrder::addOrder(Order* order) {
     if (order) {
         orderList.push_back(order);
         totalPrice += order->getPrice();
+        dirtyEpoch = DirtyEpoch::current();
     }
 }
 
+const std::vector<Order*>& FinalOrder::getOrders() const {
+    return orderList;
+}
+
+std::string FinalOrder::getCustomerName() const {
+    return customerName;
+}
+
+uint32_t FinalOrder::getDirtyEpoch() const {
+    return dirtyEpoch;
+}
+
 double FinalOrder::calculateTotalPrice() const {
     double total = 0.0;
     
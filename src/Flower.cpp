@@ -3,27 +3,21 @@
 Flower::Flower(const std::string& name, const std::string& id,
                CareStrategy* careStrategy, PlantState* initialState)
     : Plant(name, id, careStrategy, initialState) {
-    setPrice(25.0);
+    setSpecies(FlowerTraits::SPECIES);
+    setPrice(FlowerTraits::BASE_PRICE);
 }
 
 Flower::~Flower() {
 }
 
-void Flower::dailyUpdate() {
-    incrementAge();
-    
+int Flower::getDailyWaterLoss() const {
     // Flowers lose water FASTER (blooming takes energy)
-    setWaterLevel(getWaterLevel() - 15);
-    
+    return FlowerTraits::DAILY_WATER_LOSS;
+}
+
+int Flower::getDailyNutrientLoss() const {
     // Flowers need more nutrients
-    setNutrientLevel(getNutrientLevel() - 8);
-    
-    updateHealth();
-    notify();
-    
-    if (getState() != nullptr) {
-        getState()->handleChange(this);
-    }
+    return FlowerTraits::DAILY_NUTRIENT_LOSS;
 }
 
 std::string Flower::toString() const {
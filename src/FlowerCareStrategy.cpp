@@ -1,13 +1,16 @@
 #include "include/FlowerCareStrategy.h"
 #include "include/Plant.h"
+#include "include/SpeciesKernel.h"
 #include <iostream>
 
-
-
+FlowerCareStrategy* FlowerCareStrategy::getInstance() {
+    static FlowerCareStrategy instance;
+    return &instance;
+}
 
 void FlowerCareStrategy::water(Plant* plant) {
     // Flowers need specific moisture levels
-    plant->setWaterLevel(plant->getWaterLevel() + 50);
+    plant->setWaterLevel(plant->getWaterLevel() + FlowerTraits::WATER_GAIN);
     std::cout << "Watering flower - maintaining optimal moisture" << std::endl;
     (void)plant;
 }
@@ -15,14 +18,14 @@ void FlowerCareStrategy::water(Plant* plant) {
 
 void FlowerCareStrategy::fertilize(Plant* plant) {
     // Flowers need balanced fertilizer for blooms
-    plant->setNutrientLevel(plant->getNutrientLevel() + 20);
+    plant->setNutrientLevel(plant->getNutrientLevel() + FlowerTraits::NUTRIENT_GAIN);
     std::cout << "Fertilizing flower - bloom-boosting nutrients" << std::endl;
 }
 
 
 void FlowerCareStrategy::adjustSunlight(Plant* plant) {
     // Flowers need moderate to high sunlight
-    plant->setSunlightExposure(70);
+    plant->setSunlightExposure(FlowerTraits::SUNLIGHT_TARGET);
     std::cout << "Adjusting flower sunlight - optimal light for blooming" << std::endl;
 }
 
@@ -30,4 +33,9 @@ void FlowerCareStrategy::adjustSunlight(Plant* plant) {
 void FlowerCareStrategy::prune(Plant* plant) {
     std::cout << "Pruning flower - deadheading spent blooms" << std::endl;
     (void)plant;
-}
\ No newline at end of file
+}
+
+void FlowerCareStrategy::careForBatch(CareAction action, Plant* const* plants, size_t count) {
+    SpeciesKernel<FlowerTraits>::care(action, plants, count);
+    std::cout << "Caring for " << count << " flowers in one batch" << std::endl;
+}
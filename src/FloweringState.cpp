@@ -2,10 +2,11 @@
 #include "include/MatureState.h"
 #include "include/DeadState.h"
 #include "include/Plant.h"
+#include "include/SpeciesTraits.h"
 #include <iostream>
 
 
-FloweringState::FloweringState() {
+FloweringState::FloweringState() : PlantState(LifecycleStage::Flowering) {
     std::cout << "Plant entered Flowering state!" << std::endl;
 }
 
@@ -19,7 +20,7 @@ void FloweringState::handleChange(Plant* plant) {
     int health = plant->getHealthLevel();
     
     // Check if plant has died due to poor health
-    if (health < 10) {
+    if (health < LifecycleTraits::ADULT_DIES_BELOW) {
         std::cout << "Flowering plant " << plant->getID() << " has died due to poor health." << std::endl;
         plant->setState(new DeadState());
         //delete this;
@@ -30,12 +31,12 @@ void FloweringState::handleChange(Plant* plant) {
     plant->setReadyForSale(true);
     
     // Apply premium pricing for flowering plants
-    if (plant->getPrice() < 15.0) {
-        plant->setPrice(plant->getPrice() * 1.5);
+    if (plant->getPrice() < LifecycleTraits::BLOOM_PRICE_CAP) {
+        plant->setPrice(plant->getPrice() * LifecycleTraits::BLOOM_PRICE_MULTIPLIER);
     }
     
     // Check if flowering period is over
-    if (age >= 50) {
+    if (age >= LifecycleTraits::FLOWERING_ENDS_AT_AGE) {
         std::cout << "Flowering plant " << plant->getID() << " has finished blooming... transitioning back to Mature state." << std::endl;
         plant->setState(new MatureState());
        // delete this;
@@ -1,32 +1,23 @@
 
 #include "../include/Greenhouse.h"
 #include "../include/Plant.h"
+#include "../include/TransactionJournal.h"
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
-Greenhouse::Greenhouse(NurseryMediator* med, int numRows, int numCols): Colleague(med), currentNumberOfPlants(0), rows(numRows), cols(numCols) {
+Greenhouse::Greenhouse(NurseryMediator* med, int numRows, int numCols, GridStorage storage): Colleague(med), plantGrid(numRows, numCols, storage), currentNumberOfPlants(0), rows(numRows), cols(numCols), changeCount(0) {
     
     capacity = rows * cols;
-    plantGrid.resize(rows);
-
-    for(int i = 0; i < rows; i++){
-        plantGrid[i].resize(cols, nullptr);
-    }
     
     std::cout << "Greenhouse created with " << rows << "x" << cols << " grid\n";
 }
 
 Greenhouse::~Greenhouse(){
     // Delete all plants still in greenhouse
-    for(int i = 0; i < rows; i++){
-        for(int j = 0; j < cols; j++){
-            if(plantGrid[i][j] != nullptr){
-                delete plantGrid[i][j];
-                plantGrid[i][j] = nullptr;
-            }
-        }
-        plantGrid[i].clear();
-    }
+    plantGrid.forEachPlant([](Plant* plant, int, int){
+        delete plant;
+    });
     plantGrid.clear();
 }
 
@@ -43,7 +34,7 @@ bool Greenhouse::addPlant(Plant* plant, int row, int col){
         return false;
     }
     
-    if(plantGrid[row][col] != nullptr){
+    if(plantGrid.getPlantAt(row, col) != nullptr){
         std::cout << "Position (" << row << "," << col << ") is occupied\n";
 
         return false;
@@ -55,8 +46,11 @@ bool Greenhouse::addPlant(Plant* plant, int row, int col){
         return false;
     }
     
-    plantGrid[row][col] = plant;
+    plantGrid.setPlantAt(row, col, plant);
     currentNumberOfPlants++;
+    indexPlant(plant, row, col);
+    changeCount++;
+    TransactionJournal::getInstance()->recordAddition(plant, JournalLocation::Greenhouse, row, col);
     
     std::cout << "Plant '" << plant->getName() << "' (ID: " << plant->getID() << ") was added to greenhouse at (" << row << "," << col << ")\n";
 
@@ -67,30 +61,60 @@ bool Greenhouse::addPlant(Plant* plant, int row, int col){
     return true;
 }
 
+size_t Greenhouse::addPlants(PlantPlacement* placements, size_t count){
+    size_t placed = 0;
+
+    for(size_t i = 0; i < count; i++){
+        PlantPlacement& placement = placements[i];
+        placement.placed = placement.plant != nullptr &&
+                           plantGrid.isInBounds(placement.row, placement.col) &&
+                           plantGrid.getPlantAt(placement.row, placement.col) == nullptr &&
+                           !isFull();
+        if(!placement.placed){
+            continue;
+        }
+
+        plantGrid.setPlantAt(placement.row, placement.col, placement.plant);
+        currentNumberOfPlants++;
+        indexPlant(placement.plant, placement.row, placement.col);
+        TransactionJournal::getInstance()->recordAddition(placement.plant, JournalLocation::Greenhouse,
+                                                          placement.row, placement.col);
+        placed++;
+    }
+
+    if(placed > 0){
+        changeCount++;
+
+        if(mediator != nullptr){
+            mediator->notify(this);
+        }
+    }
+
+    return placed;
+}
+
 bool Greenhouse::removePlant(Plant* plant) {
     if(plant == nullptr){
         return false;
     }
+
+    auto slot = plantSlots.find(plant);
+    if(slot == plantSlots.end()){
+        return false;
+    }
+
+    plantGrid.setPlantAt(slot->second.row, slot->second.col, nullptr);
+    unindexPlant(plant);
+    currentNumberOfPlants--;
+    changeCount++;
     
-    for(int i = 0; i < rows; i++){
-        for(int j = 0; j < cols; j++){
-
-            if(plantGrid[i][j] == plant){
-                plantGrid[i][j] = nullptr;
-                currentNumberOfPlants--;
-                
-                std::cout << "Plant '" << plant->getName() << "' (ID: " << plant->getID() << ") removed from the greenhouse\n";
-                
-                if(mediator != nullptr){
-                    mediator->notify(this);
-                }
-                
-                return true;
-            }
-        }
+    std::cout << "Plant '" << plant->getName() << "' (ID: " << plant->getID() << ") removed from the greenhouse\n";
+    
+    if(mediator != nullptr){
+        mediator->notify(this);
     }
     
-    return false;
+    return true;
 }
 
 Plant* Greenhouse::removePlantAt(int row, int col){
@@ -98,11 +122,13 @@ Plant* Greenhouse::removePlantAt(int row, int col){
         return nullptr;
     }
     
-    Plant* plant = plantGrid[row][col];
+    Plant* plant = plantGrid.getPlantAt(row, col);
     
     if(plant != nullptr){
-        plantGrid[row][col] = nullptr;
+        plantGrid.setPlantAt(row, col, nullptr);
+        unindexPlant(plant);
         currentNumberOfPlants--;
+        changeCount++;
         
         std::cout << "Plant removed from greenhouse at (" << row << "," << col << ")\n";
         
@@ -115,14 +141,9 @@ Plant* Greenhouse::removePlantAt(int row, int col){
 }
 
 Plant* Greenhouse::findPlant(std::string plantName){
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++){
-
-            Plant* plant = plantGrid[i][j];
-
-            if(plant != nullptr && (plant->getName() == plantName)){
-                return plant;
-            }
+    for (Plant* plant : plantGrid.getAll()) {
+        if(plant->getName() == plantName){
+            return plant;
         }
     }
 
@@ -130,21 +151,13 @@ Plant* Greenhouse::findPlant(std::string plantName){
 }
 
 Plant* Greenhouse::getPlantAt(int row, int col)const{
-    if(row < 0 || row >= rows || col < 0 || col >= cols){
-        return nullptr;
-    }
-    return plantGrid[row][col];
+    return plantGrid.getPlantAt(row, col);
 }
 
 bool Greenhouse::hasPlant(std::string plantName)const{
-    for(int i = 0; i < rows; i++){
-        for(int j = 0; j < cols; j++){
-
-            Plant* plant = plantGrid[i][j];
-
-            if(plant != nullptr && (plant->getName() == plantName)){
-                return true;
-            }
+    for(Plant* plant : plantGrid.getAll()){
+        if(plant->getName() == plantName){
+            return true;
         }
     }
 
@@ -152,18 +165,7 @@ bool Greenhouse::hasPlant(std::string plantName)const{
 }
 
 std::vector<Plant*> Greenhouse::getAllPlants()const{
-    std::vector<Plant*> allPlants;
-    
-    for(int i = 0; i < rows; i++){ // flattening grid into a vector
-        for(int j = 0; j < cols; j++){
-
-            if(plantGrid[i][j] != nullptr){
-                allPlants.push_back(plantGrid[i][j]);
-            }
-        }
-    }
-    
-    return allPlants;
+    return plantGrid.getAll().toVector();
 }
 
 int Greenhouse::getNumberOfPlants()const{
@@ -179,37 +181,11 @@ bool Greenhouse::isFull()const{
 }
 
 std::vector<Plant*> Greenhouse::getPlantsInRow(int row)const{
-    std::vector<Plant*> rowPlants;
-    
-    if(row < 0 || row >= rows){
-        return rowPlants;
-    }
-    
-    for(int j = 0; j < cols; j++){
-
-        if(plantGrid[row][j] != nullptr){
-            rowPlants.push_back(plantGrid[row][j]);
-        }
-    }
-    
-    return rowPlants;
+    return plantGrid.getRow(row).toVector();
 }
 
 std::vector<Plant*> Greenhouse::getPlantsInColumn(int col)const{
-    std::vector<Plant*> colPlants;
-    
-    if(col < 0 || col >= cols){
-        return colPlants;
-    }
-    
-    for(int i = 0; i < rows; i++){
-
-        if(plantGrid[i][col] != nullptr){
-            colPlants.push_back(plantGrid[i][col]);
-        }
-    }
-    
-    return colPlants;
+    return plantGrid.getColumn(col).toVector();
 }
 
 int Greenhouse::getRows()const{
@@ -221,11 +197,215 @@ int Greenhouse::getColumns()const{
 }
 
 bool Greenhouse::isPositionEmpty(int row, int col)const{
-    if(row < 0 || row >= rows || col < 0 || col >= cols){
+    if(!plantGrid.isInBounds(row, col)){
         return false;
     }
     
-    return plantGrid[row][col] == nullptr;
+    return plantGrid.getPlantAt(row, col) == nullptr;
+}
+
+const PlantGrid& Greenhouse::getGrid()const{
+    return plantGrid;
+}
+
+void Greenhouse::markChanged(){
+    changeCount++;
+}
+
+uint64_t Greenhouse::getChangeCount()const{
+    return changeCount;
+}
+
+bool Greenhouse::defineZone(const std::string& name, const GridRegion& region){
+    GridRegion clipped = plantGrid.clip(region);
+    if(clipped.rowCount == 0 || clipped.colCount == 0){
+        std::cout << "Zone '" << name << "' lies outside the greenhouse\n";
+        return false;
+    }
+
+    zones[name] = clipped;
+    return true;
+}
+
+bool Greenhouse::getZone(const std::string& name, GridRegion& region) const{
+    auto it = zones.find(name);
+    if(it == zones.end()){
+        return false;
+    }
+
+    region = it->second;
+    return true;
+}
+
+bool Greenhouse::removeZone(const std::string& name){
+    return zones.erase(name) > 0;
+}
+
+void Greenhouse::reservePlants(size_t plantCount){
+    plantSlots.reserve(plantCount);
+}
+
+int Greenhouse::stateBucketFor(const std::string& stateName){
+    if(stateName == "Seedling") return 0;
+    if(stateName == "Growing") return 1;
+    if(stateName == "Mature") return 2;
+    if(stateName == "Flowering") return 3;
+    if(stateName == "Dead") return 4;
+    return STATE_BUCKET_COUNT - 1;
+}
+
+int Greenhouse::stateBucketFor(const Plant* plant){
+    if(plant->getState() == nullptr){
+        return STATE_BUCKET_COUNT - 1;
+    }
+    // Buckets follow LifecycleStage order, with Other last
+    static_assert(static_cast<int>(LifecycleStage::Other) == STATE_BUCKET_COUNT - 1, "one bucket per stage");
+    return static_cast<int>(plant->getState()->getStage());
+}
+
+void Greenhouse::indexPlant(Plant* plant, int row, int col){
+    PlantSlot& slot = plantSlots[plant];
+    slot.row = row;
+    slot.col = col;
+
+    slot.stateBucket = stateBucketFor(plant);
+    slot.stateIndex = stateBuckets[slot.stateBucket].size();
+    stateBuckets[slot.stateBucket].push_back(plant);
+
+    slot.ready = plant->isReadyForSale();
+    if(slot.ready){
+        readyPlants.emplace(cellKey(slot), plant);
+    }
+
+    speciesCounts[plant->getName()]++;
+    plant->setStateListener(this);
+}
+
+void Greenhouse::unindexPlant(Plant* plant){
+    auto it = plantSlots.find(plant);
+    if(it == plantSlots.end()){
+        return;
+    }
+
+    eraseFromStateBucket(it->second);
+    if(it->second.ready){
+        eraseFromReady(it->second);
+    }
+
+    auto species = speciesCounts.find(plant->getName());
+    if(species != speciesCounts.end() && --species->second == 0){
+        speciesCounts.erase(species);
+    }
+
+    if(plant->getStateListener() == this){
+        plant->setStateListener(nullptr);
+    }
+    plantSlots.erase(it);
+}
+
+void Greenhouse::eraseFromStateBucket(PlantSlot& slot){
+    std::vector<Plant*>& bucket = stateBuckets[slot.stateBucket];
+    Plant* moved = bucket.back();
+    bucket[slot.stateIndex] = moved;
+    plantSlots[moved].stateIndex = slot.stateIndex;
+    bucket.pop_back();
+}
+
+void Greenhouse::eraseFromReady(PlantSlot& slot){
+    readyPlants.erase(cellKey(slot));
+    slot.ready = false;
+}
+
+long long Greenhouse::cellKey(const PlantSlot& slot) const{
+    return static_cast<long long>(slot.row) * cols + slot.col;
+}
+
+std::vector<Plant*> Greenhouse::inGridOrder(std::vector<Plant*> plants) const{
+    std::sort(plants.begin(), plants.end(), [this](Plant* a, Plant* b){
+        const PlantSlot& slotA = plantSlots.at(a);
+        const PlantSlot& slotB = plantSlots.at(b);
+        if(slotA.row != slotB.row){
+            return slotA.row < slotB.row;
+        }
+        return slotA.col < slotB.col;
+    });
+    return plants;
+}
+
+void Greenhouse::plantStatusChanged(Plant* plant){
+    auto it = plantSlots.find(plant);
+    if(it == plantSlots.end()){
+        return;
+    }
+    PlantSlot& slot = it->second;
+
+    int bucket = stateBucketFor(plant);
+    if(bucket != slot.stateBucket){
+        eraseFromStateBucket(slot);
+        slot.stateBucket = bucket;
+        slot.stateIndex = stateBuckets[bucket].size();
+        stateBuckets[bucket].push_back(plant);
+    }
+
+    bool ready = plant->isReadyForSale();
+    if(ready && !slot.ready){
+        slot.ready = true;
+        readyPlants.emplace(cellKey(slot), plant);
+    }
+    else if(!ready && slot.ready){
+        eraseFromReady(slot);
+    }
+}
+
+int Greenhouse::getStateCount(const std::string& stateName) const{
+    return static_cast<int>(stateBuckets[stateBucketFor(stateName)].size());
+}
+
+std::vector<Plant*> Greenhouse::getPlantsInState(const std::string& stateName) const{
+    return inGridOrder(stateBuckets[stateBucketFor(stateName)]);
+}
+
+std::vector<Plant*> Greenhouse::getReadyPlants() const{
+    std::vector<Plant*> plants;
+    plants.reserve(readyPlants.size());
+    for(const auto& ready : readyPlants){
+        plants.push_back(ready.second);
+    }
+    return plants;
+}
+
+int Greenhouse::getReadyCount() const{
+    return static_cast<int>(readyPlants.size());
+}
+
+int Greenhouse::getSpeciesCount(const std::string& plantName) const{
+    auto it = speciesCounts.find(plantName);
+    return it != speciesCounts.end() ? it->second : 0;
+}
+
+int Greenhouse::removeDeadPlants(){
+    std::vector<Plant*> deadPlants = stateBuckets[stateBucketFor("Dead")];
+
+    for(Plant* plant : deadPlants){
+        const PlantSlot& slot = plantSlots.at(plant);
+        plantGrid.setPlantAt(slot.row, slot.col, nullptr);
+        unindexPlant(plant);
+        currentNumberOfPlants--;
+        TransactionJournal::getInstance()->recordDiscard(plant);
+        delete plant;
+    }
+
+    int removed = static_cast<int>(deadPlants.size());
+    if(removed > 0){
+        changeCount++;
+        std::cout << "Removed " << removed << " dead plant(s) from the greenhouse\n";
+
+        if(mediator != nullptr){
+            mediator->notify(this);
+        }
+    }
+
+    return removed;
 }
 
 std::string Greenhouse::toString() const {
@@ -238,18 +418,13 @@ std::string Greenhouse::toString() const {
         output << "Greenhouse is empty.\n";
     } else {
         output << "Plants in Greenhouse:\n";
-        for (int i = 0; i < rows; i++) {
-            for (int j = 0; j < cols; j++) {
-                Plant* plant = plantGrid[i][j];
-                if (plant != nullptr) {
-                    output << "  Position (" << i << "," << j << "): "
-                           << plant->getName() << " (ID: " << plant->getID() << ") - "
-                           << plant->getState()->getStateName() << " - "
-                           << (plant->isReadyForSale() ? "Ready for sale" : "Still growing")
-                           << "\n";
-                }
-            }
-        }
+        plantGrid.forEachPlant([&output](Plant* plant, int i, int j) {
+            output << "  Position (" << i << "," << j << "): "
+                   << plant->getName() << " (ID: " << plant->getID() << ") - "
+                   << plant->getState()->getStateName() << " - "
+                   << (plant->isReadyForSale() ? "Ready for sale" : "Still growing")
+                   << "\n";
+        });
     }
     
     return output.str();
@@ -2,10 +2,11 @@
 #include "include/MatureState.h"
 #include "include/DeadState.h"
 #include "include/Plant.h"
+#include "include/SpeciesTraits.h"
 #include <iostream>
 
 
-GrowingState::GrowingState() {
+GrowingState::GrowingState() : PlantState(LifecycleStage::Growing) {
     std::cout << "Plant entered Growing state." << std::endl;
 }
 
@@ -19,14 +20,14 @@ void GrowingState::handleChange(Plant* plant) {
     int health = plant->getHealthLevel();
     
     // Check if plant has died due to poor health
-    if (health < 20) {
+    if (health < LifecycleTraits::YOUNG_DIES_BELOW) {
         std::cout << "Growing plant " << plant->getID() << " has died due to poor health." << std::endl;
         plant->setState(new DeadState());
         return;
     }
     
     // Check if plant is ready to transition to Mature state
-    if (age >= 12 && health >= 50) {
+    if (age >= LifecycleTraits::GROWING_MATURES_AT_AGE && health >= LifecycleTraits::GROWS_AT_HEALTH) {
         std::cout << "Plant " << plant->getID() << " is maturing... transitioning to Mature state." << std::endl;
         plant->setState(new MatureState());
         return;
@@ -0,0 +1,344 @@
+#include "include/InventoryImporter.h"
+#include "include/Plant.h"
+#include "include/PlantState.h"
+#include "include/RoseFactory.h"
+#include "include/DaisyFactory.h"
+#include "include/StrelitziaFactory.h"
+#include "include/CactusFactory.h"
+#include "include/AloeFactory.h"
+#include "include/PotatoFactory.h"
+#include "include/RadishFactory.h"
+#include "include/CarrotFactory.h"
+#include "include/MonsteraFactory.h"
+#include "include/VenusFlyTrapFactory.h"
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+/**
+ * @brief Swallows console output while a manifest is imported.
+ *
+ * The factories, the states they create and the state changes each print a
+ * line per plant; for a large manifest that costs more than the import.
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+class QuietScope {
+public:
+    QuietScope() : saved(std::cout.rdbuf(&sink)) {}
+    ~QuietScope() { std::cout.rdbuf(saved); }
+
+private:
+    NullBuffer sink;
+    std::streambuf* saved;
+};
+
+/**
+ * @brief Species names, already folded as sameSpecies() compares them, and their factories.
+ */
+struct SpeciesRoute {
+    const char* name;
+    const PlantFactory* factory;
+};
+
+const RoseFactory roseFactory{};
+const DaisyFactory daisyFactory{};
+const StrelitziaFactory strelitziaFactory{};
+const CactusFactory cactusFactory{};
+const AloeFactory aloeFactory{};
+const PotatoFactory potatoFactory{};
+const RadishFactory radishFactory{};
+const CarrotFactory carrotFactory{};
+const MonsteraFactory monsteraFactory{};
+const VenusFlyTrapFactory venusFlyTrapFactory{};
+
+const SpeciesRoute SPECIES_ROUTES[] = {
+    {"rose", &roseFactory},         {"daisy", &daisyFactory},
+    {"strelitzia", &strelitziaFactory}, {"cactus", &cactusFactory},
+    {"aloe", &aloeFactory},         {"potato", &potatoFactory},
+    {"radish", &radishFactory},     {"carrot", &carrotFactory},
+    {"monstera", &monsteraFactory}, {"venusflytrap", &venusFlyTrapFactory}
+};
+
+bool isSeparator(char c) {
+    return c == ' ' || c == '_' || c == '-';
+}
+
+/**
+ * @brief Compares a manifest species name with a folded name.
+ */
+bool sameSpecies(std::string_view text, const char* folded) {
+    for (char c : text) {
+        if (isSeparator(c)) {
+            continue;
+        }
+        if (*folded == '\0' || std::tolower(static_cast<unsigned char>(c)) != *folded) {
+            return false;
+        }
+        folded++;
+    }
+    return *folded == '\0';
+}
+
+std::string_view trim(std::string_view field) {
+    while (!field.empty() && std::isspace(static_cast<unsigned char>(field.front()))) {
+        field.remove_prefix(1);
+    }
+    while (!field.empty() && std::isspace(static_cast<unsigned char>(field.back()))) {
+        field.remove_suffix(1);
+    }
+    return field;
+}
+
+template <typename Number>
+bool parseNumber(std::string_view field, Number& value) {
+    const char* end = field.data() + field.size();
+    std::from_chars_result result = std::from_chars(field.data(), end, value);
+    return !field.empty() && result.ec == std::errc() && result.ptr == end;
+}
+
+/**
+ * @brief Splits a line into fields without copying it.
+ * @return Number of fields, or -1 for an unterminated quote or too many fields.
+ */
+int splitFields(const char* begin, const char* end, std::string_view* fields, int maxFields) {
+    int count = 0;
+    const char* cursor = begin;
+    while (true) {
+        if (count == maxFields) {
+            return -1;
+        }
+        const char* start = cursor;
+        while (start < end && *start == ' ') {
+            start++;
+        }
+        const char* stop;
+        if (start < end && *start == '"') {
+            const char* close = static_cast<const char*>(std::memchr(start + 1, '"', end - start - 1));
+            if (close == nullptr) {
+                return -1;
+            }
+            fields[count++] = std::string_view(start + 1, close - start - 1);
+            stop = static_cast<const char*>(std::memchr(close, ',', end - close));
+        } else {
+            stop = static_cast<const char*>(std::memchr(cursor, ',', end - cursor));
+            fields[count++] = trim(std::string_view(cursor, (stop ? stop : end) - cursor));
+        }
+        if (stop == nullptr) {
+            return count;
+        }
+        cursor = stop + 1;
+    }
+}
+
+} // namespace
+
+InventoryImporter::InventoryImporter(Greenhouse* greenhouse, CareScheduler* scheduler, size_t chunkBytes)
+    : greenhouse_(greenhouse), scheduler_(scheduler), buffer_(chunkBytes > 0 ? chunkBytes : DEFAULT_CHUNK_BYTES),
+      line_(0), skipping_(false), imported_(0), rejected_(0) {
+    batch_.reserve(BATCH_SIZE);
+    batchLines_.reserve(BATCH_SIZE);
+}
+
+bool InventoryImporter::importFile(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    if (!in) {
+        error_ = "Cannot open " + path;
+        std::cout << "[InventoryImporter] " << error_ << "\n";
+        return false;
+    }
+    return importStream(in);
+}
+
+bool InventoryImporter::importStream(std::istream& in) {
+    line_ = 0;
+    skipping_ = false;
+    imported_ = 0;
+    rejected_ = 0;
+    rowErrors_.clear();
+    error_.clear();
+    if (greenhouse_ == nullptr) {
+        error_ = "No greenhouse to import into";
+        std::cout << "[InventoryImporter] " << error_ << "\n";
+        return false;
+    }
+
+    {
+        QuietScope quiet;
+        size_t filled = 0;
+        bool more = true;
+        while (more) {
+            in.read(buffer_.data() + filled, static_cast<std::streamsize>(buffer_.size() - filled));
+            filled += static_cast<size_t>(in.gcount());
+            more = static_cast<bool>(in);
+
+            size_t consumed = parseLines(buffer_.data(), filled, !more);
+            if (consumed == 0 && filled == buffer_.size()) {
+                // One line fills the whole buffer; skip the rest of it
+                rejectRow(++line_, "line is longer than the read buffer");
+                skipping_ = true;
+                filled = 0;
+                continue;
+            }
+            std::memmove(buffer_.data(), buffer_.data() + consumed, filled - consumed);
+            filled -= consumed;
+        }
+        flushBatch();
+    }
+
+    if (in.bad()) {
+        error_ = "Read failed after line " + std::to_string(line_);
+        std::cout << "[InventoryImporter] " << error_ << "\n";
+        return false;
+    }
+    std::cout << "[InventoryImporter] Imported " << imported_ << " plants, skipped " << rejected_ << " rows\n";
+    return true;
+}
+
+size_t InventoryImporter::parseLines(const char* data, size_t size, bool final) {
+    size_t position = 0;
+    if (skipping_) {
+        const char* newline = static_cast<const char*>(std::memchr(data, '\n', size));
+        if (newline == nullptr) {
+            return size;
+        }
+        position = static_cast<size_t>(newline - data) + 1;
+        skipping_ = false;
+    }
+
+    while (position < size) {
+        const char* start = data + position;
+        const char* newline = static_cast<const char*>(std::memchr(start, '\n', size - position));
+        if (newline == nullptr) {
+            if (final) {
+                parseLine(start, data + size);
+                position = size;
+            }
+            break;
+        }
+        parseLine(start, newline);
+        position = static_cast<size_t>(newline - data) + 1;
+    }
+    return position;
+}
+
+void InventoryImporter::parseLine(const char* begin, const char* end) {
+    size_t line = ++line_;
+    if (trim(std::string_view(begin, end - begin)).empty()) {
+        return;
+    }
+
+    std::string_view fields[FIELD_COUNT];
+    if (splitFields(begin, end, fields, FIELD_COUNT) != FIELD_COUNT) {
+        rejectRow(line, "expected 9 fields: species,id,age,water,sunlight,nutrients,price,row,col");
+        return;
+    }
+    if (line == 1 && sameSpecies(fields[0], "species")) {
+        return;
+    }
+
+    const PlantFactory* factory = factoryFor(fields[0]);
+    if (factory == nullptr) {
+        rejectRow(line, "unknown species");
+        return;
+    }
+
+    int age;
+    int water;
+    int sunlight;
+    int nutrients;
+    double price;
+    int row;
+    int col;
+    if (!parseNumber(fields[2], age) || !parseNumber(fields[3], water) ||
+        !parseNumber(fields[4], sunlight) || !parseNumber(fields[5], nutrients) ||
+        !parseNumber(fields[6], price) || !parseNumber(fields[7], row) || !parseNumber(fields[8], col)) {
+        rejectRow(line, "field is not a number");
+        return;
+    }
+    if (age < 0 || price < 0) {
+        rejectRow(line, "age and price cannot be negative");
+        return;
+    }
+
+    Plant* plant = factory->buildPlant(scheduler_);
+    if (!fields[1].empty()) {
+        plant->plantID.assign(fields[1].data(), fields[1].size());
+    }
+    plant->age = age;
+    plant->setWaterLevel(water);
+    plant->setSunlightExposure(sunlight);
+    plant->setNutrientLevel(nutrients);
+    plant->updateHealth();
+    plant->setPrice(price);
+
+    // Each state moves on at most one step per check; Seedling to Flowering takes three
+    for (int step = 0; step < 4 && plant->state != nullptr; step++) {
+        PlantState* before = plant->state;
+        before->handleChange(plant);
+        if (plant->state == before) {
+            break;
+        }
+    }
+
+    batch_.push_back(PlantPlacement{plant, row, col, false});
+    batchLines_.push_back(line);
+    if (batch_.size() >= BATCH_SIZE) {
+        flushBatch();
+    }
+}
+
+void InventoryImporter::flushBatch() {
+    if (batch_.empty()) {
+        return;
+    }
+    imported_ += greenhouse_->addPlants(batch_.data(), batch_.size());
+    for (size_t i = 0; i < batch_.size(); i++) {
+        if (!batch_[i].placed) {
+            delete batch_[i].plant;
+            rejectRow(batchLines_[i], "cell is taken or outside the greenhouse");
+        }
+    }
+    batch_.clear();
+    batchLines_.clear();
+}
+
+void InventoryImporter::rejectRow(size_t line, const char* reason) {
+    rejected_++;
+    if (rowErrors_.size() < MAX_ROW_ERRORS) {
+        rowErrors_.push_back("line " + std::to_string(line) + ": " + reason);
+    }
+}
+
+const PlantFactory* InventoryImporter::factoryFor(std::string_view species) {
+    for (const SpeciesRoute& route : SPECIES_ROUTES) {
+        if (sameSpecies(species, route.name)) {
+            return route.factory;
+        }
+    }
+    return nullptr;
+}
+
+size_t InventoryImporter::getImportedCount() const {
+    return imported_;
+}
+
+size_t InventoryImporter::getRejectedCount() const {
+    return rejected_;
+}
+
+const std::vector<std::string>& InventoryImporter::getRowErrors() const {
+    return rowErrors_;
+}
+
+const std::string& InventoryImporter::getError() const {
+    return error_;
+}
@@ -0,0 +1,191 @@
+#include "include/JournalReplay.h"
+#include "include/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+namespace {
+
+std::string textOf(const char* field) {
+    return std::string(field, strnlen(field, JournalRecord::TEXT_SIZE));
+}
+
+const char* locationName(JournalLocation location) {
+    switch (location) {
+        case JournalLocation::Greenhouse: return "Greenhouse";
+        case JournalLocation::SalesFloor: return "Sales floor";
+        case JournalLocation::Cart:       return "In carts";
+        case JournalLocation::Sold:       return "Sold";
+        default:                          return "Unknown";
+    }
+}
+
+} // namespace
+
+JournalReplay::JournalReplay() {
+    reset();
+}
+
+void JournalReplay::reset() {
+    plants_.clear();
+    carts_.clear();
+    sales_ = 0;
+    salesTotal_ = 0.0;
+    payments_ = 0;
+    paymentsTotal_ = 0.0;
+    std::fill(care_, care_ + CARE_ACTION_COUNT, 0);
+    records_ = 0;
+    damagedTail_ = false;
+    error_.clear();
+}
+
+bool JournalReplay::replay(const std::string& path) {
+    reset();
+
+    MappedFile file;
+    if (!file.open(path)) {
+        error_ = "cannot open " + path;
+        return false;
+    }
+
+    size_t count = file.size() / sizeof(JournalRecord);
+    damagedTail_ = file.size() % sizeof(JournalRecord) != 0;
+    for (size_t i = 0; i < count; i++) {
+        JournalRecord record;
+        std::memcpy(&record, file.data() + i * sizeof(JournalRecord), sizeof(record));
+        if (record.sequence != i || record.version != TransactionJournal::VERSION ||
+            record.checksum != TransactionJournal::checksum(record) ||
+            record.type > static_cast<uint8_t>(JournalRecordType::Discard)) {
+            damagedTail_ = true;
+            break;
+        }
+        apply(record);
+        records_++;
+    }
+    return true;
+}
+
+void JournalReplay::apply(const JournalRecord& record) {
+    JournalRecordType type = static_cast<JournalRecordType>(record.type);
+    switch (type) {
+        case JournalRecordType::Sale: {
+            sales_++;
+            salesTotal_ += record.amount;
+            auto cart = carts_.find(textOf(record.party));
+            if (cart != carts_.end()) {
+                for (const std::string& id : cart->second) {
+                    plants_[id].location = JournalLocation::Sold;
+                    plants_[id].customer.clear();
+                }
+                carts_.erase(cart);
+            }
+            break;
+        }
+        case JournalRecordType::Payment:
+            payments_++;
+            paymentsTotal_ += record.amount;
+            break;
+        case JournalRecordType::Transfer: {
+            std::string id = textOf(record.plantId);
+            std::string customer = textOf(record.party);
+            PlantEntry& plant = plants_[id];
+            plant.location = JournalLocation::Cart;
+            plant.customer = customer;
+            carts_[customer].push_back(id);
+            break;
+        }
+        case JournalRecordType::Relocation:
+        case JournalRecordType::Return: {
+            std::string id = textOf(record.plantId);
+            PlantEntry& plant = plants_[id];
+            if (plant.location == JournalLocation::Cart) {
+                std::vector<std::string>& cart = carts_[plant.customer];
+                cart.erase(std::remove(cart.begin(), cart.end(), id), cart.end());
+            }
+            plant.location = JournalLocation::SalesFloor;
+            plant.customer.clear();
+            break;
+        }
+        case JournalRecordType::Care:
+            if (record.detail < CARE_ACTION_COUNT) {
+                care_[record.detail]++;
+            }
+            break;
+        case JournalRecordType::Addition: {
+            PlantEntry& plant = plants_[textOf(record.plantId)];
+            plant.location = (record.detail == static_cast<uint8_t>(JournalLocation::SalesFloor))
+                                 ? JournalLocation::SalesFloor : JournalLocation::Greenhouse;
+            plant.customer.clear();
+            break;
+        }
+        case JournalRecordType::Discard:
+            plants_.erase(textOf(record.plantId));
+            break;
+    }
+}
+
+JournalLocation JournalReplay::getLocation(const std::string& plantId) const {
+    auto it = plants_.find(plantId);
+    return (it == plants_.end()) ? JournalLocation::Unknown : it->second.location;
+}
+
+size_t JournalReplay::getPlantCount(JournalLocation location) const {
+    size_t count = 0;
+    for (const auto& entry : plants_) {
+        if (entry.second.location == location) {
+            count++;
+        }
+    }
+    return count;
+}
+
+size_t JournalReplay::getSaleCount() const {
+    return sales_;
+}
+
+double JournalReplay::getSalesTotal() const {
+    return salesTotal_;
+}
+
+size_t JournalReplay::getPaymentCount() const {
+    return payments_;
+}
+
+double JournalReplay::getPaymentsTotal() const {
+    return paymentsTotal_;
+}
+
+size_t JournalReplay::getCareCount(CareAction action) const {
+    return care_[static_cast<int>(action)];
+}
+
+uint64_t JournalReplay::getRecordCount() const {
+    return records_;
+}
+
+bool JournalReplay::hasDamagedTail() const {
+    return damagedTail_;
+}
+
+const std::string& JournalReplay::getError() const {
+    return error_;
+}
+
+void JournalReplay::printSummary(std::ostream& out) const {
+    out << "Records replayed: " << records_;
+    if (damagedTail_) {
+        out << " (stopped at a damaged record)";
+    }
+    out << "\n" << std::fixed << std::setprecision(2);
+    out << "Sales:    " << sales_ << " totalling R" << salesTotal_ << "\n";
+    out << "Payments: " << payments_ << " totalling R" << paymentsTotal_ << "\n";
+    out << "Care:     " << care_[static_cast<int>(CareAction::Water)] << " watering, "
+        << care_[static_cast<int>(CareAction::Fertilize)] << " fertilizing, "
+        << care_[static_cast<int>(CareAction::AdjustSunlight)] << " sunlight\n";
+    out << "Plants the journal has seen, by last location:\n";
+    for (int i = 0; i < JOURNAL_LOCATION_COUNT; i++) {
+        JournalLocation location = static_cast<JournalLocation>(i);
+        out << "  " << std::left << std::setw(12) << locationName(location) << std::right
+            << getPlantCount(location) << "\n";
+    }
+}
@@ -0,0 +1,26 @@
+/**
+ * @file JournalReplayMain.cpp
+ * @brief Command-line tool that replays a transaction journal and prints what it adds up to.
+ *
+ * Run with: make replay JOURNAL=<journal file>
+ */
+#include <iostream>
+
+#include "include/JournalReplay.h"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <journal file>\n";
+        return 1;
+    }
+
+    JournalReplay replay;
+    if (!replay.replay(argv[1])) {
+        std::cout << "Replay failed: " << replay.getError() << "\n";
+        return 1;
+    }
+
+    std::cout << "=== JOURNAL " << argv[1] << " ===\n";
+    replay.printSummary(std::cout);
+    return 0;
+}
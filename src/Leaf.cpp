@@ -49,6 +49,10 @@ std::string Leaf::getName() const {
     return plant->getName();
 }
 
+Plant* Leaf::getPlant() const {
+    return plant;
+}
+
 Iterator* Leaf::createIterator() {
     return new ConcreteIterator(this);
 }
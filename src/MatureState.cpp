@@ -2,10 +2,11 @@
 #include "include/FloweringState.h"
 #include "include/DeadState.h"
 #include "include/Plant.h"
+#include "include/SpeciesTraits.h"
 #include <iostream>
 
 
-MatureState::MatureState() {
+MatureState::MatureState() : PlantState(LifecycleStage::Mature) {
     std::cout << "Plant entered Mature state - ready for sale!" << std::endl;
 }
 
@@ -19,7 +20,7 @@ void MatureState::handleChange(Plant* plant) {
     int health = plant->getHealthLevel();
     
     // Check if plant has died due to poor health
-    if (health < 10) {
+    if (health < LifecycleTraits::ADULT_DIES_BELOW) {
         std::cout << "Mature plant " << plant->getID() << " has died due to poor health." << std::endl;
         plant->setState(new DeadState());
         //delete this;
@@ -27,7 +28,7 @@ void MatureState::handleChange(Plant* plant) {
     }
     
     // Check if plant is ready to transition to Flowering state
-    if (age >= 35 && health >= 80) {
+    if (age >= LifecycleTraits::MATURE_FLOWERS_AT_AGE && health >= LifecycleTraits::FLOWERS_AT_HEALTH) {
         std::cout << "Mature plant " << plant->getID() << " is starting to flower... transitioning to Flowering state." << std::endl;
         plant->setState(new FloweringState());
         //delete this;
@@ -0,0 +1,93 @@
+#include "include/NotificationBatch.h"
+#include "include/Plant.h"
+#include "include/PlantObserver.h"
+
+thread_local NotificationBatch* NotificationBatch::active_ = nullptr;
+
+NotificationBatch::NotificationBatch() : outer_(active_), forgotten_(0) {
+    active_ = this;
+}
+
+NotificationBatch::~NotificationBatch() {
+    flush();
+    active_ = outer_;
+}
+
+void NotificationBatch::flush() {
+    if (dirty_.empty()) {
+        return;
+    }
+
+    // Group the dirty plants by observer, keeping first-notified order within each group.
+    // Shared observers sit in the same slot on every plant, so check that slot's last group first.
+    for (Plant* plant : dirty_) {
+        if (plant == nullptr) {
+            continue;  // Deleted while pending
+        }
+        plant->pendingSlot = 0;
+        int observerCount = plant->getObserverCount();
+        for (int i = 0; i < observerCount; i++) {
+            PlantObserver* observer = (i < plant->inlineObserverCount)
+                ? plant->observerSlots[i]
+                : plant->observerSpill->observers[static_cast<size_t>(i - plant->inlineObserverCount)];
+            if (static_cast<size_t>(i) >= slotGroups_.size()) {
+                slotGroups_.resize(static_cast<size_t>(i) + 1, 0);
+            }
+            size_t& current = slotGroups_[static_cast<size_t>(i)];
+            if (current >= groups_.size() || groups_[current].observer != observer) {
+                auto found = groupIndex_.find(observer);
+                if (found == groupIndex_.end()) {
+                    found = groupIndex_.emplace(observer, groups_.size()).first;
+                    groups_.push_back(ObserverGroup{observer, std::vector<Plant*>()});
+                }
+                current = found->second;
+            }
+            groups_[current].plants.push_back(plant);
+        }
+    }
+    dirty_.clear();
+    forgotten_ = 0;
+
+    // Observers that notify again while being delivered to are not deferred
+    NotificationBatch* saved = active_;
+    active_ = outer_;
+    for (ObserverGroup& group : groups_) {
+        if (!group.plants.empty()) {
+            group.observer->updateBatch(group.plants.data(), group.plants.size());
+        }
+    }
+    active_ = saved;
+
+    groups_.clear();
+    groupIndex_.clear();
+    slotGroups_.clear();
+}
+
+int NotificationBatch::getPendingCount() const {
+    return static_cast<int>(dirty_.size() - forgotten_);
+}
+
+NotificationBatch* NotificationBatch::getActive() {
+    return active_;
+}
+
+void NotificationBatch::defer(Plant* plant) {
+    dirty_.push_back(plant);
+    plant->pendingSlot = static_cast<uint32_t>(dirty_.size());
+}
+
+void NotificationBatch::forget(Plant* plant) {
+    if (plant->pendingSlot == 0) {
+        return;
+    }
+    // The slot is only valid in the batch the plant is waiting in, which may be an outer one
+    size_t index = plant->pendingSlot - 1;
+    for (NotificationBatch* batch = this; batch != nullptr; batch = batch->outer_) {
+        if (index < batch->dirty_.size() && batch->dirty_[index] == plant) {
+            batch->dirty_[index] = nullptr;
+            batch->forgotten_++;
+            plant->pendingSlot = 0;
+            return;
+        }
+    }
+}
@@ -0,0 +1,544 @@
+#include "include/NurseryCheckpoint.h"
+#include "include/CareScheduler.h"
+#include "include/Command.h"
+#include "include/Decorator.h"
+#include "include/DirtyEpoch.h"
+#include "include/FinalOrder.h"
+#include "include/Greenhouse.h"
+#include "include/MappedFile.h"
+#include "include/Plant.h"
+#include "include/SalesFloor.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+static_assert(sizeof(DeltaHeader) % 8 == 0, "delta sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotCell) % 8 == 0, "delta sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotOrderSlot) % 8 == 0, "delta sections must stay 8-byte aligned");
+
+namespace {
+
+const char DELTA_MAGIC[8] = {'N', 'U', 'R', 'D', 'L', 'T', 'A', '\0'};
+
+/**
+ * @brief Marks a cell a delta empties, in the map of cells it changes.
+ */
+const uint32_t CLEARED = 0xFFFFFFFFu;
+
+/**
+ * @brief Identifies a grid cell across the greenhouse and the sales floor.
+ */
+uint64_t cellKey(uint8_t location, int32_t row, int32_t col) {
+    return (static_cast<uint64_t>(location) << 62) |
+           (static_cast<uint64_t>(static_cast<uint32_t>(row)) << 31) |
+           static_cast<uint64_t>(static_cast<uint32_t>(col));
+}
+
+bool isGridRecord(const SnapshotPlant& record) {
+    return record.location == NurserySnapshot::InGreenhouse || record.location == NurserySnapshot::OnSalesFloor;
+}
+
+/**
+ * @brief Gets the latest DirtyEpoch of a plant and any decorations wrapped around it.
+ */
+uint32_t chainEpoch(Plant* plant) {
+    uint32_t epoch = 0;
+    while (plant != nullptr) {
+        epoch = std::max(epoch, plant->getDirtyEpoch());
+        // Only decorators (and other custom plants) can wrap another plant
+        Decorator* decorator = plant->getSpecies() == PlantSpecies::Custom ? dynamic_cast<Decorator*>(plant) : nullptr;
+        plant = decorator != nullptr ? decorator->getWrappedPlant() : nullptr;
+    }
+    return epoch;
+}
+
+bool fileExists(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    return static_cast<bool>(in);
+}
+
+/**
+ * @brief An order with its nodes and item plants, numbered from zero within the order.
+ */
+struct OrderBlock {
+    SnapshotOrder order;
+    std::vector<SnapshotOrderNode> nodes;
+    std::vector<SnapshotPlant> plants;
+    bool present = false;
+};
+
+} // namespace
+
+NurseryCheckpoint::NurseryCheckpoint(const std::string& basePath, int compactionInterval)
+    : basePath_(basePath), compactionInterval_(std::max(compactionInterval, 0)), baseId_(0),
+      deltaCount_(0), since_(0), lastFull_(false), lastPlantCount_(0) {
+}
+
+std::string NurseryCheckpoint::getDeltaPath(int sequence) const {
+    return basePath_ + ".delta." + std::to_string(sequence);
+}
+
+void NurseryCheckpoint::removeDeltas() {
+    for (int sequence = 1; std::remove(getDeltaPath(sequence).c_str()) == 0; sequence++) {
+    }
+}
+
+bool NurseryCheckpoint::writeBase(const NurseryContents& contents) {
+    error_.clear();
+    if (!snapshot_.save(basePath_, contents)) {
+        error_ = snapshot_.getError();
+        return false;
+    }
+    removeDeltas();
+    baseId_ = snapshot_.getSnapshotId();
+    deltaCount_ = 0;
+    lastFull_ = true;
+    lastPlantCount_ = snapshot_.getPlantCount();
+    since_ = DirtyEpoch::advance();
+    return true;
+}
+
+bool NurseryCheckpoint::checkpoint(const NurseryContents& contents) {
+    if (baseId_ == 0 || deltaCount_ >= compactionInterval_) {
+        return writeBase(contents);
+    }
+    error_.clear();
+
+    NurserySnapshot& out = snapshot_;
+    out.reset();
+
+    // Command targets are written even if unchanged, so the queue can refer to them
+    std::unordered_set<const Plant*> targets;
+    if (contents.scheduler != nullptr) {
+        for (Command* command : contents.scheduler->getQueuedTasks()) {
+            if (command != nullptr && command->getTarget() != nullptr) {
+                targets.insert(command->getTarget());
+            }
+        }
+    }
+    out.indexPlants_ = !targets.empty();
+
+    std::vector<SnapshotCell> cells;
+    auto addGrid = [&](const PlantGrid& grid, NurserySnapshot::Location location) {
+        grid.forEachCellChangedSince(since_, [&](Plant* plant, int row, int col) {
+            if (plant != nullptr) {
+                out.addPlant(plant, location, row, col);
+                return;
+            }
+            SnapshotCell cell;
+            std::memset(&cell, 0, sizeof(cell));
+            cell.location = location;
+            cell.row = row;
+            cell.col = col;
+            cells.push_back(cell);
+        });
+        grid.forEachPlant([&](Plant* plant, int row, int col) {
+            if (grid.getCellEpoch(row, col) >= since_) {
+                return;     // Written with its cell above
+            }
+            if (chainEpoch(plant) >= since_ || (!targets.empty() && targets.count(plant) != 0)) {
+                out.addPlant(plant, location, row, col);
+            }
+        });
+    };
+    if (contents.greenhouse != nullptr) {
+        addGrid(contents.greenhouse->getGrid(), NurserySnapshot::InGreenhouse);
+    }
+    if (contents.salesFloor != nullptr) {
+        addGrid(contents.salesFloor->getGrid(), NurserySnapshot::OnSalesFloor);
+    }
+
+    out.addCustomers(contents.customers);
+    out.addCommands(contents.scheduler);
+
+    // Null entries are not saved, so slots count only the real orders
+    std::vector<SnapshotOrderSlot> slots;
+    uint32_t orderTotal = 0;
+    for (FinalOrder* order : contents.orders) {
+        if (order == nullptr) {
+            continue;
+        }
+        if (order->getDirtyEpoch() >= since_) {
+            SnapshotOrderSlot slot;
+            slot.index = orderTotal;
+            slot.reserved = 0;
+            slots.push_back(slot);
+            out.addOrder(order);
+        }
+        orderTotal++;
+    }
+
+    DeltaHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, DELTA_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.headerSize = sizeof(DeltaHeader);
+    header.baseId = baseId_;
+    header.sequence = static_cast<uint32_t>(deltaCount_ + 1);
+    header.cellCount = static_cast<uint32_t>(cells.size());
+    header.orderTotal = orderTotal;
+    header.sections = out.makeHeader(contents);
+    header.sections.snapshotId = baseId_;
+
+    std::string prefix(reinterpret_cast<const char*>(&header), sizeof(header));
+    prefix.append(reinterpret_cast<const char*>(cells.data()), cells.size() * sizeof(SnapshotCell));
+    prefix.append(reinterpret_cast<const char*>(slots.data()), slots.size() * sizeof(SnapshotOrderSlot));
+    if (!out.writeFile(getDeltaPath(deltaCount_ + 1), prefix)) {
+        error_ = out.getError();
+        return false;
+    }
+
+    deltaCount_++;
+    lastFull_ = false;
+    lastPlantCount_ = out.plants_.size();
+    since_ = DirtyEpoch::advance();
+    out.reset();
+    return true;
+}
+
+bool NurseryCheckpoint::merge(SnapshotHeader& header, int& deltas) {
+    NurserySnapshot& out = snapshot_;
+    out.reset();
+    deltas = 0;
+
+    MappedFile baseFile;
+    if (!baseFile.open(basePath_)) {
+        error_ = "Cannot open " + basePath_;
+        return false;
+    }
+    NurserySnapshot::Sections base;
+    size_t greenhousePlants = 0;
+    if (!out.parse(baseFile.data(), baseFile.size(), base) || !out.validate(base, greenhousePlants)) {
+        error_ = out.getError();
+        return false;
+    }
+
+    // Every imported record gets its strings copied into the merged string section
+    auto importString = [&out](const SnapshotStringRef& ref, const char* strings) {
+        SnapshotStringRef copy;
+        copy.offset = static_cast<uint32_t>(out.strings_.size());
+        copy.length = ref.length;
+        out.strings_.append(strings + ref.offset, ref.length);
+        return copy;
+    };
+    auto importPlant = [&importString](const SnapshotPlant& record, const char* strings) {
+        SnapshotPlant copy = record;
+        copy.name = importString(record.name, strings);
+        copy.id = importString(record.id, strings);
+        copy.potColour = importString(record.potColour, strings);
+        return copy;
+    };
+    auto importOrder = [&](const NurserySnapshot::Sections& from, uint32_t index) {
+        const SnapshotOrder& record = from.orders[index];
+        OrderBlock block;
+        block.order.customerName = importString(record.customerName, from.strings);
+        block.order.firstNode = 0;
+        block.order.nodeCount = record.nodeCount;
+        block.present = true;
+        for (uint32_t n = record.firstNode; n < record.firstNode + record.nodeCount; n++) {
+            SnapshotOrderNode node = from.orderNodes[n];
+            node.name = importString(node.name, from.strings);
+            if (node.parent != NurserySnapshot::NO_PARENT) {
+                node.parent -= record.firstNode;
+            }
+            if (!node.isGroup) {
+                block.plants.push_back(importPlant(from.plants[node.plant], from.strings));
+                node.plant = static_cast<uint32_t>(block.plants.size() - 1);
+            }
+            block.nodes.push_back(node);
+        }
+        return block;
+    };
+
+    out.plants_.reserve(base.header.plantCount);
+    out.strings_.reserve(base.header.stringBytes);
+    for (uint32_t i = 0; i < base.header.plantCount; i++) {
+        if (isGridRecord(base.plants[i])) {
+            out.plants_.push_back(importPlant(base.plants[i], base.strings));
+        }
+    }
+    std::vector<OrderBlock> blocks;
+    for (uint32_t i = 0; i < base.header.orderCount; i++) {
+        blocks.push_back(importOrder(base, i));
+    }
+
+    // Customers, carts and commands come whole from the newest file
+    std::vector<std::unique_ptr<MappedFile>> deltaFiles;
+    NurserySnapshot::Sections latest = base;
+
+    for (int sequence = 1; ; sequence++) {
+        std::string path = getDeltaPath(sequence);
+        if (!fileExists(path)) {
+            break;
+        }
+        std::unique_ptr<MappedFile> file(new MappedFile());
+        if (!file->open(path)) {
+            error_ = "Cannot open " + path;
+            return false;
+        }
+
+        DeltaHeader delta;
+        if (file->size() < sizeof(DeltaHeader)) {
+            error_ = "Checkpoint delta " + path + " is truncated";
+            return false;
+        }
+        std::memcpy(&delta, file->data(), sizeof(delta));
+        if (std::memcmp(delta.magic, DELTA_MAGIC, sizeof(DELTA_MAGIC)) != 0 ||
+            delta.version != VERSION || delta.headerSize != sizeof(DeltaHeader)) {
+            error_ = "Checkpoint delta " + path + " is not a supported delta";
+            return false;
+        }
+        if (delta.baseId != base.header.snapshotId) {
+            break;      // Left over from an older chain
+        }
+        if (delta.sequence != static_cast<uint32_t>(sequence) ||
+            delta.sections.greenhouseRows != base.header.greenhouseRows ||
+            delta.sections.greenhouseCols != base.header.greenhouseCols ||
+            delta.sections.salesFloorRows != base.header.salesFloorRows ||
+            delta.sections.salesFloorCols != base.header.salesFloorCols) {
+            error_ = "Checkpoint delta " + path + " does not follow its base";
+            return false;
+        }
+
+        uint64_t prefixSize = sizeof(DeltaHeader)
+            + static_cast<uint64_t>(delta.cellCount) * sizeof(SnapshotCell)
+            + static_cast<uint64_t>(delta.sections.orderCount) * sizeof(SnapshotOrderSlot);
+        if (prefixSize > file->size()) {
+            error_ = "Checkpoint delta " + path + " is truncated";
+            return false;
+        }
+        const SnapshotCell* cells = reinterpret_cast<const SnapshotCell*>(file->data() + sizeof(DeltaHeader));
+        const SnapshotOrderSlot* slots = reinterpret_cast<const SnapshotOrderSlot*>(cells + delta.cellCount);
+
+        NurserySnapshot::Sections sections;
+        sections.header = delta.sections;
+        size_t unused = 0;
+        if (!out.locate(file->data() + prefixSize, file->size() - prefixSize, sections) ||
+            !out.validate(sections, unused)) {
+            error_ = "Checkpoint delta " + path + ": " + out.getError();
+            return false;
+        }
+
+        // Cells this delta empties or fills; a filled cell overrides an emptied one
+        std::unordered_map<uint64_t, uint32_t> changes;
+        changes.reserve(delta.cellCount + sections.header.plantCount);
+        for (uint32_t i = 0; i < delta.cellCount; i++) {
+            const SnapshotCell& cell = cells[i];
+            bool valid = cell.location == NurserySnapshot::InGreenhouse
+                ? cell.row >= 0 && cell.row < base.header.greenhouseRows && cell.col >= 0 && cell.col < base.header.greenhouseCols
+                : cell.location == NurserySnapshot::OnSalesFloor &&
+                  cell.row >= 0 && cell.row < base.header.salesFloorRows && cell.col >= 0 && cell.col < base.header.salesFloorCols;
+            if (!valid) {
+                error_ = "Checkpoint delta " + path + " empties a cell outside the grids";
+                return false;
+            }
+            changes[cellKey(cell.location, cell.row, cell.col)] = CLEARED;
+        }
+        for (uint32_t i = 0; i < sections.header.plantCount; i++) {
+            const SnapshotPlant& record = sections.plants[i];
+            if (isGridRecord(record)) {
+                changes[cellKey(record.location, record.row, record.col)] = i;
+            }
+        }
+
+        if (!changes.empty()) {
+            size_t kept = 0;
+            for (size_t i = 0; i < out.plants_.size(); i++) {
+                const SnapshotPlant& record = out.plants_[i];
+                std::unordered_map<uint64_t, uint32_t>::iterator change =
+                    changes.find(cellKey(record.location, record.row, record.col));
+                if (change == changes.end()) {
+                    out.plants_[kept++] = record;
+                    continue;
+                }
+                if (change->second != CLEARED) {
+                    out.plants_[kept++] = importPlant(sections.plants[change->second], sections.strings);
+                }
+                change->second = CLEARED;
+            }
+            out.plants_.resize(kept);
+            // Cells that were empty in the merged grid so far
+            for (uint32_t i = 0; i < sections.header.plantCount; i++) {
+                const SnapshotPlant& record = sections.plants[i];
+                if (isGridRecord(record) && changes[cellKey(record.location, record.row, record.col)] == i) {
+                    out.plants_.push_back(importPlant(record, sections.strings));
+                }
+            }
+        }
+
+        blocks.resize(delta.orderTotal);
+        for (uint32_t i = 0; i < sections.header.orderCount; i++) {
+            if (slots[i].index >= delta.orderTotal) {
+                error_ = "Checkpoint delta " + path + " rewrites an order past the end of the list";
+                return false;
+            }
+            blocks[slots[i].index] = importOrder(sections, i);
+        }
+        for (const OrderBlock& block : blocks) {
+            if (!block.present) {
+                error_ = "Checkpoint delta " + path + " is missing a new order";
+                return false;
+            }
+        }
+
+        latest = sections;
+        deltaFiles.push_back(std::move(file));
+        deltas = sequence;
+    }
+
+    // ---- Flatten: grid plants, then carts, then order items ----
+    // Commands name their targets by index in the newest file; grid targets are found by cell
+    std::unordered_map<uint64_t, uint32_t> gridTargets;
+    for (uint32_t i = 0; i < latest.header.commandCount; i++) {
+        const SnapshotPlant& target = latest.plants[latest.commands[i].plant];
+        if (isGridRecord(target)) {
+            gridTargets[cellKey(target.location, target.row, target.col)] = NurserySnapshot::NO_PARENT;
+        }
+    }
+    if (!gridTargets.empty()) {
+        for (size_t i = 0; i < out.plants_.size(); i++) {
+            const SnapshotPlant& record = out.plants_[i];
+            std::unordered_map<uint64_t, uint32_t>::iterator target =
+                gridTargets.find(cellKey(record.location, record.row, record.col));
+            if (target != gridTargets.end()) {
+                target->second = static_cast<uint32_t>(i);
+            }
+        }
+    }
+
+    std::vector<uint32_t> newIndex(latest.header.plantCount, NurserySnapshot::NO_PARENT);
+    for (uint32_t i = 0; i < latest.header.customerCount; i++) {
+        SnapshotCustomer customer = latest.customers[i];
+        customer.name = importString(customer.name, latest.strings);
+        customer.id = importString(customer.id, latest.strings);
+        out.customers_.push_back(customer);
+    }
+    for (uint32_t i = 0; i < latest.header.plantCount; i++) {
+        if (latest.plants[i].location == NurserySnapshot::InCart) {
+            newIndex[i] = static_cast<uint32_t>(out.plants_.size());
+            out.plants_.push_back(importPlant(latest.plants[i], latest.strings));
+        }
+    }
+    for (uint32_t i = 0; i < latest.header.commandCount; i++) {
+        SnapshotCommand command = latest.commands[i];
+        const SnapshotPlant& target = latest.plants[command.plant];
+        command.plant = isGridRecord(target)
+            ? gridTargets[cellKey(target.location, target.row, target.col)]
+            : newIndex[command.plant];
+        if (command.plant == NurserySnapshot::NO_PARENT) {
+            out.skippedCommands_++;
+            continue;
+        }
+        out.commands_.push_back(command);
+    }
+
+    for (const OrderBlock& block : blocks) {
+        uint32_t firstPlant = static_cast<uint32_t>(out.plants_.size());
+        SnapshotOrder order = block.order;
+        order.firstNode = static_cast<uint32_t>(out.orderNodes_.size());
+        out.plants_.insert(out.plants_.end(), block.plants.begin(), block.plants.end());
+        for (SnapshotOrderNode node : block.nodes) {
+            if (node.parent != NurserySnapshot::NO_PARENT) {
+                node.parent += order.firstNode;
+            }
+            if (!node.isGroup) {
+                node.plant += firstPlant;
+            }
+            out.orderNodes_.push_back(node);
+        }
+        out.orders_.push_back(order);
+    }
+
+    header = base.header;
+    header.day = latest.header.day;
+    header.plantCount = static_cast<uint32_t>(out.plants_.size());
+    header.customerCount = static_cast<uint32_t>(out.customers_.size());
+    header.commandCount = static_cast<uint32_t>(out.commands_.size());
+    header.orderCount = static_cast<uint32_t>(out.orders_.size());
+    header.orderNodeCount = static_cast<uint32_t>(out.orderNodes_.size());
+    header.stringBytes = out.strings_.size();
+    return true;
+}
+
+bool NurseryCheckpoint::restore(NurseryMediator* mediator, NurseryContents& contents) {
+    error_.clear();
+    if (contents.greenhouse != nullptr || contents.salesFloor != nullptr) {
+        error_ = "The greenhouse and sales floor are created by restore()";
+        return false;
+    }
+
+    SnapshotHeader header;
+    int deltas = 0;
+    if (!merge(header, deltas)) {
+        snapshot_.reset();
+        return false;
+    }
+    NurserySnapshot::Sections sections = snapshot_.bufferedSections(header);
+    size_t greenhousePlants = 0;
+    if (!snapshot_.validate(sections, greenhousePlants) ||
+        !snapshot_.build(sections, greenhousePlants, mediator, contents)) {
+        error_ = snapshot_.getError();
+        snapshot_.reset();
+        return false;
+    }
+
+    baseId_ = header.snapshotId;
+    deltaCount_ = deltas;
+    lastPlantCount_ = header.plantCount;
+    // Everything just restored matches the chain on disk
+    since_ = DirtyEpoch::advance();
+    snapshot_.reset();
+    return true;
+}
+
+bool NurseryCheckpoint::compact() {
+    error_.clear();
+
+    SnapshotHeader header;
+    int deltas = 0;
+    if (!merge(header, deltas)) {
+        snapshot_.reset();
+        return false;
+    }
+    size_t greenhousePlants = 0;
+    if (!snapshot_.validate(snapshot_.bufferedSections(header), greenhousePlants)) {
+        error_ = snapshot_.getError();
+        snapshot_.reset();
+        return false;
+    }
+
+    header.snapshotId = NurserySnapshot::newSnapshotId();
+    if (!snapshot_.writeFile(basePath_, std::string(reinterpret_cast<const char*>(&header), sizeof(header)))) {
+        error_ = snapshot_.getError();
+        snapshot_.reset();
+        return false;
+    }
+    removeDeltas();
+    baseId_ = header.snapshotId;
+    deltaCount_ = 0;
+    lastPlantCount_ = header.plantCount;
+    snapshot_.reset();
+    return true;
+}
+
+int NurseryCheckpoint::getDeltaCount() const {
+    return deltaCount_;
+}
+
+bool NurseryCheckpoint::wasLastFull() const {
+    return lastFull_;
+}
+
+size_t NurseryCheckpoint::getLastPlantCount() const {
+    return lastPlantCount_;
+}
+
+const std::string& NurseryCheckpoint::getError() const {
+    return error_;
+}
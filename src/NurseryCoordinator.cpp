@@ -5,6 +5,8 @@
 #include "../include/Greenhouse.h"
 #include "../include/Plant.h"
 #include "../include/Person.h"
+#include "../include/PlantEventStream.h"
+#include "../include/TransactionJournal.h"
 #include <iostream>
 
 NurseryCoordinator::NurseryCoordinator(): NurseryMediator(), salesFloorRef(nullptr), greenhouseRef(nullptr){}
@@ -30,9 +32,10 @@ void NurseryCoordinator::checkPlantRelocation(){
 
     std::cout << "NurseryCoordinator: Checking for plants ready to move to sales floor\n";
     
-    std::vector<Plant*> allPlants = greenhouseRef->getAllPlants();
+    // Only ready plants are visited; the greenhouse keeps them indexed
+    std::vector<Plant*> readyPlants = greenhouseRef->getReadyPlants();
     
-    for(Plant* plant: allPlants){
+    for(Plant* plant: readyPlants){
         if(plant != nullptr && plant->isReadyForSale()){
             std::cout << "NurseryCoordinator: Plant '" << plant->getName() << "' (ID: " << plant->getID() << ") is ready for sale\n";
             
@@ -45,6 +48,8 @@ void NurseryCoordinator::checkPlantRelocation(){
                     if(salesFloorRef->isPositionEmpty(i, j)){
                         greenhouseRef->removePlant(plant);
                         salesFloorRef->addPlantToDisplay(plant, i, j);
+                        PlantEventStream::getInstance()->publish(PlantEventType::MovedToSalesFloor, plant, "", i, j);
+                        TransactionJournal::getInstance()->recordRelocation(plant, i, j);
 
                         placed = true;
 
@@ -87,6 +92,8 @@ bool NurseryCoordinator::coordinatePlantTransfer(std::string plantName){
             if(salesFloorRef->isPositionEmpty(i, j)){
                 greenhouseRef->removePlant(plant);
                 salesFloorRef->addPlantToDisplay(plant, i, j);
+                PlantEventStream::getInstance()->publish(PlantEventType::MovedToSalesFloor, plant, "", i, j);
+                TransactionJournal::getInstance()->recordRelocation(plant, i, j);
                 
                 std::cout << "NurseryCoordinator: Successfully transferred the plant to sales floor\n";
                 return true;
@@ -136,9 +143,7 @@ bool NurseryCoordinator::coordinatePurchaseWorkflow(std::string customerId, std:
     std::cout << "NurseryCoordinator: Coordinating purchase workflow for customer " << customerId << " requesting '" << plantName << "'\n";
     
     if(salesFloorRef != nullptr){
-        std::vector<Plant*> displayPlants = salesFloorRef->getDisplayPlants();
-
-        for(Plant* plant: displayPlants){
+        for(Plant* plant : salesFloorRef->getGrid().getAll()){
             
             if(plant != nullptr && plant->getName() == plantName){
                 std::cout << "NurseryCoordinator: Plant found on sales floor, processing purchase\n";
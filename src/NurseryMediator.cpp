@@ -5,6 +5,8 @@
 #include "../include/Greenhouse.h"
 #include "../include/SalesFloor.h"
 #include "../include/Customer.h"
+#include "../include/PlantEventStream.h"
+#include "../include/TransactionJournal.h"
 
 #include <iostream>
 #include <algorithm>
@@ -45,9 +47,7 @@ Plant* NurseryMediator::requestPlantFromStaff(std::string plantName){
         SalesFloor* sf = dynamic_cast<SalesFloor*>(colleague);
 
         if(sf != nullptr){
-            std::vector<Plant*> displayPlants = sf->getDisplayPlants();
-
-            for(Plant* plant: displayPlants){
+            for(Plant* plant : sf->getGrid().getAll()){
                 if(plant != nullptr && (plant->getName() == plantName)){
                     std::cout << "[Mediator] Plant found on sales floor\n";
                     return plant;
@@ -111,15 +111,14 @@ bool NurseryMediator::transferPlantToCustomer(std::string plantName, Customer* c
     std::cout << "[Mediator] Transferring '" << plantName << "' to " << customer->getName() << "\n";
     
     Plant* plant = nullptr;
+    JournalLocation source = JournalLocation::SalesFloor;
     
     // First try sales floor
     for(Colleague* colleague: colleagues) {
         SalesFloor* sf = dynamic_cast<SalesFloor*>(colleague);
 
         if(sf != nullptr){
-            std::vector<Plant*> displayPlants = sf->getDisplayPlants();
-
-            for(Plant* p: displayPlants){
+            for(Plant* p : sf->getGrid().getAll()){
                 if(p != nullptr && p->getName() == plantName){
                     plant = p;
                     sf->removePlantFromDisplay(plant);
@@ -149,6 +148,7 @@ bool NurseryMediator::transferPlantToCustomer(std::string plantName, Customer* c
                     }
 
                     gh->removePlant(plant);
+                    source = JournalLocation::Greenhouse;
                     std::cout << "[Mediator] Removed plant from greenhouse\n";
                     break;
                 }
@@ -159,6 +159,8 @@ bool NurseryMediator::transferPlantToCustomer(std::string plantName, Customer* c
     // Transfer to customer if found
     if(plant != nullptr){
         customer->addToCart(plant);
+        PlantEventStream::getInstance()->publish(PlantEventType::TransferredToCustomer, plant);
+        TransactionJournal::getInstance()->recordTransfer(plant, customer->getName(), source);
         std::cout << "[Mediator] Successfully transferred plant to customer\n";
         return true;
     }
@@ -194,6 +196,9 @@ bool NurseryMediator::transferPlantFromPosition(int row, int col, Customer* cust
             
             // Add to customer cart (transfers ownership)
             customer->addToCart(plant);
+            PlantEventStream::getInstance()->publish(PlantEventType::TransferredToCustomer, plant);
+            TransactionJournal::getInstance()->recordTransfer(plant, customer->getName(),
+                                                              JournalLocation::SalesFloor, row, col);
             
             std::cout << "[Mediator] Successfully transferred plant from (" << row << "," << col 
                       << ") to customer's cart\n";
@@ -237,6 +242,8 @@ bool NurseryMediator::returnPlantToDisplay(Plant* plant){
                     if(sf->isPositionEmpty(i, j)){
                         bool success = sf->addPlantToDisplay(plant, i, j);
                         if(success){
+                            PlantEventStream::getInstance()->publish(PlantEventType::ReturnedToSalesFloor, plant, "", i, j);
+                            TransactionJournal::getInstance()->recordReturn(plant, i, j);
                             std::cout << "[Mediator] Plant returned to sales floor at (" 
                                       << i << "," << j << ")\n";
                             return true;
@@ -0,0 +1,853 @@
+#include "include/NurserySnapshot.h"
+#include "include/Greenhouse.h"
+#include "include/SalesFloor.h"
+#include "include/CareScheduler.h"
+#include "include/CareAction.h"
+#include "include/Command.h"
+#include "include/Customer.h"
+#include "include/DerivedCustomers.h"
+#include "include/FinalOrder.h"
+#include "include/ConcreteOrder.h"
+#include "include/Leaf.h"
+#include "include/Plant.h"
+#include "include/Decorator.h"
+#include "include/RibbonDecorator.h"
+#include "include/GiftWrapDecorator.h"
+#include "include/DecorativePotDecorator.h"
+#include "include/SeedlingState.h"
+#include "include/GrowingState.h"
+#include "include/MatureState.h"
+#include "include/FloweringState.h"
+#include "include/DeadState.h"
+#include "include/FlowerCareStrategy.h"
+#include "include/SucculentCareStrategy.h"
+#include "include/VegetableCareStrategy.h"
+#include "include/OtherPlantCareStrategy.h"
+#include "include/Flower.h"
+#include "include/Succulent.h"
+#include "include/Vegetable.h"
+#include "include/OtherPlant.h"
+#include "include/Rose.h"
+#include "include/Daisy.h"
+#include "include/Strelitzia.h"
+#include "include/Cactus.h"
+#include "include/Aloe.h"
+#include "include/Potato.h"
+#include "include/Radish.h"
+#include "include/Carrot.h"
+#include "include/Monstera.h"
+#include "include/VenusFlyTrap.h"
+#include "include/MappedFile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+
+static_assert(sizeof(SnapshotHeader) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotPlant) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotCustomer) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotCommand) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotOrder) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+static_assert(sizeof(SnapshotOrderNode) % 8 == 0, "snapshot sections must stay 8-byte aligned");
+
+namespace {
+
+const char SNAPSHOT_MAGIC[8] = {'N', 'U', 'R', 'S', 'E', 'R', 'Y', '\0'};
+
+/**
+ * @brief Names of the concrete plant classes, indexed by NurserySnapshot::PlantKind.
+ */
+const char* const PLANT_KIND_NAMES[NurserySnapshot::PLANT_KIND_COUNT] = {
+    "", "Rose", "Daisy", "Strelitzia", "Cactus", "Aloe",
+    "Potato", "Radish", "Carrot", "Monstera", "Venus Fly Trap"
+};
+
+/**
+ * @brief Swallows console output while a snapshot is restored.
+ *
+ * The constructors of plants, states and customers, and the grids' add
+ * methods, each print a line; for a large nursery that costs more than the
+ * restore itself.
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+class QuietScope {
+public:
+    QuietScope() : saved(std::cout.rdbuf(&sink)) {}
+    ~QuietScope() { std::cout.rdbuf(saved); }
+
+private:
+    NullBuffer sink;
+    std::streambuf* saved;
+};
+
+uint8_t stateCodeOf(const Plant* plant) {
+    PlantState* state = plant->getState();
+    if (state == nullptr) {
+        return NurserySnapshot::NoState;
+    }
+    std::string name = state->getStateName();
+    if (name == "Seedling")  return NurserySnapshot::Seedling;
+    if (name == "Growing")   return NurserySnapshot::Growing;
+    if (name == "Mature")    return NurserySnapshot::Mature;
+    if (name == "Flowering") return NurserySnapshot::Flowering;
+    if (name == "Dead")      return NurserySnapshot::Dead;
+    return NurserySnapshot::NoState;
+}
+
+PlantState* createState(uint8_t code) {
+    switch (code) {
+        case NurserySnapshot::Seedling:  return new SeedlingState();
+        case NurserySnapshot::Growing:   return new GrowingState();
+        case NurserySnapshot::Mature:    return new MatureState();
+        case NurserySnapshot::Flowering: return new FloweringState();
+        case NurserySnapshot::Dead:      return new DeadState();
+        default:                         return nullptr;
+    }
+}
+
+uint8_t strategyCodeOf(const Plant* plant) {
+    CareStrategy* strategy = plant->getStrategy();
+    if (strategy == FlowerCareStrategy::getInstance())     return NurserySnapshot::FlowerCare;
+    if (strategy == SucculentCareStrategy::getInstance())  return NurserySnapshot::SucculentCare;
+    if (strategy == VegetableCareStrategy::getInstance())  return NurserySnapshot::VegetableCare;
+    if (strategy == OtherPlantCareStrategy::getInstance()) return NurserySnapshot::OtherPlantCare;
+    return NurserySnapshot::NoStrategy;
+}
+
+CareStrategy* strategyFor(uint8_t code) {
+    switch (code) {
+        case NurserySnapshot::FlowerCare:     return FlowerCareStrategy::getInstance();
+        case NurserySnapshot::SucculentCare:  return SucculentCareStrategy::getInstance();
+        case NurserySnapshot::VegetableCare:  return VegetableCareStrategy::getInstance();
+        case NurserySnapshot::OtherPlantCare: return OtherPlantCareStrategy::getInstance();
+        default:                              return nullptr;
+    }
+}
+
+uint8_t kindOf(const std::string& name) {
+    for (uint8_t kind = 1; kind < NurserySnapshot::PLANT_KIND_COUNT; kind++) {
+        if (name == PLANT_KIND_NAMES[kind]) {
+            return kind;
+        }
+    }
+    return NurserySnapshot::GenericPlant;
+}
+
+/**
+ * @brief Constructs a plant of the recorded class, with the same arguments its factory uses.
+ */
+Plant* createPlant(uint8_t kind, uint8_t species, const std::string& name, const std::string& id,
+                   CareStrategy* strategy, PlantState* state) {
+    switch (kind) {
+        case NurserySnapshot::RosePlant:         return new Rose(id, strategy, state, "Red", "Hybrid Tea");
+        case NurserySnapshot::DaisyPlant:        return new Daisy(id, strategy, state, "White", "Common");
+        case NurserySnapshot::StrelitziaPlant:   return new Strelitzia(id, strategy, state);
+        case NurserySnapshot::CactusPlant:       return new Cactus(id, strategy, state, "Columnar", "Saguaro");
+        case NurserySnapshot::AloePlant:         return new Aloe(id, strategy, state, "Vera");
+        case NurserySnapshot::PotatoPlant:       return new Potato(id, strategy, state, "Russet", "Brown");
+        case NurserySnapshot::RadishPlant:       return new Radish(id, strategy, state, "Cherry Belle", "Red");
+        case NurserySnapshot::CarrotPlant:       return new Carrot(id, strategy, state, "Russet", "Brown");
+        case NurserySnapshot::MonsteraPlant:     return new Monstera(id, strategy, state, 3);
+        case NurserySnapshot::VenusFlyTrapPlant: return new VenusFlyTrap(id, strategy, state, 5);
+        default:
+            break;
+    }
+    switch (static_cast<PlantSpecies>(species)) {
+        case PlantSpecies::Flower:    return new Flower(name, id, strategy, state);
+        case PlantSpecies::Succulent: return new Succulent(name, id, strategy, state);
+        case PlantSpecies::Vegetable: return new Vegetable(name, id, strategy, state);
+        case PlantSpecies::Other:     return new OtherPlant(name, id, strategy, state);
+        default:                      return new Plant(name, id, strategy, state);
+    }
+}
+
+uint8_t customerKindOf(Customer* customer) {
+    if (dynamic_cast<CorporateCustomer*>(customer) != nullptr) return NurserySnapshot::Corporate;
+    if (dynamic_cast<WalkInCustomer*>(customer) != nullptr)    return NurserySnapshot::WalkIn;
+    return NurserySnapshot::Regular;
+}
+
+Customer* createCustomer(uint8_t kind) {
+    switch (kind) {
+        case NurserySnapshot::Corporate: return new CorporateCustomer();
+        case NurserySnapshot::WalkIn:    return new WalkInCustomer();
+        default:                         return new RegularCustomer();
+    }
+}
+
+template <typename Record>
+void writeSection(std::ofstream& out, const std::vector<Record>& records) {
+    if (!records.empty()) {
+        out.write(reinterpret_cast<const char*>(records.data()),
+                  static_cast<std::streamsize>(records.size() * sizeof(Record)));
+    }
+}
+
+} // namespace
+
+NurserySnapshot::NurserySnapshot()
+    : indexPlants_(false), plantCount_(0), skippedCommands_(0), snapshotId_(0) {
+}
+
+void NurserySnapshot::reset() {
+    plants_.clear();
+    customers_.clear();
+    commands_.clear();
+    orders_.clear();
+    orderNodes_.clear();
+    strings_.clear();
+    plantIndex_.clear();
+    indexPlants_ = false;
+    plantCount_ = 0;
+    skippedCommands_ = 0;
+    error_.clear();
+}
+
+uint32_t NurserySnapshot::newSnapshotId() {
+    static uint32_t counter = 0;
+    uint64_t ticks = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    uint32_t id = static_cast<uint32_t>(ticks ^ (ticks >> 32)) * 2654435761u + ++counter;
+    return id != 0 ? id : 1;
+}
+
+SnapshotStringRef NurserySnapshot::addString(const std::string& text) {
+    SnapshotStringRef ref;
+    ref.offset = static_cast<uint32_t>(strings_.size());
+    ref.length = static_cast<uint32_t>(text.size());
+    strings_.append(text);
+    return ref;
+}
+
+uint32_t NurserySnapshot::addPlant(Plant* plant, Location location, int row, int col) {
+    if (plant == nullptr) {
+        return NO_PARENT;
+    }
+
+    SnapshotPlant record;
+    std::memset(&record, 0, sizeof(record));
+
+    // Peel decorations from the outside in; the record lists them innermost first
+    uint8_t layers[8];
+    int layerCount = 0;
+    Plant* base = plant;
+    while (Decorator* decorator = dynamic_cast<Decorator*>(base)) {
+        uint8_t code = Ribbon;
+        if (DecorativePotDecorator* pot = dynamic_cast<DecorativePotDecorator*>(decorator)) {
+            code = DecorativePot;
+            if (record.potColour.length == 0) {
+                record.potColour = addString(pot->getPotColor());
+            }
+        } else if (dynamic_cast<GiftWrapDecorator*>(decorator) != nullptr) {
+            code = GiftWrap;
+        }
+        if (layerCount < 8) {
+            layers[layerCount++] = code;
+        }
+        base = decorator->getWrappedPlant();
+    }
+    if (base == nullptr) {
+        return NO_PARENT;
+    }
+    int kept = layerCount < SnapshotPlant::MAX_DECORATIONS ? layerCount : SnapshotPlant::MAX_DECORATIONS;
+    record.decorationCount = static_cast<uint8_t>(kept);
+    for (int i = 0; i < kept; i++) {
+        record.decorations[i] = layers[layerCount - 1 - i];
+    }
+
+    record.location = location;
+    record.state = stateCodeOf(base);
+    record.strategy = strategyCodeOf(base);
+    record.readyForSale = base->readyForSale ? 1 : 0;
+    record.row = row;
+    record.col = col;
+    record.age = base->age;
+    record.waterLevel = base->waterLevel;
+    record.sunlightExposure = base->sunlightExposure;
+    record.nutrientLevel = base->nutrientLevel;
+    record.healthLevel = base->healthLevel;
+    record.kind = kindOf(base->plantName);
+    record.species = static_cast<uint8_t>(base->getSpecies());
+    record.price = base->price;
+    if (record.kind == GenericPlant) {
+        record.name = addString(base->plantName);
+    }
+    record.id = addString(base->plantID);
+
+    uint32_t index = static_cast<uint32_t>(plants_.size());
+    plants_.push_back(record);
+    if (indexPlants_) {
+        plantIndex_[plant] = index;
+    }
+    return index;
+}
+
+void NurserySnapshot::addOrderNode(Order* order, uint32_t parent) {
+    if (order == nullptr) {
+        return;
+    }
+
+    SnapshotOrderNode node;
+    std::memset(&node, 0, sizeof(node));
+    node.parent = parent;
+    node.plant = NO_PARENT;
+
+    if (Leaf* leaf = dynamic_cast<Leaf*>(order)) {
+        node.plant = addPlant(leaf->getPlant(), InOrder, -1, -1);
+        if (node.plant != NO_PARENT) {
+            orderNodes_.push_back(node);
+        }
+        return;
+    }
+
+    ConcreteOrder* group = dynamic_cast<ConcreteOrder*>(order);
+    if (group == nullptr) {
+        return;
+    }
+    node.isGroup = 1;
+    node.name = addString(group->getName());
+    uint32_t index = static_cast<uint32_t>(orderNodes_.size());
+    orderNodes_.push_back(node);
+    for (Order* child : group->getChildren()) {
+        addOrderNode(child, index);
+    }
+}
+
+void NurserySnapshot::addCustomers(const std::vector<Customer*>& customers) {
+    for (size_t i = 0; i < customers.size(); i++) {
+        Customer* customer = customers[i];
+        SnapshotCustomer record;
+        std::memset(&record, 0, sizeof(record));
+        if (customer != nullptr) {
+            record.kind = customerKindOf(customer);
+            record.budget = customer->getBudget();
+            record.name = addString(customer->getName());
+            record.id = addString(customer->getId());
+            int position = 0;
+            for (Plant* plant : customer->cart) {
+                if (plant != nullptr) {
+                    addPlant(plant, InCart, static_cast<int>(i), position++);
+                }
+            }
+        }
+        customers_.push_back(record);
+    }
+}
+
+void NurserySnapshot::addCommands(CareScheduler* scheduler) {
+    if (scheduler == nullptr) {
+        return;
+    }
+    for (Command* command : scheduler->getQueuedTasks()) {
+        CareAction action;
+        Plant* target = command != nullptr ? command->getTarget() : nullptr;
+        std::unordered_map<const Plant*, uint32_t>::const_iterator found = plantIndex_.find(target);
+        if (target == nullptr || !command->getCareAction(action) || found == plantIndex_.end()) {
+            skippedCommands_++;
+            continue;
+        }
+        SnapshotCommand record;
+        std::memset(&record, 0, sizeof(record));
+        record.plant = found->second;
+        record.action = static_cast<uint8_t>(action);
+        commands_.push_back(record);
+    }
+    skippedCommands_ += static_cast<size_t>(scheduler->getScheduledCount());
+}
+
+void NurserySnapshot::addOrder(FinalOrder* order) {
+    SnapshotOrder record;
+    record.customerName = addString(order->getCustomerName());
+    record.firstNode = static_cast<uint32_t>(orderNodes_.size());
+    for (Order* item : order->getOrders()) {
+        addOrderNode(item, NO_PARENT);
+    }
+    record.nodeCount = static_cast<uint32_t>(orderNodes_.size()) - record.firstNode;
+    orders_.push_back(record);
+}
+
+SnapshotHeader NurserySnapshot::makeHeader(const NurseryContents& contents) const {
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    header.version = VERSION;
+    header.headerSize = sizeof(SnapshotHeader);
+    header.day = contents.day;
+    if (contents.greenhouse != nullptr) {
+        header.greenhouseRows = contents.greenhouse->getRows();
+        header.greenhouseCols = contents.greenhouse->getColumns();
+        header.greenhouseStorage = static_cast<uint8_t>(contents.greenhouse->getGrid().getStorage());
+    }
+    if (contents.salesFloor != nullptr) {
+        header.salesFloorRows = contents.salesFloor->getRows();
+        header.salesFloorCols = contents.salesFloor->getColumns();
+    }
+    header.plantCount = static_cast<uint32_t>(plants_.size());
+    header.customerCount = static_cast<uint32_t>(customers_.size());
+    header.commandCount = static_cast<uint32_t>(commands_.size());
+    header.orderCount = static_cast<uint32_t>(orders_.size());
+    header.orderNodeCount = static_cast<uint32_t>(orderNodes_.size());
+    header.stringBytes = strings_.size();
+    return header;
+}
+
+bool NurserySnapshot::writeFile(const std::string& path, const std::string& header) {
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary.c_str(), std::ios::binary | std::ios::trunc);
+        if (!out) {
+            error_ = "Cannot create " + temporary;
+            return false;
+        }
+        out.write(header.data(), static_cast<std::streamsize>(header.size()));
+        writeSection(out, plants_);
+        writeSection(out, customers_);
+        writeSection(out, commands_);
+        writeSection(out, orders_);
+        writeSection(out, orderNodes_);
+        out.write(strings_.data(), static_cast<std::streamsize>(strings_.size()));
+        out.flush();
+        if (!out) {
+            error_ = "Cannot write " + temporary;
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+#if defined(_WIN32)
+    std::remove(path.c_str());
+#endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+        error_ = "Cannot replace " + path;
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool NurserySnapshot::save(const std::string& path, const NurseryContents& contents) {
+    reset();
+
+    indexPlants_ = contents.scheduler != nullptr && !contents.scheduler->getQueuedTasks().empty();
+    size_t expected = 0;
+    if (contents.greenhouse != nullptr) {
+        expected += contents.greenhouse->getNumberOfPlants();
+    }
+    if (contents.salesFloor != nullptr) {
+        expected += contents.salesFloor->getNumberOfPlants();
+    }
+    plants_.reserve(expected);
+    strings_.reserve(expected * 12);
+
+    if (contents.greenhouse != nullptr) {
+        contents.greenhouse->forEachPlant([this](Plant* plant, int row, int col) {
+            addPlant(plant, InGreenhouse, row, col);
+        });
+    }
+    if (contents.salesFloor != nullptr) {
+        contents.salesFloor->forEachPlant([this](Plant* plant, int row, int col) {
+            addPlant(plant, OnSalesFloor, row, col);
+        });
+    }
+    addCustomers(contents.customers);
+    addCommands(contents.scheduler);
+    for (FinalOrder* order : contents.orders) {
+        if (order != nullptr) {
+            addOrder(order);
+        }
+    }
+
+    SnapshotHeader header = makeHeader(contents);
+    header.snapshotId = newSnapshotId();
+    if (!writeFile(path, std::string(reinterpret_cast<const char*>(&header), sizeof(header)))) {
+        return false;
+    }
+
+    snapshotId_ = header.snapshotId;
+    plantCount_ = plants_.size();
+    // The record buffers are only needed while writing
+    std::vector<SnapshotPlant>().swap(plants_);
+    std::string().swap(strings_);
+    plantIndex_.clear();
+    return true;
+}
+
+bool NurserySnapshot::parse(const char* data, size_t size, Sections& sections) {
+    if (size < sizeof(SnapshotHeader)) {
+        error_ = "Not a nursery snapshot";
+        return false;
+    }
+    std::memcpy(&sections.header, data, sizeof(SnapshotHeader));
+    if (std::memcmp(sections.header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0) {
+        error_ = "Not a nursery snapshot";
+        return false;
+    }
+    if (sections.header.version != VERSION || sections.header.headerSize != sizeof(SnapshotHeader)) {
+        error_ = "Unsupported snapshot version " + std::to_string(sections.header.version);
+        return false;
+    }
+    return locate(data + sizeof(SnapshotHeader), size - sizeof(SnapshotHeader), sections);
+}
+
+bool NurserySnapshot::locate(const char* data, size_t size, Sections& sections) {
+    const SnapshotHeader& header = sections.header;
+    uint64_t expectedSize = static_cast<uint64_t>(header.plantCount) * sizeof(SnapshotPlant)
+        + static_cast<uint64_t>(header.customerCount) * sizeof(SnapshotCustomer)
+        + static_cast<uint64_t>(header.commandCount) * sizeof(SnapshotCommand)
+        + static_cast<uint64_t>(header.orderCount) * sizeof(SnapshotOrder)
+        + static_cast<uint64_t>(header.orderNodeCount) * sizeof(SnapshotOrderNode)
+        + header.stringBytes;
+    if (expectedSize != size) {
+        error_ = "Snapshot is truncated or corrupt";
+        return false;
+    }
+    if (header.greenhouseRows < 0 || header.greenhouseCols < 0 ||
+        header.salesFloorRows < 0 || header.salesFloorCols < 0 ||
+        header.greenhouseStorage > static_cast<uint8_t>(GridStorage::Sparse)) {
+        error_ = "Snapshot has invalid grid dimensions";
+        return false;
+    }
+
+    const char* cursor = data;
+    sections.plants = reinterpret_cast<const SnapshotPlant*>(cursor);
+    cursor += header.plantCount * sizeof(SnapshotPlant);
+    sections.customers = reinterpret_cast<const SnapshotCustomer*>(cursor);
+    cursor += header.customerCount * sizeof(SnapshotCustomer);
+    sections.commands = reinterpret_cast<const SnapshotCommand*>(cursor);
+    cursor += header.commandCount * sizeof(SnapshotCommand);
+    sections.orders = reinterpret_cast<const SnapshotOrder*>(cursor);
+    cursor += header.orderCount * sizeof(SnapshotOrder);
+    sections.orderNodes = reinterpret_cast<const SnapshotOrderNode*>(cursor);
+    cursor += header.orderNodeCount * sizeof(SnapshotOrderNode);
+    sections.strings = cursor;
+    return true;
+}
+
+NurserySnapshot::Sections NurserySnapshot::bufferedSections(const SnapshotHeader& header) const {
+    Sections sections;
+    sections.header = header;
+    sections.plants = plants_.data();
+    sections.customers = customers_.data();
+    sections.commands = commands_.data();
+    sections.orders = orders_.data();
+    sections.orderNodes = orderNodes_.data();
+    sections.strings = strings_.data();
+    return sections;
+}
+
+bool NurserySnapshot::validate(const Sections& sections, size_t& greenhousePlants) {
+    const SnapshotHeader& header = sections.header;
+    const SnapshotPlant* plantRecords = sections.plants;
+    const SnapshotOrderNode* nodeRecords = sections.orderNodes;
+
+    auto validString = [&header](const SnapshotStringRef& ref) {
+        return static_cast<uint64_t>(ref.offset) + ref.length <= header.stringBytes;
+    };
+    auto inGrid = [](int row, int col, int rows, int cols) {
+        return row >= 0 && row < rows && col >= 0 && col < cols;
+    };
+
+    // Sizes are multiplied in 64 bits; a corrupt header could overflow int
+    uint64_t denseLimit = std::max(MIN_DENSE_CELLS, static_cast<uint64_t>(header.plantCount) * DENSE_CELLS_PER_PLANT);
+    auto gridFits = [denseLimit](int32_t rows, int32_t cols, bool dense) {
+        uint64_t cells = static_cast<uint64_t>(rows) * static_cast<uint64_t>(cols);
+        return cells <= MAX_GRID_CELLS && (!dense || cells <= denseLimit);
+    };
+    bool denseGreenhouse = header.greenhouseStorage == static_cast<uint8_t>(GridStorage::Dense);
+    if (!gridFits(header.greenhouseRows, header.greenhouseCols, denseGreenhouse) ||
+        !gridFits(header.salesFloorRows, header.salesFloorCols, true)) {
+        error_ = "Snapshot grid is too large for the plants it holds";
+        return false;
+    }
+
+    greenhousePlants = 0;
+    for (uint32_t i = 0; i < header.plantCount; i++) {
+        const SnapshotPlant& record = plantRecords[i];
+        bool valid = record.location <= InOrder && record.state <= Dead &&
+                     record.strategy <= OtherPlantCare && record.kind < PLANT_KIND_COUNT &&
+                     record.species <= static_cast<uint8_t>(PlantSpecies::Other) &&
+                     record.decorationCount <= SnapshotPlant::MAX_DECORATIONS &&
+                     validString(record.name) && validString(record.id) && validString(record.potColour);
+        for (int d = 0; valid && d < record.decorationCount; d++) {
+            valid = record.decorations[d] <= DecorativePot;
+        }
+        if (valid && record.location == InGreenhouse) {
+            valid = inGrid(record.row, record.col, header.greenhouseRows, header.greenhouseCols);
+            greenhousePlants++;
+        } else if (valid && record.location == OnSalesFloor) {
+            valid = inGrid(record.row, record.col, header.salesFloorRows, header.salesFloorCols);
+        } else if (valid && record.location == InCart) {
+            valid = record.row >= 0 && static_cast<uint32_t>(record.row) < header.customerCount;
+        }
+        if (!valid) {
+            error_ = "Snapshot plant record " + std::to_string(i) + " is corrupt";
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < header.customerCount; i++) {
+        const SnapshotCustomer& record = sections.customers[i];
+        if (record.kind > WalkIn || !validString(record.name) || !validString(record.id)) {
+            error_ = "Snapshot customer record " + std::to_string(i) + " is corrupt";
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < header.commandCount; i++) {
+        const SnapshotCommand& record = sections.commands[i];
+        if (record.plant >= header.plantCount || plantRecords[record.plant].location == InOrder ||
+            record.action >= CARE_ACTION_COUNT) {
+            error_ = "Snapshot command record " + std::to_string(i) + " is corrupt";
+            return false;
+        }
+    }
+    // Every order-item plant must belong to exactly one leaf, or it would be freed twice
+    std::vector<char> leafUsed(header.plantCount, 0);
+    uint32_t nextNode = 0;
+    for (uint32_t i = 0; i < header.orderCount; i++) {
+        const SnapshotOrder& order = sections.orders[i];
+        if (order.firstNode != nextNode || order.nodeCount > header.orderNodeCount - nextNode ||
+            !validString(order.customerName)) {
+            error_ = "Snapshot order record " + std::to_string(i) + " is corrupt";
+            return false;
+        }
+        for (uint32_t n = order.firstNode; n < order.firstNode + order.nodeCount; n++) {
+            const SnapshotOrderNode& node = nodeRecords[n];
+            bool valid = node.parent == NO_PARENT ||
+                         (node.parent >= order.firstNode && node.parent < n && nodeRecords[node.parent].isGroup);
+            if (valid && node.isGroup) {
+                valid = validString(node.name);
+            } else if (valid) {
+                valid = node.plant < header.plantCount && plantRecords[node.plant].location == InOrder &&
+                        !leafUsed[node.plant];
+                if (valid) {
+                    leafUsed[node.plant] = 1;
+                }
+            }
+            if (!valid) {
+                error_ = "Snapshot order node " + std::to_string(n) + " is corrupt";
+                return false;
+            }
+        }
+        nextNode += order.nodeCount;
+    }
+    if (nextNode != header.orderNodeCount) {
+        error_ = "Snapshot has order nodes outside any order";
+        return false;
+    }
+    return true;
+}
+
+bool NurserySnapshot::build(const Sections& sections, size_t greenhousePlants,
+                            NurseryMediator* mediator, NurseryContents& contents) {
+    const SnapshotHeader& header = sections.header;
+    const SnapshotPlant* plantRecords = sections.plants;
+    const SnapshotOrderNode* nodeRecords = sections.orderNodes;
+    const char* strings = sections.strings;
+
+    QuietScope quiet;
+
+    Greenhouse* greenhouse = new Greenhouse(mediator, header.greenhouseRows, header.greenhouseCols,
+                                            static_cast<GridStorage>(header.greenhouseStorage));
+    greenhouse->reservePlants(greenhousePlants);
+    SalesFloor* salesFloor = new SalesFloor(mediator, header.salesFloorRows, header.salesFloorCols);
+
+    std::vector<Customer*> customers;
+    customers.reserve(header.customerCount);
+    for (uint32_t i = 0; i < header.customerCount; i++) {
+        const SnapshotCustomer& record = sections.customers[i];
+        Customer* customer = createCustomer(record.kind);
+        customer->setName(std::string(strings + record.name.offset, record.name.length));
+        customer->setId(std::string(strings + record.id.offset, record.id.length));
+        customer->setBudget(record.budget);
+        customers.push_back(customer);
+    }
+
+    // plants[i] is the outermost object of record i; owned[i] is cleared once a container takes it
+    std::vector<Plant*> plants(header.plantCount, nullptr);
+    std::vector<char> owned(header.plantCount, 1);
+    // Greenhouse plants go in with one bulk insert once they are all built
+    std::vector<PlantPlacement> placements;
+    std::vector<uint32_t> placementRecords;
+    placements.reserve(greenhousePlants);
+    placementRecords.reserve(greenhousePlants);
+    bool placed = true;
+    for (uint32_t i = 0; i < header.plantCount && placed; i++) {
+        const SnapshotPlant& record = plantRecords[i];
+        std::string id(strings + record.id.offset, record.id.length);
+        std::string name(strings + record.name.offset, record.name.length);
+
+        Plant* base = createPlant(record.kind, record.species, name, id,
+                                  strategyFor(record.strategy), createState(record.state));
+        base->age = record.age;
+        base->waterLevel = record.waterLevel;
+        base->sunlightExposure = record.sunlightExposure;
+        base->nutrientLevel = record.nutrientLevel;
+        base->healthLevel = record.healthLevel;
+        base->readyForSale = record.readyForSale != 0;
+        base->price = record.price;
+
+        Plant* plant = base;
+        for (int d = 0; d < record.decorationCount; d++) {
+            switch (record.decorations[d]) {
+                case Ribbon:
+                    plant = new RibbonDecorator(plant);
+                    break;
+                case GiftWrap:
+                    plant = new GiftWrapDecorator(plant);
+                    break;
+                default:
+                    plant = new DecorativePotDecorator(
+                        plant, std::string(strings + record.potColour.offset, record.potColour.length));
+                    break;
+            }
+        }
+        plants[i] = plant;
+
+        switch (record.location) {
+            case InGreenhouse:
+                placements.push_back(PlantPlacement{plant, record.row, record.col, false});
+                placementRecords.push_back(i);
+                break;
+            case OnSalesFloor:
+                placed = salesFloor->addPlantToDisplay(plant, record.row, record.col);
+                owned[i] = !placed;
+                break;
+            case InCart:
+                customers[record.row]->cart.push_back(plant);
+                owned[i] = 0;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (placed) {
+        placed = greenhouse->addPlants(placements.data(), placements.size()) == placements.size();
+        for (size_t p = 0; p < placements.size(); p++) {
+            owned[placementRecords[p]] = !placements[p].placed;
+        }
+    }
+
+    if (!placed) {
+        // Two records claimed the same cell
+        for (uint32_t i = 0; i < header.plantCount; i++) {
+            if (owned[i]) {
+                delete plants[i];
+            }
+        }
+        for (Customer* customer : customers) {
+            delete customer;
+        }
+        delete greenhouse;
+        delete salesFloor;
+        error_ = "Snapshot places two plants in the same cell";
+        return false;
+    }
+
+    std::vector<FinalOrder*> orders;
+    orders.reserve(header.orderCount);
+    std::vector<Order*> nodes(header.orderNodeCount, nullptr);
+    for (uint32_t i = 0; i < header.orderCount; i++) {
+        const SnapshotOrder& record = sections.orders[i];
+        FinalOrder* order = new FinalOrder(
+            std::string(strings + record.customerName.offset, record.customerName.length));
+        uint32_t end = record.firstNode + record.nodeCount;
+        for (uint32_t n = record.firstNode; n < end; n++) {
+            const SnapshotOrderNode& node = nodeRecords[n];
+            if (node.isGroup) {
+                nodes[n] = new ConcreteOrder(std::string(strings + node.name.offset, node.name.length));
+            } else {
+                nodes[n] = new Leaf(plants[node.plant], true);
+                owned[node.plant] = 0;
+            }
+            if (node.parent != NO_PARENT) {
+                nodes[node.parent]->add(nodes[n]);
+            }
+        }
+        // FinalOrder caches its total when an item is added, so add complete subtrees only
+        for (uint32_t n = record.firstNode; n < end; n++) {
+            if (nodeRecords[n].parent == NO_PARENT) {
+                order->addOrder(nodes[n]);
+            }
+        }
+        orders.push_back(order);
+    }
+
+    // Order-item records that no order refers to
+    for (uint32_t i = 0; i < header.plantCount; i++) {
+        if (owned[i]) {
+            delete plants[i];
+            plants[i] = nullptr;
+        }
+    }
+
+    for (uint32_t i = 0; i < header.commandCount; i++) {
+        const SnapshotCommand& record = sections.commands[i];
+        if (contents.scheduler == nullptr) {
+            skippedCommands_++;
+            continue;
+        }
+        contents.scheduler->addTask(
+            createCareCommand(static_cast<CareAction>(record.action), plants[record.plant]));
+    }
+
+    for (Customer* customer : customers) {
+        customer->setMediator(mediator);
+        if (mediator != nullptr) {
+            mediator->registerColleague(customer);
+        }
+    }
+
+    contents.greenhouse = greenhouse;
+    contents.salesFloor = salesFloor;
+    contents.customers.insert(contents.customers.end(), customers.begin(), customers.end());
+    contents.orders.insert(contents.orders.end(), orders.begin(), orders.end());
+    contents.day = header.day;
+    plantCount_ = header.plantCount;
+    snapshotId_ = header.snapshotId;
+    return true;
+}
+
+bool NurserySnapshot::load(const std::string& path, NurseryMediator* mediator, NurseryContents& contents) {
+    reset();
+
+    if (contents.greenhouse != nullptr || contents.salesFloor != nullptr) {
+        error_ = "The greenhouse and sales floor are created by load()";
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.open(path)) {
+        error_ = "Cannot open " + path;
+        return false;
+    }
+
+    // Validate everything before constructing anything
+    Sections sections;
+    size_t greenhousePlants = 0;
+    if (!parse(file.data(), file.size(), sections) || !validate(sections, greenhousePlants)) {
+        return false;
+    }
+    return build(sections, greenhousePlants, mediator, contents);
+}
+size_t NurserySnapshot::getPlantCount() const {
+    return plantCount_;
+}
+
+size_t NurserySnapshot::getSkippedCommandCount() const {
+    return skippedCommands_;
+}
+
+uint32_t NurserySnapshot::getSnapshotId() const {
+    return snapshotId_;
+}
+
+const std::string& NurserySnapshot::getError() const {
+    return error_;
+}
@@ -0,0 +1,537 @@
+#include "include/OrderHistory.h"
+#include "include/FinalOrder.h"
+#include "include/ConcreteOrder.h"
+#include "include/Leaf.h"
+#include "include/Plant.h"
+#include "include/Decorator.h"
+#include "include/RibbonDecorator.h"
+#include "include/GiftWrapDecorator.h"
+#include "include/DecorativePotDecorator.h"
+#include "include/RoseFactory.h"
+#include "include/DaisyFactory.h"
+#include "include/StrelitziaFactory.h"
+#include "include/CactusFactory.h"
+#include "include/AloeFactory.h"
+#include "include/PotatoFactory.h"
+#include "include/RadishFactory.h"
+#include "include/CarrotFactory.h"
+#include "include/MonsteraFactory.h"
+#include "include/VenusFlyTrapFactory.h"
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+
+static_assert(sizeof(HistoryFileHeader) % 8 == 0, "history records must stay 8-byte aligned");
+static_assert(sizeof(HistoryRecordHeader) % 8 == 0, "history records must stay 8-byte aligned");
+static_assert(sizeof(HistoryNode) % 8 == 0, "history records must stay 8-byte aligned");
+
+namespace {
+
+const char HISTORY_MAGIC[8] = {'N', 'U', 'R', 'H', 'I', 'S', 'T', '\0'};
+
+/**
+ * @brief Plant names and the factories that build them.
+ */
+struct SpeciesRoute {
+    const char* name;
+    const PlantFactory* factory;
+};
+
+const RoseFactory roseFactory{};
+const DaisyFactory daisyFactory{};
+const StrelitziaFactory strelitziaFactory{};
+const CactusFactory cactusFactory{};
+const AloeFactory aloeFactory{};
+const PotatoFactory potatoFactory{};
+const RadishFactory radishFactory{};
+const CarrotFactory carrotFactory{};
+const MonsteraFactory monsteraFactory{};
+const VenusFlyTrapFactory venusFlyTrapFactory{};
+
+const SpeciesRoute SPECIES_ROUTES[] = {
+    {"Rose", &roseFactory},             {"Daisy", &daisyFactory},
+    {"Strelitzia", &strelitziaFactory}, {"Cactus", &cactusFactory},
+    {"Aloe", &aloeFactory},             {"Potato", &potatoFactory},
+    {"Radish", &radishFactory},         {"Carrot", &carrotFactory},
+    {"Monstera", &monsteraFactory},     {"Venus Fly Trap", &venusFlyTrapFactory}
+};
+
+size_t alignTo8(size_t bytes) {
+    return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+bool refFits(const HistoryStringRef& ref, size_t first, size_t end) {
+    return ref.offset >= first && ref.offset <= end && ref.length <= end - ref.offset;
+}
+
+} // namespace
+
+// ============ OrderView ============
+
+OrderHistory::OrderView::OrderView() : record_(nullptr) {
+}
+
+OrderHistory::OrderView::OrderView(const char* record) : record_(record) {
+}
+
+const HistoryRecordHeader& OrderHistory::OrderView::header() const {
+    return *reinterpret_cast<const HistoryRecordHeader*>(record_);
+}
+
+bool OrderHistory::OrderView::isValid() const {
+    return record_ != nullptr;
+}
+
+uint64_t OrderHistory::OrderView::getSequence() const {
+    return header().sequence;
+}
+
+int OrderHistory::OrderView::getDay() const {
+    return header().day;
+}
+
+double OrderHistory::OrderView::getTotal() const {
+    return header().total;
+}
+
+size_t OrderHistory::OrderView::getNodeCount() const {
+    return header().nodeCount;
+}
+
+size_t OrderHistory::OrderView::getPlantCount() const {
+    return header().plantCount;
+}
+
+std::string_view OrderHistory::OrderView::getCustomerId() const {
+    return getString(header().customerId);
+}
+
+std::string_view OrderHistory::OrderView::getCustomerName() const {
+    return getString(header().customerName);
+}
+
+const HistoryNode& OrderHistory::OrderView::getNode(size_t index) const {
+    return reinterpret_cast<const HistoryNode*>(record_ + sizeof(HistoryRecordHeader))[index];
+}
+
+std::string_view OrderHistory::OrderView::getString(const HistoryStringRef& ref) const {
+    return std::string_view(record_ + ref.offset, ref.length);
+}
+
+bool OrderHistory::OrderView::containsPlant(std::string_view plantName) const {
+    size_t count = getNodeCount();
+    for (size_t i = 0; i < count; i++) {
+        const HistoryNode& node = getNode(i);
+        if (!node.isGroup && getString(node.name) == plantName) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ============ OrderHistory ============
+
+OrderHistory::OrderHistory() : stale_(false), fileBytes_(0), orderCount_(0) {
+}
+
+OrderHistory::~OrderHistory() {
+    close();
+}
+
+bool OrderHistory::isOpen() const {
+    return out_.is_open();
+}
+
+void OrderHistory::close() {
+    if (out_.is_open()) {
+        out_.close();
+    }
+    map_.close();
+    stale_ = false;
+    path_.clear();
+    fileBytes_ = 0;
+    customerRecords_.clear();
+    orderCount_ = 0;
+}
+
+bool OrderHistory::open(const std::string& path) {
+    close();
+    error_.clear();
+
+    std::error_code ec;
+    if (!std::filesystem::exists(path, ec)) {
+        std::ofstream create(path.c_str(), std::ios::binary);
+        HistoryFileHeader header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, HISTORY_MAGIC, sizeof(header.magic));
+        header.version = VERSION;
+        header.headerSize = sizeof(HistoryFileHeader);
+        create.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        if (!create) {
+            error_ = "Cannot create " + path;
+            std::cout << "[OrderHistory] " << error_ << "\n";
+            return false;
+        }
+    }
+
+    if (!map_.open(path, false)) {
+        error_ = "Cannot open " + path;
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        return false;
+    }
+    const char* data = map_.data();
+    size_t size = map_.size();
+    HistoryFileHeader header;
+    if (size < sizeof(header)) {
+        error_ = path + " is not an order history";
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        map_.close();
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, HISTORY_MAGIC, sizeof(HISTORY_MAGIC)) != 0 ||
+        header.headerSize != sizeof(HistoryFileHeader)) {
+        error_ = path + " is not an order history";
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        map_.close();
+        return false;
+    }
+    if (header.version != VERSION) {
+        error_ = path + " has unsupported version " + std::to_string(header.version);
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        map_.close();
+        return false;
+    }
+
+    // Index the records; only their headers and nodes are read
+    size_t offset = sizeof(HistoryFileHeader);
+    while (offset < size) {
+        size_t bytes = checkRecord(data, offset, size);
+        if (bytes == 0) {
+            break;
+        }
+        OrderView view(data + offset);
+        customerRecords_[std::string(view.getCustomerId())].push_back(offset);
+        orderCount_++;
+        offset += bytes;
+    }
+    if (offset < size) {
+        std::cout << "[OrderHistory] Dropping " << (size - offset) << " damaged bytes at the end of "
+                  << path << "\n";
+        map_.close();
+        std::filesystem::resize_file(path, offset, ec);
+        if (ec) {
+            error_ = "Cannot truncate " + path + ": " + ec.message();
+            std::cout << "[OrderHistory] " << error_ << "\n";
+            customerRecords_.clear();
+            orderCount_ = 0;
+            return false;
+        }
+        stale_ = true;
+    }
+
+    out_.open(path.c_str(), std::ios::binary | std::ios::app);
+    if (!out_) {
+        error_ = "Cannot append to " + path;
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        map_.close();
+        customerRecords_.clear();
+        orderCount_ = 0;
+        return false;
+    }
+    path_ = path;
+    fileBytes_ = offset;
+    return true;
+}
+
+size_t OrderHistory::checkRecord(const char* data, size_t offset, size_t size) {
+    if (size - offset < sizeof(HistoryRecordHeader)) {
+        return 0;
+    }
+    HistoryRecordHeader header;
+    std::memcpy(&header, data + offset, sizeof(header));
+    size_t nodesEnd = sizeof(header) + static_cast<size_t>(header.nodeCount) * sizeof(HistoryNode);
+    size_t bytes = header.recordBytes;
+    if (bytes % 8 != 0 || bytes < nodesEnd || bytes > size - offset ||
+        !refFits(header.customerId, nodesEnd, bytes) || !refFits(header.customerName, nodesEnd, bytes)) {
+        return 0;
+    }
+
+    const HistoryNode* nodes = reinterpret_cast<const HistoryNode*>(data + offset + sizeof(header));
+    uint32_t plants = 0;
+    for (uint32_t i = 0; i < header.nodeCount; i++) {
+        const HistoryNode& node = nodes[i];
+        bool valid = node.isGroup <= 1 && node.decorationCount <= HistoryNode::MAX_DECORATIONS &&
+                     (node.parent == NO_PARENT || (node.parent < i && nodes[node.parent].isGroup == 1 &&
+                                                   i < nodes[node.parent].subtreeEnd)) &&
+                     node.subtreeEnd > i && node.subtreeEnd <= header.nodeCount &&
+                     (node.isGroup == 1 || node.subtreeEnd == i + 1) &&
+                     refFits(node.name, nodesEnd, bytes) && refFits(node.plantId, nodesEnd, bytes) &&
+                     refFits(node.potColour, nodesEnd, bytes);
+        for (int d = 0; valid && d < node.decorationCount; d++) {
+            valid = node.decorations[d] <= DecorativePot;
+        }
+        if (!valid) {
+            return 0;
+        }
+        plants += node.isGroup ? 0 : 1;
+    }
+    return plants == header.plantCount ? bytes : 0;
+}
+
+const char* OrderHistory::mapped() const {
+    if (stale_) {
+        map_.open(path_, false);
+        stale_ = false;
+    }
+    return map_.data();
+}
+
+HistoryStringRef OrderHistory::addString(const std::string& text) {
+    HistoryStringRef ref;
+    ref.offset = static_cast<uint32_t>(strings_.size());
+    ref.length = static_cast<uint32_t>(text.size());
+    strings_ += text;
+    return ref;
+}
+
+void OrderHistory::addNode(const Order* order, uint32_t parent) {
+    if (order == nullptr) {
+        return;
+    }
+
+    HistoryNode node;
+    std::memset(&node, 0, sizeof(node));
+    node.parent = parent;
+    node.price = order->getPrice();
+
+    if (const Leaf* leaf = dynamic_cast<const Leaf*>(order)) {
+        // Peel decorations from the outside in; the node lists them innermost first
+        uint8_t layers[8];
+        int layerCount = 0;
+        Plant* base = leaf->getPlant();
+        while (Decorator* decorator = dynamic_cast<Decorator*>(base)) {
+            uint8_t code = Ribbon;
+            if (DecorativePotDecorator* pot = dynamic_cast<DecorativePotDecorator*>(decorator)) {
+                code = DecorativePot;
+                if (node.potColour.length == 0) {
+                    node.potColour = addString(pot->getPotColor());
+                }
+            } else if (dynamic_cast<GiftWrapDecorator*>(decorator) != nullptr) {
+                code = GiftWrap;
+            }
+            if (layerCount < 8) {
+                layers[layerCount++] = code;
+            }
+            base = decorator->getWrappedPlant();
+        }
+        if (base == nullptr) {
+            return;
+        }
+        int kept = layerCount < HistoryNode::MAX_DECORATIONS ? layerCount : HistoryNode::MAX_DECORATIONS;
+        node.decorationCount = static_cast<uint8_t>(kept);
+        for (int i = 0; i < kept; i++) {
+            node.decorations[i] = layers[layerCount - 1 - i];
+        }
+        node.basePrice = base->getPrice();
+        node.name = addString(base->getName());
+        node.plantId = addString(base->getID());
+        node.subtreeEnd = static_cast<uint32_t>(nodes_.size() + 1);
+        nodes_.push_back(node);
+        return;
+    }
+
+    const ConcreteOrder* group = dynamic_cast<const ConcreteOrder*>(order);
+    if (group == nullptr) {
+        return;
+    }
+    uint32_t index = static_cast<uint32_t>(nodes_.size());
+    node.isGroup = 1;
+    node.name = addString(group->getName());
+    nodes_.push_back(node);
+    for (const Order* child : group->getChildren()) {
+        addNode(child, index);
+    }
+    nodes_[index].subtreeEnd = static_cast<uint32_t>(nodes_.size());
+}
+
+bool OrderHistory::append(const FinalOrder* order, const std::string& customerId, int day) {
+    error_.clear();
+    if (!out_.is_open()) {
+        error_ = "No history file is open";
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        return false;
+    }
+    if (order == nullptr) {
+        error_ = "No order to record";
+        return false;
+    }
+
+    nodes_.clear();
+    strings_.clear();
+    HistoryRecordHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.customerId = addString(customerId);
+    header.customerName = addString(order->getCustomerName());
+    for (const Order* item : order->getOrders()) {
+        addNode(item, NO_PARENT);
+    }
+
+    // String offsets were counted from the string section; make them relative to the record
+    uint32_t stringsStart = static_cast<uint32_t>(sizeof(header) + nodes_.size() * sizeof(HistoryNode));
+    header.customerId.offset += stringsStart;
+    header.customerName.offset += stringsStart;
+    for (HistoryNode& node : nodes_) {
+        node.name.offset += stringsStart;
+        node.plantId.offset += stringsStart;
+        node.potColour.offset += stringsStart;
+        header.plantCount += node.isGroup ? 0 : 1;
+    }
+    header.nodeCount = static_cast<uint32_t>(nodes_.size());
+    header.recordBytes = static_cast<uint32_t>(alignTo8(stringsStart + strings_.size()));
+    header.day = day;
+    header.sequence = orderCount_;
+    header.total = order->calculateTotalPrice();
+
+    out_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_.write(reinterpret_cast<const char*>(nodes_.data()),
+               static_cast<std::streamsize>(nodes_.size() * sizeof(HistoryNode)));
+    out_.write(strings_.data(), static_cast<std::streamsize>(strings_.size()));
+    const char padding[8] = {0};
+    out_.write(padding, static_cast<std::streamsize>(header.recordBytes - stringsStart - strings_.size()));
+    out_.flush();
+    if (!out_) {
+        error_ = "Cannot write to " + path_;
+        std::cout << "[OrderHistory] " << error_ << "\n";
+        // A partial record is dropped the next time the file is opened
+        out_.close();
+        return false;
+    }
+
+    customerRecords_[customerId].push_back(fileBytes_);
+    fileBytes_ += header.recordBytes;
+    orderCount_++;
+    stale_ = true;
+    return true;
+}
+
+size_t OrderHistory::getOrderCount() const {
+    return orderCount_;
+}
+
+size_t OrderHistory::getOrderCount(const std::string& customerId) const {
+    auto it = customerRecords_.find(customerId);
+    return it == customerRecords_.end() ? 0 : it->second.size();
+}
+
+std::vector<OrderHistory::OrderView> OrderHistory::getOrders(const std::string& customerId) const {
+    std::vector<OrderView> orders;
+    auto it = customerRecords_.find(customerId);
+    if (it == customerRecords_.end()) {
+        return orders;
+    }
+    const char* data = mapped();
+    orders.reserve(it->second.size());
+    for (uint64_t offset : it->second) {
+        orders.push_back(OrderView(data + offset));
+    }
+    return orders;
+}
+
+OrderHistory::OrderView OrderHistory::getLatestOrder(const std::string& customerId) const {
+    auto it = customerRecords_.find(customerId);
+    if (it == customerRecords_.end() || it->second.empty()) {
+        return OrderView();
+    }
+    return OrderView(mapped() + it->second.back());
+}
+
+std::vector<OrderHistory::OrderView> OrderHistory::findOrders(const std::string& customerId,
+                                                              std::string_view plantName) const {
+    std::vector<OrderView> found;
+    for (const OrderView& order : getOrders(customerId)) {
+        if (order.containsPlant(plantName)) {
+            found.push_back(order);
+        }
+    }
+    return found;
+}
+
+double OrderHistory::getTotalSpent(const std::string& customerId) const {
+    auto it = customerRecords_.find(customerId);
+    if (it == customerRecords_.end()) {
+        return 0.0;
+    }
+    const char* data = mapped();
+    double total = 0.0;
+    for (uint64_t offset : it->second) {
+        total += OrderView(data + offset).getTotal();
+    }
+    return total;
+}
+
+FinalOrder* OrderHistory::materialize(const OrderView& order, CareScheduler* scheduler) const {
+    if (!order.isValid()) {
+        return nullptr;
+    }
+    FinalOrder* copy = new FinalOrder(std::string(order.getCustomerName()));
+    size_t count = order.getNodeCount();
+    for (size_t i = 0; i < count; i = order.getNode(i).subtreeEnd) {
+        copy->addOrder(buildNode(order, i, scheduler));
+    }
+    return copy;
+}
+
+Order* OrderHistory::materializeItem(const OrderView& order, size_t node, CareScheduler* scheduler) const {
+    if (!order.isValid() || node >= order.getNodeCount()) {
+        return nullptr;
+    }
+    return buildNode(order, node, scheduler);
+}
+
+Order* OrderHistory::buildNode(const OrderView& order, size_t index, CareScheduler* scheduler) const {
+    const HistoryNode& node = order.getNode(index);
+    if (!node.isGroup) {
+        return new Leaf(buildPlant(order, node, scheduler), true);
+    }
+    ConcreteOrder* group = new ConcreteOrder(std::string(order.getString(node.name)));
+    for (size_t child = index + 1; child < node.subtreeEnd; child = order.getNode(child).subtreeEnd) {
+        group->add(buildNode(order, child, scheduler));
+    }
+    return group;
+}
+
+Plant* OrderHistory::buildPlant(const OrderView& order, const HistoryNode& node, CareScheduler* scheduler) const {
+    std::string_view name = order.getString(node.name);
+    Plant* plant = nullptr;
+    for (const SpeciesRoute& route : SPECIES_ROUTES) {
+        if (name == route.name) {
+            plant = route.factory->buildPlant(scheduler);
+            break;
+        }
+    }
+    if (plant == nullptr) {
+        plant = new Plant(std::string(name), std::string(order.getString(node.plantId)), nullptr, nullptr);
+    }
+    plant->setPrice(node.basePrice);
+    plant->setReadyForSale(true);
+
+    for (int d = 0; d < node.decorationCount; d++) {
+        switch (node.decorations[d]) {
+            case Ribbon:
+                plant = new RibbonDecorator(plant);
+                break;
+            case GiftWrap:
+                plant = new GiftWrapDecorator(plant);
+                break;
+            default:
+                plant = new DecorativePotDecorator(plant, std::string(order.getString(node.potColour)));
+                break;
+        }
+    }
+    return plant;
+}
+
+const std::string& OrderHistory::getError() const {
+    return error_;
+}
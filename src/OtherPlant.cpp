@@ -3,7 +3,8 @@
 OtherPlant::OtherPlant(const std::string& name, const std::string& id,
                        CareStrategy* careStrategy, PlantState* initialState)
     : Plant(name, id, careStrategy, initialState) {
-    setPrice(20.0);
+    setSpecies(OtherPlantTraits::SPECIES);
+    setPrice(OtherPlantTraits::BASE_PRICE);
 }
 
 OtherPlant::~OtherPlant() {
@@ -1,12 +1,16 @@
 #include "include/OtherPlantCareStrategy.h"
 #include "include/Plant.h"
+#include "include/SpeciesKernel.h"
 #include <iostream>
 
-
+OtherPlantCareStrategy* OtherPlantCareStrategy::getInstance() {
+    static OtherPlantCareStrategy instance;
+    return &instance;
+}
 
 void OtherPlantCareStrategy::water(Plant* plant) {
     // Standard watering for other plant types
-    plant->setWaterLevel(plant->getWaterLevel() + 20);
+    plant->setWaterLevel(plant->getWaterLevel() + OtherPlantTraits::WATER_GAIN);
     std::cout << "Watering plant - standard care" << std::endl;
     (void)plant;
 }
@@ -14,14 +18,14 @@ void OtherPlantCareStrategy::water(Plant* plant) {
 
 void OtherPlantCareStrategy::fertilize(Plant* plant) {
     // Standard fertilization
-    plant->setNutrientLevel(plant->getNutrientLevel() + 10);
+    plant->setNutrientLevel(plant->getNutrientLevel() + OtherPlantTraits::NUTRIENT_GAIN);
     std::cout << "Fertilizing plant - standard feeding" << std::endl;
 }
 
 
 void OtherPlantCareStrategy::adjustSunlight(Plant* plant) {
     // Moderate sunlight for other plants
-    plant->setSunlightExposure(60);
+    plant->setSunlightExposure(OtherPlantTraits::SUNLIGHT_TARGET);
     std::cout << "Adjusting plant sunlight - moderate exposure" << std::endl;
 }
 
@@ -30,3 +34,8 @@ void OtherPlantCareStrategy::prune(Plant* plant) {
     std::cout << "Pruning plant - general maintenance" << std::endl;
 (void)plant;
 }
+
+void OtherPlantCareStrategy::careForBatch(CareAction action, Plant* const* plants, size_t count) {
+    SpeciesKernel<OtherPlantTraits>::care(action, plants, count);
+    std::cout << "Caring for " << count << " plants in one batch" << std::endl;
+}
@@ -1,6 +1,7 @@
 
 
 #include "include/PaymentProcessor.h"
+#include "include/TransactionJournal.h"
 #include <iostream>
 
 
@@ -16,6 +17,7 @@ void PaymentProcessor::processTransaction(FinalOrder* order) {
     double amount = order->calculateTotalPrice();
     processPayment(amount);
     confirmTransaction();
+    TransactionJournal::getInstance()->recordSale(order->getCustomerName(), amount);
     printReceipt(order);
 
     std::cout << "[Transaction] Payment completed successfully.\n";
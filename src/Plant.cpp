@@ -2,39 +2,57 @@
 #include "include/PlantObserver.h"
 #include "include/CareStrategy.h"
 #include "include/PlantState.h"
+#include "include/GrowingState.h"
+#include "include/MatureState.h"
+#include "include/FloweringState.h"
+#include "include/DeadState.h"
+#include "include/NotificationBatch.h"
+#include "include/PlantEventStream.h"
+#include "include/SimulationCalendar.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
 
 Plant::Plant(const std::string& name, const std::string& id, CareStrategy* careStrategy, PlantState* initialState) : strategy(careStrategy), state(initialState), plantName(name), plantID(id),
       age(0), waterLevel(100), sunlightExposure(50), nutrientLevel(100),
-      healthLevel(100), readyForSale(false), price(0.0) {
+      healthLevel(100), readyForSale(false), price(0.0),
+      observerSlots(), observerSpill(nullptr), inlineObserverCount(0), thresholdMask(0), species(PlantSpecies::Custom), dirtyEpoch(DirtyEpoch::current()), spriteId(NO_SPRITE_ID), pendingSlot(0), stateListener(nullptr), calendar(nullptr) {
 }
 
 Plant::Plant(const Plant& other) : strategy(nullptr), state(nullptr), plantName(other.plantName), plantID(other.plantID),
       age(other.age), waterLevel(other.waterLevel), 
       sunlightExposure(other.sunlightExposure), nutrientLevel(other.nutrientLevel),
       healthLevel(other.healthLevel), readyForSale(other.readyForSale), 
-      price(other.price) {
+      price(other.price), observerSlots(), observerSpill(nullptr), inlineObserverCount(0), thresholdMask(0), species(PlantSpecies::Custom), dirtyEpoch(DirtyEpoch::current()), spriteId(other.spriteId), pendingSlot(0), stateListener(nullptr), calendar(nullptr) {
 
 }
 
 Plant::~Plant() {
-    if (strategy != nullptr) {
-        delete strategy;
-        strategy = nullptr;
+    if (calendar != nullptr) {
+        calendar->forget(this);
     }
+
+    // The care strategy is a shared flyweight and is not owned by the plant
     if (state != nullptr) {
         delete state;
         state = nullptr;
     }
     
-    // Delete owned observers
-    for (PlantObserver* observer : ownedObservers) {
-        delete observer;
+    // Delete owned observers (they detach themselves while being deleted)
+    if (observerSpill != nullptr) {
+        std::vector<PlantObserver*> owned = observerSpill->owned;
+        observerSpill->owned.clear();
+        for (PlantObserver* observer : owned) {
+            delete observer;
+        }
+        delete observerSpill;
+        observerSpill = nullptr;
+    }
+    inlineObserverCount = 0;
+
+    if (pendingSlot != 0 && NotificationBatch::getActive() != nullptr) {
+        NotificationBatch::getActive()->forget(this);
     }
-    ownedObservers.clear();
-    observers.clear();
 }
 
 void Plant::performCare() {
@@ -44,10 +62,8 @@ void Plant::performCare() {
 }
 
 void Plant::setStrategy(CareStrategy* newStrategy) {
-    if (strategy != nullptr) {
-        delete strategy;
-    }
     strategy = newStrategy;
+    markDirty();
 }
 
 CareStrategy* Plant::getStrategy() const {
@@ -55,39 +71,78 @@ CareStrategy* Plant::getStrategy() const {
 }
 
 PlantState* Plant::getState() const {
+    syncWithCalendar();
     return state;
 }
 
 void Plant::setState(PlantState* newState) {
+    syncWithCalendar();
     if (state != nullptr && state != newState) {
         delete state;
     }
     state = newState;
+    markDirty();
     if (state != nullptr) {
-        std::string stateName = state->getStateName();
-        if (stateName == "Mature" || stateName == "Flowering") {
-            readyForSale = true;
-        } else if (stateName == "Dead") {
-            readyForSale = false;
-        } else {
-            readyForSale = false;
-        }
+        LifecycleStage stage = state->getStage();
+        readyForSale = (stage == LifecycleStage::Mature || stage == LifecycleStage::Flowering);
+        PlantEventStream::getInstance()->publish(PlantEventType::StateChanged, this, state->getStateName());
+    }
+    notifyStateListener();
+}
+
+void Plant::setStateListener(PlantStateListener* listener) {
+    stateListener = listener;
+}
+
+PlantStateListener* Plant::getStateListener() const {
+    return stateListener;
+}
+
+SimulationCalendar* Plant::getCalendar() const {
+    return calendar;
+}
+
+void Plant::notifyStateListener() {
+    if (stateListener != nullptr) {
+        stateListener->plantStatusChanged(this);
+    }
+}
+
+void Plant::syncWithCalendar() const {
+    if (calendar != nullptr) {
+        calendar->materialize(const_cast<Plant*>(this));
     }
 }
 
+Plant::ObserverSpill* Plant::getObserverSpill() {
+    if (observerSpill == nullptr) {
+        observerSpill = new ObserverSpill();
+    }
+    return observerSpill;
+}
+
 void Plant::attach(PlantObserver* observer) {
     if (observer == nullptr) {
         return;
     }
-    auto it = std::find(observers.begin(), observers.end(), observer);
-    if (it == observers.end()) {
-        observers.push_back(observer);
+    for (int i = 0; i < inlineObserverCount; i++) {
+        if (observerSlots[i] == observer) {
+            return;
+        }
+    }
+    if (inlineObserverCount < INLINE_OBSERVER_CAPACITY) {
+        observerSlots[inlineObserverCount++] = observer;
+        return;
+    }
+    std::vector<PlantObserver*>& extra = getObserverSpill()->observers;
+    if (std::find(extra.begin(), extra.end(), observer) == extra.end()) {
+        extra.push_back(observer);
     }
 }
 
 void Plant::addOwnedObserver(PlantObserver* observer) {
     if (observer != nullptr) {
-        ownedObservers.push_back(observer);
+        getObserverSpill()->owned.push_back(observer);
         // Observer attaches itself in its constructor
     }
 }
@@ -96,18 +151,67 @@ void Plant::detach(PlantObserver* observer) {
     if (observer == nullptr) {
         return;
     }
-    auto it = std::find(observers.begin(), observers.end(), observer);
-    if (it != observers.end()) {
-        observers.erase(it);
+    for (int i = 0; i < inlineObserverCount; i++) {
+        if (observerSlots[i] == observer) {
+            // Shift the remaining slots down to keep attach order
+            for (int j = i; j < inlineObserverCount - 1; j++) {
+                observerSlots[j] = observerSlots[j + 1];
+            }
+            inlineObserverCount--;
+
+            // Pull the oldest spilled observer back into the freed slot
+            if (observerSpill != nullptr && !observerSpill->observers.empty()) {
+                observerSlots[inlineObserverCount++] = observerSpill->observers.front();
+                observerSpill->observers.erase(observerSpill->observers.begin());
+            }
+            return;
+        }
+    }
+    if (observerSpill != nullptr) {
+        std::vector<PlantObserver*>& extra = observerSpill->observers;
+        auto it = std::find(extra.begin(), extra.end(), observer);
+        if (it != extra.end()) {
+            extra.erase(it);
+        }
     }
 }
 
 void Plant::notify() {
-    for (PlantObserver* observer : observers) {
-        if (observer != nullptr) {
-            observer->update(this);
+    if (inlineObserverCount == 0 && observerSpill == nullptr) {
+        return;
+    }
+    NotificationBatch* batch = NotificationBatch::getActive();
+    if (batch != nullptr) {
+        if (pendingSlot == 0) {
+            batch->defer(this);
         }
+        return;
+    }
+
+    for (int i = 0; i < inlineObserverCount; i++) {
+        observerSlots[i]->update(this);
     }
+    if (observerSpill != nullptr) {
+        for (size_t i = 0; i < observerSpill->observers.size(); i++) {
+            observerSpill->observers[i]->update(this);
+        }
+    }
+}
+
+int Plant::getObserverCount() const {
+    int count = inlineObserverCount;
+    if (observerSpill != nullptr) {
+        count += static_cast<int>(observerSpill->observers.size());
+    }
+    return count;
+}
+
+unsigned char Plant::getThresholdMask() const {
+    return thresholdMask;
+}
+
+void Plant::setThresholdMask(unsigned char mask) {
+    thresholdMask = mask;
 }
 
 std::string Plant::getName() const {
@@ -119,17 +223,21 @@ std::string Plant::getID() const {
 }
 
 int Plant::getAge() const {
+    syncWithCalendar();
     return age;
 }
 
 int Plant::getWaterLevel() const {
+    syncWithCalendar();
     return waterLevel;
 }
 
 void Plant::setWaterLevel(int level) {
+    syncWithCalendar();
     waterLevel = level;
     if (waterLevel < 0) waterLevel = 0;
     if (waterLevel > 100) waterLevel = 100;
+    markDirty();
 }
 
 int Plant::getSunlightExposure() const {
@@ -137,57 +245,102 @@ int Plant::getSunlightExposure() const {
 }
 
 void Plant::setSunlightExposure(int hours) {
+    syncWithCalendar();
     sunlightExposure = hours;
     if (sunlightExposure < 0) sunlightExposure = 0;
     if (sunlightExposure > 100) sunlightExposure = 100;
+    markDirty();
 }
 
 int Plant::getNutrientLevel() const {
+    syncWithCalendar();
     return nutrientLevel;
 }
 
 void Plant::setNutrientLevel(int level) {
+    syncWithCalendar();
     nutrientLevel = level;
     if (nutrientLevel < 0) nutrientLevel = 0;
     if (nutrientLevel > 100) nutrientLevel = 100;
+    markDirty();
 }
 
 int Plant::getHealthLevel() const {
+    syncWithCalendar();
     return healthLevel;
 }
 
 void Plant::updateHealth() {
     healthLevel = (waterLevel + nutrientLevel + sunlightExposure) / 3;
+    markDirty();
 }
 
 bool Plant::isReadyForSale() const {
+    syncWithCalendar();
     return readyForSale;
 }
 
 void Plant::setReadyForSale(bool ready) {
+    syncWithCalendar();
+    if (readyForSale == ready) {
+        return;
+    }
     readyForSale = ready;
+    markDirty();
+    notifyStateListener();
 }
 
 double Plant::getPrice() const {
+    syncWithCalendar();
     return price;
 }
 
 void Plant::setPrice(double newPrice) {
+    syncWithCalendar();
     if (newPrice >= 0) {
         price = newPrice;
+        markDirty();
     }
 }
 
 void Plant::incrementAge() {
+    syncWithCalendar();
     age++;
+    markDirty();
+}
+
+int Plant::getDailyWaterLoss() const {
+    return PlantTraits::DAILY_WATER_LOSS;
+}
+
+int Plant::getDailyNutrientLoss() const {
+    return PlantTraits::DAILY_NUTRIENT_LOSS;
+}
+
+void Plant::setSpecies(PlantSpecies newSpecies) {
+    species = newSpecies;
+}
+
+PlantSpecies Plant::getSpecies() const {
+    return species;
+}
+
+uint32_t Plant::getDirtyEpoch() const {
+    return dirtyEpoch;
+}
+
+int Plant::getSpriteId() const {
+    return spriteId;
+}
+
+void Plant::setSpriteId(int id) {
+    spriteId = id;
 }
 
 void Plant::dailyUpdate() {
     incrementAge();
-    waterLevel -= 10;
-    if (waterLevel < 0) waterLevel = 0;
-    nutrientLevel -= 5;
-    if (nutrientLevel < 0) nutrientLevel = 0;
+    setWaterLevel(waterLevel - getDailyWaterLoss());
+    setNutrientLevel(nutrientLevel - getDailyNutrientLoss());
     
     updateHealth();
     notify();
@@ -196,6 +349,230 @@ void Plant::dailyUpdate() {
     }
 }
 
+void Plant::advanceDays(int days) {
+    if (days <= 0) {
+        return;
+    }
+
+    // Observers expect one notification per day, and gains are not closed-form
+    if (getObserverCount() > 0 || getDailyWaterLoss() < 0 || getDailyNutrientLoss() < 0) {
+        for (int day = 0; day < days; day++) {
+            dailyUpdate();
+        }
+        return;
+    }
+
+    fastForward(days, getDailyWaterLoss(), getDailyNutrientLoss());
+}
+
+void Plant::advanceDaysMaintained(int days) {
+    if (days <= 0) {
+        return;
+    }
+    fastForward(days, 0, 0);
+}
+
+int Plant::projectedHealth(int days, int waterLoss, int nutrientLoss) const {
+    long long water = std::max(0LL, waterLevel - static_cast<long long>(waterLoss) * days);
+    long long nutrients = std::max(0LL, nutrientLevel - static_cast<long long>(nutrientLoss) * days);
+    return static_cast<int>((water + nutrients + sunlightExposure) / 3);
+}
+
+int Plant::firstDayHealthBelow(int threshold, int horizon, int waterLoss, int nutrientLoss) const {
+    // Decay is linear and clamped at 0, so projected health never increases
+    int lo = 1;
+    int hi = horizon + 1;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (projectedHealth(mid, waterLoss, nutrientLoss) < threshold) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+int Plant::getWaterLevelAfter(int days) const {
+    syncWithCalendar();
+    return static_cast<int>(std::max(0LL, waterLevel - static_cast<long long>(getDailyWaterLoss()) * days));
+}
+
+int Plant::getNutrientLevelAfter(int days) const {
+    syncWithCalendar();
+    return static_cast<int>(std::max(0LL, nutrientLevel - static_cast<long long>(getDailyNutrientLoss()) * days));
+}
+
+int Plant::getHealthLevelAfter(int days) const {
+    syncWithCalendar();
+    return projectedHealth(days, getDailyWaterLoss(), getDailyNutrientLoss());
+}
+
+int Plant::daysUntilStateChange(int horizon) const {
+    if (state == nullptr || horizon <= 0) {
+        return horizon + 1;
+    }
+
+    int waterLoss = getDailyWaterLoss();
+    int nutrientLoss = getDailyNutrientLoss();
+    LifecycleStage stage = state->getStage();
+
+    if (stage == LifecycleStage::Seedling || stage == LifecycleStage::Growing) {
+        int dies = firstDayHealthBelow(LifecycleTraits::YOUNG_DIES_BELOW, horizon, waterLoss, nutrientLoss);
+        int grows = std::max(1, (stage == LifecycleStage::Seedling ? LifecycleTraits::SEEDLING_GROWS_AT_AGE
+                                                                   : LifecycleTraits::GROWING_MATURES_AT_AGE) - age);
+        if (grows > horizon || projectedHealth(grows, waterLoss, nutrientLoss) < LifecycleTraits::GROWS_AT_HEALTH) {
+            grows = horizon + 1;
+        }
+        return std::min(dies, grows);
+    }
+    if (stage == LifecycleStage::Mature) {
+        int dies = firstDayHealthBelow(LifecycleTraits::ADULT_DIES_BELOW, horizon, waterLoss, nutrientLoss);
+        int blooms = std::max(1, LifecycleTraits::MATURE_FLOWERS_AT_AGE - age);
+        if (blooms > horizon || projectedHealth(blooms, waterLoss, nutrientLoss) < LifecycleTraits::FLOWERS_AT_HEALTH) {
+            blooms = horizon + 1;
+        }
+        return std::min(dies, blooms);
+    }
+    if (stage == LifecycleStage::Flowering) {
+        int dies = firstDayHealthBelow(LifecycleTraits::ADULT_DIES_BELOW, horizon, waterLoss, nutrientLoss);
+        return std::min(dies, std::min(horizon + 1, std::max(1, LifecycleTraits::FLOWERING_ENDS_AT_AGE - age)));
+    }
+    if (stage == LifecycleStage::Dead) {
+        return horizon + 1;
+    }
+
+    // Unknown states may change on any day
+    return 1;
+}
+
+void Plant::fastForward(int days, int waterLoss, int nutrientLoss) {
+    bool wasReady = readyForSale;
+
+    auto healthAfter = [&](int k) {
+        return projectedHealth(k, waterLoss, nutrientLoss);
+    };
+
+    // First day in [1, days] on which health is below the threshold, or days + 1
+    auto firstDayBelow = [&](int threshold) {
+        return firstDayHealthBelow(threshold, days, waterLoss, nutrientLoss);
+    };
+
+    auto advance = [&](int k) {
+        age += k;
+        waterLevel = static_cast<int>(std::max(0LL, waterLevel - static_cast<long long>(waterLoss) * k));
+        nutrientLevel = static_cast<int>(std::max(0LL, nutrientLevel - static_cast<long long>(nutrientLoss) * k));
+        updateHealth();
+        days -= k;
+    };
+
+    // FloweringState raises the price each day while it is under the cap
+    auto applyBloomPricing = [&](int bloomDays) {
+        for (int i = 0; i < bloomDays && getPrice() > 0.0 && getPrice() < LifecycleTraits::BLOOM_PRICE_CAP; i++) {
+            setPrice(getPrice() * LifecycleTraits::BLOOM_PRICE_MULTIPLIER);
+        }
+    };
+
+    while (days > 0) {
+        if (state == nullptr) {
+            advance(days);
+            break;
+        }
+
+        LifecycleStage stage = state->getStage();
+
+        if (stage == LifecycleStage::Seedling || stage == LifecycleStage::Growing) {
+            bool seedling = (stage == LifecycleStage::Seedling);
+            int dies = firstDayBelow(LifecycleTraits::YOUNG_DIES_BELOW);
+            int grows = std::max(1, (seedling ? LifecycleTraits::SEEDLING_GROWS_AT_AGE
+                                              : LifecycleTraits::GROWING_MATURES_AT_AGE) - age);
+            if (grows > days || healthAfter(grows) < LifecycleTraits::GROWS_AT_HEALTH) {
+                grows = days + 1;
+            }
+
+            if (dies <= days && dies < grows) {
+                advance(dies);
+                setState(new DeadState());
+            } else if (grows <= days) {
+                advance(grows);
+                if (seedling) {
+                    setState(new GrowingState());
+                } else {
+                    setState(new MatureState());
+                }
+            } else {
+                advance(days);
+            }
+        } else if (stage == LifecycleStage::Mature) {
+            // Two days before flowering ends for good, a healthy plant alternates
+            // Mature -> Flowering -> Mature every two days
+            if (age + 2 >= LifecycleTraits::FLOWERING_ENDS_AT_AGE) {
+                int cycles = std::min(days / 2, std::min(firstDayBelow(LifecycleTraits::FLOWERS_AT_HEALTH) / 2,
+                                                         (firstDayBelow(LifecycleTraits::ADULT_DIES_BELOW) - 1) / 2));
+                if (cycles > 0) {
+                    advance(2 * cycles);
+                    readyForSale = true;
+                    applyBloomPricing(cycles);
+                    continue;
+                }
+            }
+
+            int dies = firstDayBelow(LifecycleTraits::ADULT_DIES_BELOW);
+            int blooms = std::max(1, LifecycleTraits::MATURE_FLOWERS_AT_AGE - age);
+            if (blooms > days || healthAfter(blooms) < LifecycleTraits::FLOWERS_AT_HEALTH) {
+                blooms = days + 1;
+            }
+
+            if (dies <= days && dies < blooms) {
+                readyForSale = readyForSale || dies > 1;
+                advance(dies);
+                setState(new DeadState());
+            } else if (blooms <= days) {
+                readyForSale = readyForSale || blooms > 1;
+                advance(blooms);
+                setState(new FloweringState());
+            } else {
+                readyForSale = true;
+                advance(days);
+            }
+        } else if (stage == LifecycleStage::Flowering) {
+            int dies = firstDayBelow(LifecycleTraits::ADULT_DIES_BELOW);
+            int fades = std::max(1, LifecycleTraits::FLOWERING_ENDS_AT_AGE - age);
+
+            if (dies <= days && dies <= fades) {
+                if (dies > 1) {
+                    readyForSale = true;
+                    applyBloomPricing(dies - 1);
+                }
+                advance(dies);
+                setState(new DeadState());
+            } else if (fades <= days) {
+                readyForSale = true;
+                applyBloomPricing(fades);
+                advance(fades);
+                setState(new MatureState());
+            } else {
+                readyForSale = true;
+                applyBloomPricing(days);
+                advance(days);
+            }
+        } else if (stage == LifecycleStage::Dead) {
+            advance(days);
+            readyForSale = false;
+            setPrice(0.0);
+        } else {
+            // Unknown states are evaluated one day at a time
+            advance(1);
+            state->handleChange(this);
+        }
+    }
+
+    // State changes notified through setState(); readiness can also change without one
+    if (readyForSale != wasReady) {
+        notifyStateListener();
+    }
+}
+
 void Plant::updateCondition() {
     waterLevel -= 5;
     if (waterLevel < 0) waterLevel = 0;
@@ -206,6 +583,7 @@ void Plant::updateCondition() {
 }
 
 std::string Plant::toString() const {
+    syncWithCalendar();
     std::ostringstream output;
     output << "Plant: " << plantName << "\n"
            << "ID: " << plantID << "\n"
@@ -0,0 +1,68 @@
+#include "include/PlantEventQueue.h"
+
+PlantEventQueue::PlantEventQueue(size_t capacity)
+    : mask_(0), pushPos_(0), popPos_(0), dropped_(0) {
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask_ = size - 1;
+    cells_.reset(new Cell[size]);
+    for (size_t i = 0; i < size; i++) {
+        cells_[i].turn.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool PlantEventQueue::tryPush(const PlantEvent& event) {
+    size_t pos = pushPos_.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    for (;;) {
+        cell = &cells_[pos & mask_];
+        size_t turn = cell->turn.load(std::memory_order_acquire);
+        if (turn == pos) {
+            // The cell is free for this position; claim the position
+            if (pushPos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (turn < pos) {
+            // Still holds the event from one lap ago: the ring is full
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = pushPos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->event = event;
+    cell->turn.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool PlantEventQueue::tryPop(PlantEvent& event) {
+    Cell& cell = cells_[popPos_ & mask_];
+    if (cell.turn.load(std::memory_order_acquire) != popPos_ + 1) {
+        return false;
+    }
+    event = cell.event;
+    // Hand the cell to the producer one lap ahead
+    cell.turn.store(popPos_ + mask_ + 1, std::memory_order_release);
+    popPos_++;
+    return true;
+}
+
+size_t PlantEventQueue::drain(std::vector<PlantEvent>& out, size_t maxEvents) {
+    size_t count = 0;
+    PlantEvent event;
+    while (count < maxEvents && tryPop(event)) {
+        out.push_back(event);
+        count++;
+    }
+    return count;
+}
+
+size_t PlantEventQueue::getCapacity() const {
+    return mask_ + 1;
+}
+
+unsigned long long PlantEventQueue::getDroppedCount() const {
+    return dropped_.load(std::memory_order_relaxed);
+}
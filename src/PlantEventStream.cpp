@@ -0,0 +1,109 @@
+#include "include/PlantEventStream.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+char retiringTag;
+
+/**
+ * @brief Marks a slot whose queue is being unsubscribed: nothing is delivered to it and it is not reused yet.
+ */
+PlantEventQueue* retiring() {
+    return reinterpret_cast<PlantEventQueue*>(&retiringTag);
+}
+
+bool isDeliverable(const PlantEventQueue* queue) {
+    return queue != nullptr && queue != retiring();
+}
+
+} // namespace
+
+PlantEventStream* PlantEventStream::getInstance() {
+    static PlantEventStream instance;
+    return &instance;
+}
+
+PlantEventStream::PlantEventStream() : subscriberCount_(0), nextSequence_(0) {
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        subscribers_[i].store(nullptr, std::memory_order_relaxed);
+        delivering_[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+bool PlantEventStream::subscribe(PlantEventQueue* queue) {
+    if (queue == nullptr) {
+        return false;
+    }
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (subscribers_[i].load(std::memory_order_acquire) == queue) {
+            return false;
+        }
+    }
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        PlantEventQueue* empty = nullptr;
+        if (subscribers_[i].compare_exchange_strong(empty, queue, std::memory_order_acq_rel)) {
+            subscriberCount_.fetch_add(1, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+void PlantEventStream::unsubscribe(PlantEventQueue* queue) {
+    if (queue == nullptr) {
+        return;
+    }
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        PlantEventQueue* expected = queue;
+        if (subscribers_[i].compare_exchange_strong(expected, retiring(), std::memory_order_seq_cst)) {
+            subscriberCount_.fetch_sub(1, std::memory_order_release);
+            // A publisher that read the slot before it was retired may still be pushing to the queue;
+            // later ones skip the slot without counting themselves, so this only waits for those
+            while (delivering_[i].load(std::memory_order_seq_cst) != 0) {
+                std::this_thread::yield();
+            }
+            subscribers_[i].store(nullptr, std::memory_order_release);
+            return;
+        }
+    }
+}
+
+bool PlantEventStream::hasSubscribers() const {
+    return subscriberCount_.load(std::memory_order_acquire) > 0;
+}
+
+void PlantEventStream::publish(PlantEventType type, const Plant* plant, const std::string& detail,
+                               int row, int col) {
+    if (!hasSubscribers()) {
+        return;
+    }
+
+    PlantEvent event;
+    event.sequence = nextSequence_.fetch_add(1, std::memory_order_relaxed);
+    event.type = type;
+    event.plant = plant;
+    event.row = row;
+    event.col = col;
+    size_t length = std::min(detail.size(), PlantEvent::DETAIL_SIZE - 1);
+    std::memcpy(event.detail, detail.data(), length);
+    event.detail[length] = '\0';
+
+    for (int i = 0; i < MAX_SUBSCRIBERS; i++) {
+        if (!isDeliverable(subscribers_[i].load(std::memory_order_relaxed))) {
+            continue;
+        }
+        // Announced before re-reading the slot, so unsubscribe() either sees it or we see the retired slot
+        delivering_[i].fetch_add(1, std::memory_order_seq_cst);
+        PlantEventQueue* queue = subscribers_[i].load(std::memory_order_seq_cst);
+        if (isDeliverable(queue)) {
+            queue->tryPush(event);
+        }
+        delivering_[i].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+unsigned long long PlantEventStream::getPublishedCount() const {
+    return nextSequence_.load(std::memory_order_relaxed);
+}
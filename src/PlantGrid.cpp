@@ -0,0 +1,330 @@
+#include "include/PlantGrid.h"
+#include "include/DirtyEpoch.h"
+#include <algorithm>
+
+// ============================================================================
+// PlantGridView::Iterator
+// ============================================================================
+
+PlantGridView::Iterator::Iterator(const PlantGrid* grid, const GridRegion& region, bool atEnd)
+    : grid_(grid), region_(region), row_(region.row), col_(region.col),
+      sparsePos_(grid->sparseCells_.end()) {
+    if (atEnd || region_.rowCount <= 0 || region_.colCount <= 0) {
+        row_ = region_.row + std::max(region_.rowCount, 0);
+        return;
+    }
+    if (grid_->storage_ == GridStorage::Sparse) {
+        sparsePos_ = grid_->sparseCells_.lower_bound(grid_->keyOf(region_.row, region_.col));
+        skipOutsideRegion();
+    } else {
+        skipEmpty();
+    }
+}
+
+Plant* PlantGridView::Iterator::operator*() const {
+    if (grid_->storage_ == GridStorage::Sparse) {
+        return sparsePos_->second;
+    }
+    return grid_->cells_[static_cast<size_t>(grid_->keyOf(row_, col_))];
+}
+
+PlantGridView::Iterator& PlantGridView::Iterator::operator++() {
+    if (grid_->storage_ == GridStorage::Sparse) {
+        ++sparsePos_;
+        skipOutsideRegion();
+        return *this;
+    }
+    col_++;
+    if (col_ >= region_.col + region_.colCount) {
+        col_ = region_.col;
+        row_++;
+    }
+    skipEmpty();
+    return *this;
+}
+
+bool PlantGridView::Iterator::operator!=(const Iterator& other) const {
+    if (grid_->storage_ == GridStorage::Sparse) {
+        return sparsePos_ != other.sparsePos_;
+    }
+    return row_ != other.row_ || col_ != other.col_;
+}
+
+bool PlantGridView::Iterator::operator==(const Iterator& other) const {
+    return !(*this != other);
+}
+
+int PlantGridView::Iterator::getRow() const {
+    if (grid_->storage_ == GridStorage::Sparse && sparsePos_ != grid_->sparseCells_.end()) {
+        return static_cast<int>(sparsePos_->first / grid_->cols_);
+    }
+    return row_;
+}
+
+int PlantGridView::Iterator::getColumn() const {
+    if (grid_->storage_ == GridStorage::Sparse && sparsePos_ != grid_->sparseCells_.end()) {
+        return static_cast<int>(sparsePos_->first % grid_->cols_);
+    }
+    return col_;
+}
+
+void PlantGridView::Iterator::skipEmpty() {
+    int endRow = region_.row + region_.rowCount;
+    while (row_ < endRow && grid_->cells_[static_cast<size_t>(grid_->keyOf(row_, col_))] == nullptr) {
+        col_++;
+        if (col_ >= region_.col + region_.colCount) {
+            col_ = region_.col;
+            row_++;
+        }
+    }
+}
+
+void PlantGridView::Iterator::skipOutsideRegion() {
+    const PlantGrid::SparseCells& cells = grid_->sparseCells_;
+    long long endKey = grid_->keyOf(region_.row + region_.rowCount, 0);
+    bool fullWidth = (region_.col == 0 && region_.colCount == grid_->cols_);
+    int endCol = region_.col + region_.colCount;
+
+    while (sparsePos_ != cells.end() && sparsePos_->first < endKey) {
+        if (fullWidth) {
+            return;
+        }
+        int row = static_cast<int>(sparsePos_->first / grid_->cols_);
+        int col = static_cast<int>(sparsePos_->first % grid_->cols_);
+        if (col < region_.col) {
+            sparsePos_ = cells.lower_bound(grid_->keyOf(row, region_.col));
+        } else if (col >= endCol) {
+            sparsePos_ = cells.lower_bound(grid_->keyOf(row + 1, region_.col));
+        } else {
+            return;
+        }
+    }
+
+    // Exhausted: match the position end() reports
+    sparsePos_ = cells.end();
+}
+
+// ============================================================================
+// PlantGridView
+// ============================================================================
+
+PlantGridView::PlantGridView(const PlantGrid* grid, const GridRegion& region)
+    : grid_(grid), region_(region) {
+}
+
+PlantGridView::Iterator PlantGridView::begin() const {
+    return Iterator(grid_, region_, false);
+}
+
+PlantGridView::Iterator PlantGridView::end() const {
+    return Iterator(grid_, region_, true);
+}
+
+const GridRegion& PlantGridView::getRegion() const {
+    return region_;
+}
+
+int PlantGridView::countPlants() const {
+    if (region_.row == 0 && region_.col == 0 &&
+        region_.rowCount == grid_->rows_ && region_.colCount == grid_->cols_) {
+        return grid_->plantCount_;
+    }
+    int count = 0;
+    for (Iterator it = begin(); it != end(); ++it) {
+        count++;
+    }
+    return count;
+}
+
+bool PlantGridView::empty() const {
+    return !(begin() != end());
+}
+
+std::vector<Plant*> PlantGridView::toVector() const {
+    std::vector<Plant*> plants;
+    for (Plant* plant : *this) {
+        plants.push_back(plant);
+    }
+    return plants;
+}
+
+// ============================================================================
+// PlantGrid
+// ============================================================================
+
+PlantGrid::PlantGrid(int rows, int cols, GridStorage storage)
+    : rows_(std::max(rows, 0)), cols_(std::max(cols, 0)), storage_(storage), plantCount_(0), changedEpoch_(0) {
+    if (storage_ == GridStorage::Dense) {
+        cells_.assign(static_cast<size_t>(rows_) * cols_, nullptr);
+        cellEpochs_.assign(cells_.size(), 0);
+    }
+}
+
+int PlantGrid::getRows() const {
+    return rows_;
+}
+
+int PlantGrid::getColumns() const {
+    return cols_;
+}
+
+GridStorage PlantGrid::getStorage() const {
+    return storage_;
+}
+
+int PlantGrid::getPlantCount() const {
+    return plantCount_;
+}
+
+int PlantGrid::getCapacity() const {
+    return rows_ * cols_;
+}
+
+bool PlantGrid::isInBounds(int row, int col) const {
+    return row >= 0 && row < rows_ && col >= 0 && col < cols_;
+}
+
+Plant* PlantGrid::getPlantAt(int row, int col) const {
+    if (!isInBounds(row, col)) {
+        return nullptr;
+    }
+    if (storage_ == GridStorage::Sparse) {
+        SparseCells::const_iterator it = sparseCells_.find(keyOf(row, col));
+        return it != sparseCells_.end() ? it->second : nullptr;
+    }
+    return cells_[static_cast<size_t>(keyOf(row, col))];
+}
+
+void PlantGrid::setPlantAt(int row, int col, Plant* plant) {
+    if (!isInBounds(row, col)) {
+        return;
+    }
+
+    if (storage_ == GridStorage::Sparse) {
+        long long key = keyOf(row, col);
+        noteChange(key);
+        if (plant == nullptr) {
+            plantCount_ -= static_cast<int>(sparseCells_.erase(key));
+        } else {
+            std::pair<SparseCells::iterator, bool> inserted = sparseCells_.insert(std::make_pair(key, plant));
+            if (inserted.second) {
+                plantCount_++;
+            } else {
+                inserted.first->second = plant;
+            }
+        }
+        return;
+    }
+
+    size_t key = static_cast<size_t>(keyOf(row, col));
+    Plant*& cell = cells_[key];
+    plantCount_ += (plant != nullptr) - (cell != nullptr);
+    cell = plant;
+    noteChange(static_cast<long long>(key));
+}
+
+void PlantGrid::noteChange(long long key) {
+    uint32_t epoch = DirtyEpoch::current();
+    if (epoch != changedEpoch_) {
+        // The checkpoint that closed the old epoch has already written these cells
+        changedCells_.clear();
+        sparseChanged_.clear();
+        changedEpoch_ = epoch;
+    }
+    if (storage_ == GridStorage::Sparse) {
+        sparseChanged_.insert(key);
+        return;
+    }
+    uint32_t& cellEpoch = cellEpochs_[static_cast<size_t>(key)];
+    if (cellEpoch != epoch) {
+        cellEpoch = epoch;
+        changedCells_.push_back(key);
+    }
+}
+
+uint32_t PlantGrid::getCellEpoch(int row, int col) const {
+    if (!isInBounds(row, col)) {
+        return 0;
+    }
+    if (storage_ == GridStorage::Sparse) {
+        return sparseChanged_.count(keyOf(row, col)) != 0 ? changedEpoch_ : 0;
+    }
+    return cellEpochs_[static_cast<size_t>(keyOf(row, col))];
+}
+
+bool PlantGrid::findPosition(const Plant* plant, int& row, int& col) const {
+    if (plant == nullptr) {
+        return false;
+    }
+
+    long long key = -1;
+    if (storage_ == GridStorage::Sparse) {
+        for (const auto& cell : sparseCells_) {
+            if (cell.second == plant) {
+                key = cell.first;
+                break;
+            }
+        }
+    } else {
+        auto it = std::find(cells_.begin(), cells_.end(), plant);
+        if (it != cells_.end()) {
+            key = it - cells_.begin();
+        }
+    }
+
+    if (key < 0) {
+        return false;
+    }
+    row = static_cast<int>(key / cols_);
+    col = static_cast<int>(key % cols_);
+    return true;
+}
+
+void PlantGrid::clear() {
+    for (size_t key = 0; key < cells_.size(); key++) {
+        if (cells_[key] != nullptr) {
+            cells_[key] = nullptr;
+            noteChange(static_cast<long long>(key));
+        }
+    }
+    for (const auto& cell : sparseCells_) {
+        noteChange(cell.first);
+    }
+    sparseCells_.clear();
+    plantCount_ = 0;
+}
+
+GridRegion PlantGrid::clip(const GridRegion& region) const {
+    int top = std::max(region.row, 0);
+    int left = std::max(region.col, 0);
+    int bottom = std::min(region.row + region.rowCount, rows_);
+    int right = std::min(region.col + region.colCount, cols_);
+    if (bottom <= top || right <= left) {
+        return GridRegion{0, 0, 0, 0};
+    }
+    return GridRegion{top, left, bottom - top, right - left};
+}
+
+GridRegion PlantGrid::getRowRange(int firstRow, int rowCount) const {
+    return clip(GridRegion{firstRow, 0, rowCount, cols_});
+}
+
+GridRegion PlantGrid::getColumnRange(int firstCol, int colCount) const {
+    return clip(GridRegion{0, firstCol, rows_, colCount});
+}
+
+PlantGridView PlantGrid::getAll() const {
+    return getRegion(GridRegion{0, 0, rows_, cols_});
+}
+
+PlantGridView PlantGrid::getRow(int row) const {
+    return getRegion(GridRegion{row, 0, 1, cols_});
+}
+
+PlantGridView PlantGrid::getColumn(int col) const {
+    return getRegion(GridRegion{0, col, rows_, 1});
+}
+
+PlantGridView PlantGrid::getRegion(const GridRegion& region) const {
+    return PlantGridView(this, clip(region));
+}
@@ -0,0 +1,66 @@
+#include "include/RegionCareCommand.h"
+#include "include/Greenhouse.h"
+#include "include/Plant.h"
+#include "include/CareStrategy.h"
+#include "include/TransactionJournal.h"
+#include <iostream>
+
+RegionCareCommand::RegionCareCommand(Greenhouse* greenhouse, const GridRegion& region, CareAction action)
+    : greenhouse_(greenhouse), region_(region), action_(action), lastPlantCount_(0) {
+}
+
+RegionCareCommand::RegionCareCommand(Greenhouse* greenhouse, const std::string& zoneName, CareAction action)
+    : greenhouse_(greenhouse), region_(GridRegion{0, 0, 0, 0}), zoneName_(zoneName),
+      action_(action), lastPlantCount_(0) {
+}
+
+void RegionCareCommand::execute() {
+    lastPlantCount_ = 0;
+    if (greenhouse_ == nullptr) {
+        return;
+    }
+
+    GridRegion region = region_;
+    if (!zoneName_.empty() && !greenhouse_->getZone(zoneName_, region)) {
+        std::cout << "[RegionCareCommand] Unknown zone '" << zoneName_ << "'" << std::endl;
+        return;
+    }
+
+    for (StrategyBatch& batch : batches_) {
+        batch.plants.clear();
+    }
+
+    // One pass over the grid, grouping plants by their flyweight strategy
+    size_t current = 0;
+    greenhouse_->forEachPlant(region, [this, &current](Plant* plant, int, int) {
+        CareStrategy* strategy = plant->getStrategy();
+        if (strategy == nullptr) {
+            return;
+        }
+        if (current >= batches_.size() || batches_[current].strategy != strategy) {
+            current = 0;
+            while (current < batches_.size() && batches_[current].strategy != strategy) {
+                current++;
+            }
+            if (current == batches_.size()) {
+                batches_.push_back(StrategyBatch{strategy, std::vector<Plant*>()});
+            }
+        }
+        batches_[current].plants.push_back(plant);
+    });
+
+    TransactionJournal* journal = TransactionJournal::getInstance();
+    for (StrategyBatch& batch : batches_) {
+        batch.strategy->careForBatch(action_, batch.plants.data(), batch.plants.size());
+        lastPlantCount_ += static_cast<int>(batch.plants.size());
+        if (journal->isOpen()) {
+            for (Plant* plant : batch.plants) {
+                journal->recordCare(plant, action_);
+            }
+        }
+    }
+}
+
+int RegionCareCommand::getLastPlantCount() const {
+    return lastPlantCount_;
+}
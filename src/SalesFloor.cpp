@@ -6,30 +6,18 @@
 #include <algorithm>
 #include <sstream>
 
-SalesFloor::SalesFloor(NurseryMediator* med, int numRows, int numCols): Colleague(med), rows(numRows), cols(numCols), currentNumberOfPlants(0){
+SalesFloor::SalesFloor(NurseryMediator* med, int numRows, int numCols): Colleague(med), displayGrid(numRows, numCols), rows(numRows), cols(numCols), currentNumberOfPlants(0), changeCount(0){
     
     capacity = rows * cols;
     
-    displayGrid.resize(rows);
-
-    for(int i = 0; i < rows; i++){
-        displayGrid[i].resize(cols, nullptr);
-    }
-    
     std::cout << "Sales floor created with " << rows << "x" << cols << " grid\n";
 }
 
 SalesFloor::~SalesFloor() {
     // Delete all plants still on display
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            if (displayGrid[i][j] != nullptr) {
-                delete displayGrid[i][j];
-                displayGrid[i][j] = nullptr;
-            }
-        }
-        displayGrid[i].clear();
-    }
+    displayGrid.forEachPlant([](Plant* plant, int, int) {
+        delete plant;
+    });
     displayGrid.clear();
     currentCustomers.clear();
 }
@@ -45,7 +33,7 @@ bool SalesFloor::addPlantToDisplay(Plant* plant, int row, int col){
         return false;
     }
     
-    if(displayGrid[row][col] != nullptr){
+    if(displayGrid.getPlantAt(row, col) != nullptr){
         std::cout << "Display position (" << row << "," << col << ") is occupied\n";
         return false;
     }
@@ -55,8 +43,9 @@ bool SalesFloor::addPlantToDisplay(Plant* plant, int row, int col){
         return false;
     }
     
-    displayGrid[row][col] = plant;
+    displayGrid.setPlantAt(row, col, plant);
     currentNumberOfPlants++;
+    changeCount++;
     
     std::cout << "Plant " << plant->getID() << " added to sales floor display at (" << row << "," << col << ")\n";
     
@@ -72,21 +61,17 @@ void SalesFloor::removePlantFromDisplay(Plant* plant){
         return;
     }
     
-    for(int i = 0; i < rows; i++){
-        for(int j = 0; j < cols; j++){
-
-            if(displayGrid[i][j] == plant){
-                displayGrid[i][j] = nullptr;
-                currentNumberOfPlants--;
-                
-                std::cout << "Plant " << plant->getID() << " removed from sales floor\n";
-                
-                if(mediator != nullptr){
-                    mediator->notify(this);
-                }
-                
-                return;
-            }
+    int row = 0;
+    int col = 0;
+    if(displayGrid.findPosition(plant, row, col)){
+        displayGrid.setPlantAt(row, col, nullptr);
+        currentNumberOfPlants--;
+        changeCount++;
+        
+        std::cout << "Plant " << plant->getID() << " removed from sales floor\n";
+        
+        if(mediator != nullptr){
+            mediator->notify(this);
         }
     }
 }
@@ -96,11 +81,12 @@ Plant* SalesFloor::removePlantAt(int row, int col){
         return nullptr;
     }
     
-    Plant* plant = displayGrid[row][col];
+    Plant* plant = displayGrid.getPlantAt(row, col);
     
     if(plant != nullptr){
-        displayGrid[row][col] = nullptr;
+        displayGrid.setPlantAt(row, col, nullptr);
         currentNumberOfPlants--;
+        changeCount++;
         
         std::cout << "Plant removed from sales floor at (" << row << "," << col << ")\n";
         
@@ -113,11 +99,7 @@ Plant* SalesFloor::removePlantAt(int row, int col){
 }
 
 Plant* SalesFloor::getPlantAt(int row, int col)const{
-    if(row < 0 || row >= rows || col < 0 || col >= cols){
-        return nullptr;
-    }
-
-    return displayGrid[row][col];
+    return displayGrid.getPlantAt(row, col);
 }
 
 void SalesFloor::addCustomer(Customer* customer){
@@ -146,18 +128,7 @@ void SalesFloor::removeCustomer(Customer* customer){
 }
 
 std::vector<Plant*> SalesFloor::getDisplayPlants()const{
-    std::vector<Plant*> allPlants;
-    
-    for(int i = 0; i < rows; i++){ // flatted grid into a vector
-        for(int j = 0; j < cols; j++){
-
-            if(displayGrid[i][j] != nullptr){
-                allPlants.push_back(displayGrid[i][j]);
-            }
-        }
-    }
-    
-    return allPlants;
+    return displayGrid.getAll().toVector();
 }
 
 std::vector<Customer*> SalesFloor::getCurrentCustomers()const{
@@ -165,37 +136,11 @@ std::vector<Customer*> SalesFloor::getCurrentCustomers()const{
 }
 
 std::vector<Plant*> SalesFloor::getPlantsInRow(int row)const{
-    std::vector<Plant*> rowPlants;
-    
-    if(row < 0 || row >= rows){
-        return rowPlants;
-    }
-    
-    for(int j = 0; j < cols; j++){
-
-        if(displayGrid[row][j] != nullptr){
-            rowPlants.push_back(displayGrid[row][j]);
-        }
-    }
-    
-    return rowPlants;
+    return displayGrid.getRow(row).toVector();
 }
 
 std::vector<Plant*> SalesFloor::getPlantsInColumn(int col)const{
-    std::vector<Plant*> colPlants;
-    
-    if(col < 0 || col >= cols){
-        return colPlants;
-    }
-    
-    for(int i = 0; i < rows; i++){
-
-        if(displayGrid[i][col] != nullptr){
-            colPlants.push_back(displayGrid[i][col]);
-        }
-    }
-    
-    return colPlants;
+    return displayGrid.getColumn(col).toVector();
 }
 
 int SalesFloor::getNumberOfPlants()const{
@@ -219,11 +164,23 @@ int SalesFloor::getColumns()const{
 }
 
 bool SalesFloor::isPositionEmpty(int row, int col)const{
-    if(row < 0 || row >= rows || col < 0 || col >= cols){
+    if(!displayGrid.isInBounds(row, col)){
         return false;
     }
     
-    return displayGrid[row][col] == nullptr;
+    return displayGrid.getPlantAt(row, col) == nullptr;
+}
+
+const PlantGrid& SalesFloor::getGrid()const{
+    return displayGrid;
+}
+
+void SalesFloor::markChanged(){
+    changeCount++;
+}
+
+uint64_t SalesFloor::getChangeCount()const{
+    return changeCount;
 }
 
 std::string SalesFloor::toString() const {
@@ -237,16 +194,11 @@ std::string SalesFloor::toString() const {
         output << "No plants on display.\n";
     } else {
         output << "Plants for Sale:\n";
-        for (int i = 0; i < rows; i++) {
-            for (int j = 0; j < cols; j++) {
-                Plant* plant = displayGrid[i][j];
-                if (plant != nullptr) {
-                    output << "  Position (" << i << "," << j << "): "
-                           << plant->getName() << " (ID: " << plant->getID() 
-                           << ") - R" << plant->getPrice() << "\n";
-                }
-            }
-        }
+        displayGrid.forEachPlant([&output](Plant* plant, int i, int j) {
+            output << "  Position (" << i << "," << j << "): "
+                   << plant->getName() << " (ID: " << plant->getID() 
+                   << ") - R" << plant->getPrice() << "\n";
+        });
     }
     
     if (!currentCustomers.empty()) {
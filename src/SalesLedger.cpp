@@ -0,0 +1,423 @@
+#include "include/SalesLedger.h"
+#include "include/ConcreteOrder.h"
+#include "include/Customer.h"
+#include "include/Decorator.h"
+#include "include/DecorativePotDecorator.h"
+#include "include/DerivedCustomers.h"
+#include "include/FinalOrder.h"
+#include "include/GiftWrapDecorator.h"
+#include "include/Leaf.h"
+#include "include/MappedFile.h"
+#include "include/Plant.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+static_assert(sizeof(LedgerChunkHeader) == 32, "LedgerChunkHeader is written as-is and must keep its size");
+
+namespace {
+
+const char LEDGER_MAGIC[8] = {'N', 'U', 'R', 'L', 'D', 'G', 'R', '\0'};
+
+/// Bytes of one line item across all columns
+const size_t ROW_BYTES = sizeof(double) + sizeof(int32_t) + sizeof(uint16_t) + 3 * sizeof(uint8_t);
+
+size_t alignTo8(size_t bytes) {
+    return (bytes + 7) & ~static_cast<size_t>(7);
+}
+
+/**
+ * @brief Bytes of the columns of a chunk with the given number of rows, padding included.
+ */
+size_t columnBytes(size_t rows) {
+    return alignTo8(rows * ROW_BYTES);
+}
+
+/**
+ * @brief Sums a column with independent partial sums, so the adds can overlap.
+ */
+double sumColumn(const double* values, size_t count) {
+    double partial[4] = {0.0, 0.0, 0.0, 0.0};
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        partial[0] += values[i];
+        partial[1] += values[i + 1];
+        partial[2] += values[i + 2];
+        partial[3] += values[i + 3];
+    }
+    for (; i < count; i++) {
+        partial[0] += values[i];
+    }
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);
+}
+
+int weekOf(int day) {
+    // Floor division, so day -1 falls in week -1
+    return day >= 0 ? day / 7 : -((-day + 6) / 7);
+}
+
+} // namespace
+
+double RevenueTable::get(int week, const std::string& speciesName) const {
+    int row = week - firstWeek;
+    if (row < 0 || row >= weekCount) {
+        return 0.0;
+    }
+    for (size_t s = 0; s < species.size(); s++) {
+        if (species[s] == speciesName) {
+            return revenue[static_cast<size_t>(row) * species.size() + s];
+        }
+    }
+    return 0.0;
+}
+
+SalesLedger* SalesLedger::getInstance() {
+    static SalesLedger instance;
+    return &instance;
+}
+
+SalesLedger::SalesLedger() : day_(0), lineItems_(0), residentChunks_(0), spilledLineItems_(0) {
+}
+
+void SalesLedger::setDay(int day) {
+    day_ = day;
+}
+
+int SalesLedger::getDay() const {
+    return day_;
+}
+
+size_t SalesLedger::recordOrder(const FinalOrder* order, const Customer* customer, const PaymentProcessor* processor) {
+    if (order == nullptr) {
+        return 0;
+    }
+
+    CustomerType customerType = OtherCustomer;
+    if (dynamic_cast<const RegularCustomer*>(customer) != nullptr) {
+        customerType = Regular;
+    } else if (dynamic_cast<const CorporateCustomer*>(customer) != nullptr) {
+        customerType = Corporate;
+    } else if (dynamic_cast<const WalkInCustomer*>(customer) != nullptr) {
+        customerType = WalkIn;
+    }
+    PaymentMethod method = (processor != nullptr) ? processor->getPaymentMethod() : PaymentMethod::Cash;
+
+    size_t added = 0;
+    for (const Order* item : order->getOrders()) {
+        added += recordNode(item, customerType, method);
+    }
+    return added;
+}
+
+size_t SalesLedger::recordNode(const Order* node, CustomerType customerType, PaymentMethod method) {
+    if (const Leaf* leaf = dynamic_cast<const Leaf*>(node)) {
+        Plant* plant = leaf->getPlant();
+        if (plant == nullptr) {
+            return 0;
+        }
+        double price = plant->getPrice();
+
+        uint8_t decorations = 0;
+        while (Decorator* decorator = dynamic_cast<Decorator*>(plant)) {
+            if (dynamic_cast<DecorativePotDecorator*>(decorator) != nullptr) {
+                decorations |= DecorativePot;
+            } else if (dynamic_cast<GiftWrapDecorator*>(decorator) != nullptr) {
+                decorations |= GiftWrap;
+            } else {
+                decorations |= Ribbon;
+            }
+            plant = decorator->getWrappedPlant();
+        }
+        if (plant == nullptr) {
+            return 0;
+        }
+        addLineItem(day_, customerType, speciesCode(plant->getName()), decorations, price, method);
+        return 1;
+    }
+
+    size_t added = 0;
+    if (const ConcreteOrder* group = dynamic_cast<const ConcreteOrder*>(node)) {
+        for (const Order* child : group->getChildren()) {
+            added += recordNode(child, customerType, method);
+        }
+    }
+    return added;
+}
+
+uint16_t SalesLedger::speciesCode(const std::string& speciesName) {
+    auto it = speciesCodes_.find(speciesName);
+    if (it != speciesCodes_.end()) {
+        return it->second;
+    }
+    // Names past the last code share it rather than wrap around
+    uint16_t code = static_cast<uint16_t>(std::min<size_t>(speciesNames_.size(), UINT16_MAX));
+    if (code == speciesNames_.size()) {
+        speciesNames_.push_back(speciesName);
+    }
+    speciesCodes_.emplace(speciesName, code);
+    return code;
+}
+
+void SalesLedger::addLineItem(int day, CustomerType customerType, uint16_t speciesCode, uint8_t decorations,
+                              double price, PaymentMethod method) {
+    if (chunks_.empty() || chunks_.back().price.size() == CHUNK_ROWS) {
+        startChunk();
+    }
+    Chunk& chunk = chunks_.back();
+    if (chunk.price.empty()) {
+        chunk.firstDay = day;
+        chunk.lastDay = day;
+    } else {
+        chunk.firstDay = std::min(chunk.firstDay, day);
+        chunk.lastDay = std::max(chunk.lastDay, day);
+    }
+    chunk.price.push_back(price);
+    chunk.day.push_back(day);
+    chunk.species.push_back(speciesCode);
+    chunk.customerType.push_back(customerType);
+    chunk.decorations.push_back(decorations);
+    chunk.paymentMethod.push_back(static_cast<uint8_t>(method));
+    lineItems_++;
+}
+
+void SalesLedger::startChunk() {
+    // Only full chunks are spilled; the newest one is still being filled
+    while (spill_.is_open() && chunks_.size() > residentChunks_ && spillOldest()) {
+    }
+
+    chunks_.emplace_back();
+    Chunk& chunk = chunks_.back();
+    chunk.price.reserve(CHUNK_ROWS);
+    chunk.day.reserve(CHUNK_ROWS);
+    chunk.species.reserve(CHUNK_ROWS);
+    chunk.customerType.reserve(CHUNK_ROWS);
+    chunk.decorations.reserve(CHUNK_ROWS);
+    chunk.paymentMethod.reserve(CHUNK_ROWS);
+    chunk.firstDay = 0;
+    chunk.lastDay = 0;
+}
+
+bool SalesLedger::spillOldest() {
+    const Chunk& chunk = chunks_.front();
+    size_t rows = chunk.price.size();
+
+    LedgerChunkHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, LEDGER_MAGIC, sizeof(header.magic));
+    header.rowCount = static_cast<uint32_t>(rows);
+    header.firstDay = chunk.firstDay;
+    header.lastDay = chunk.lastDay;
+    header.chunkBytes = sizeof(header) + columnBytes(rows);
+
+    spill_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    spill_.write(reinterpret_cast<const char*>(chunk.price.data()), rows * sizeof(double));
+    spill_.write(reinterpret_cast<const char*>(chunk.day.data()), rows * sizeof(int32_t));
+    spill_.write(reinterpret_cast<const char*>(chunk.species.data()), rows * sizeof(uint16_t));
+    spill_.write(reinterpret_cast<const char*>(chunk.customerType.data()), rows);
+    spill_.write(reinterpret_cast<const char*>(chunk.decorations.data()), rows);
+    spill_.write(reinterpret_cast<const char*>(chunk.paymentMethod.data()), rows);
+    const char padding[8] = {0};
+    spill_.write(padding, static_cast<std::streamsize>(header.chunkBytes - sizeof(header) - rows * ROW_BYTES));
+    spill_.flush();
+    if (!spill_) {
+        std::cout << "[SalesLedger] Could not write to " << spillPath_ << "; keeping sales in memory\n";
+        spill_.close();
+        return false;
+    }
+
+    spilledLineItems_ += rows;
+    chunks_.erase(chunks_.begin());
+    return true;
+}
+
+bool SalesLedger::setSpillFile(const std::string& path, size_t residentChunks) {
+    spill_.close();
+    spill_.clear();
+    spilledLineItems_ = 0;
+    spillPath_ = path;
+    residentChunks_ = residentChunks;
+    spill_.open(path.c_str(), std::ios::binary | std::ios::trunc);
+    if (!spill_) {
+        std::cout << "[SalesLedger] Could not create " << path << "\n";
+        spillPath_.clear();
+        return false;
+    }
+    return true;
+}
+
+void SalesLedger::clear() {
+    chunks_.clear();
+    speciesNames_.clear();
+    speciesCodes_.clear();
+    lineItems_ = 0;
+    spilledLineItems_ = 0;
+    if (spill_.is_open()) {
+        spill_.close();
+    }
+    if (!spillPath_.empty()) {
+        std::remove(spillPath_.c_str());
+        spillPath_.clear();
+    }
+}
+
+size_t SalesLedger::getLineItemCount() const {
+    return lineItems_;
+}
+
+size_t SalesLedger::getSpilledLineItemCount() const {
+    return spilledLineItems_;
+}
+
+template <typename Visitor>
+void SalesLedger::forEachChunk(Visitor visit) const {
+    if (spilledLineItems_ > 0) {
+        MappedFile file;
+        if (file.open(spillPath_)) {
+            size_t offset = 0;
+            while (offset + sizeof(LedgerChunkHeader) <= file.size()) {
+                LedgerChunkHeader header;
+                std::memcpy(&header, file.data() + offset, sizeof(header));
+                size_t rows = header.rowCount;
+                if (std::memcmp(header.magic, LEDGER_MAGIC, sizeof(LEDGER_MAGIC)) != 0 ||
+                    header.chunkBytes != sizeof(header) + columnBytes(rows) ||
+                    offset + header.chunkBytes > file.size()) {
+                    std::cout << "[SalesLedger] Spill file " << spillPath_ << " is damaged\n";
+                    break;
+                }
+                const char* columns = file.data() + offset + sizeof(header);
+                ChunkView view;
+                view.rowCount = rows;
+                view.firstDay = header.firstDay;
+                view.lastDay = header.lastDay;
+                view.price = reinterpret_cast<const double*>(columns);
+                view.day = reinterpret_cast<const int32_t*>(columns + rows * sizeof(double));
+                view.species = reinterpret_cast<const uint16_t*>(columns + rows * (sizeof(double) + sizeof(int32_t)));
+                view.customerType = reinterpret_cast<const uint8_t*>(columns + rows * 14);
+                view.decorations = view.customerType + rows;
+                view.paymentMethod = view.decorations + rows;
+                visit(view);
+                offset += header.chunkBytes;
+            }
+        }
+    }
+
+    for (const Chunk& chunk : chunks_) {
+        if (chunk.price.empty()) {
+            continue;
+        }
+        ChunkView view;
+        view.rowCount = chunk.price.size();
+        view.firstDay = chunk.firstDay;
+        view.lastDay = chunk.lastDay;
+        view.price = chunk.price.data();
+        view.day = chunk.day.data();
+        view.species = chunk.species.data();
+        view.customerType = chunk.customerType.data();
+        view.decorations = chunk.decorations.data();
+        view.paymentMethod = chunk.paymentMethod.data();
+        visit(view);
+    }
+}
+
+double SalesLedger::revenue(int firstDay, int lastDay) const {
+    double total = 0.0;
+    forEachChunk([&](const ChunkView& chunk) {
+        if (chunk.lastDay < firstDay || chunk.firstDay > lastDay) {
+            return;
+        }
+        if (chunk.firstDay >= firstDay && chunk.lastDay <= lastDay) {
+            total += sumColumn(chunk.price, chunk.rowCount);
+            return;
+        }
+        for (size_t i = 0; i < chunk.rowCount; i++) {
+            bool inRange = chunk.day[i] >= firstDay && chunk.day[i] <= lastDay;
+            total += inRange ? chunk.price[i] : 0.0;
+        }
+    });
+    return total;
+}
+
+std::vector<double> SalesLedger::revenueByCustomerType() const {
+    std::vector<double> totals(CUSTOMER_TYPE_COUNT, 0.0);
+    forEachChunk([&](const ChunkView& chunk) {
+        double partial[CUSTOMER_TYPE_COUNT] = {0.0, 0.0, 0.0, 0.0};
+        for (size_t i = 0; i < chunk.rowCount; i++) {
+            partial[chunk.customerType[i] & 3] += chunk.price[i];
+        }
+        for (int t = 0; t < CUSTOMER_TYPE_COUNT; t++) {
+            totals[t] += partial[t];
+        }
+    });
+    return totals;
+}
+
+RevenueTable SalesLedger::revenueBySpeciesPerWeek(int firstDay, int lastDay) const {
+    RevenueTable table;
+
+    // First pass over the chunk summaries only, to size the table
+    int firstWeek = 0;
+    int lastWeek = -1;
+    forEachChunk([&](const ChunkView& chunk) {
+        if (chunk.lastDay < firstDay || chunk.firstDay > lastDay) {
+            return;
+        }
+        int from = weekOf(std::max(chunk.firstDay, firstDay));
+        int to = weekOf(std::min(chunk.lastDay, lastDay));
+        if (lastWeek < firstWeek) {
+            firstWeek = from;
+            lastWeek = to;
+        } else {
+            firstWeek = std::min(firstWeek, from);
+            lastWeek = std::max(lastWeek, to);
+        }
+    });
+    if (lastWeek < firstWeek) {
+        return table;
+    }
+
+    size_t speciesCount = speciesNames_.size();
+    table.firstWeek = firstWeek;
+    table.weekCount = lastWeek - firstWeek + 1;
+    table.species = speciesNames_;
+    table.revenue.assign(static_cast<size_t>(table.weekCount) * speciesCount, 0.0);
+
+    forEachChunk([&](const ChunkView& chunk) {
+        if (chunk.lastDay < firstDay || chunk.firstDay > lastDay) {
+            return;
+        }
+        bool whole = chunk.firstDay >= firstDay && chunk.lastDay <= lastDay;
+        int week = weekOf(chunk.firstDay);
+        if (whole && week == weekOf(chunk.lastDay)) {
+            // The whole chunk is one week: a plain histogram over the species column
+            double* row = table.revenue.data() + static_cast<size_t>(week - firstWeek) * speciesCount;
+            for (size_t i = 0; i < chunk.rowCount; i++) {
+                row[chunk.species[i]] += chunk.price[i];
+            }
+            return;
+        }
+        for (size_t i = 0; i < chunk.rowCount; i++) {
+            int day = chunk.day[i];
+            if (day < firstDay || day > lastDay) {
+                continue;
+            }
+            size_t cell = static_cast<size_t>(weekOf(day) - firstWeek) * speciesCount + chunk.species[i];
+            table.revenue[cell] += chunk.price[i];
+        }
+    });
+    return table;
+}
+
+double SalesLedger::decorationAttachRate(uint8_t decorations) const {
+    size_t matched = 0;
+    size_t total = 0;
+    forEachChunk([&](const ChunkView& chunk) {
+        size_t count = 0;
+        for (size_t i = 0; i < chunk.rowCount; i++) {
+            count += (chunk.decorations[i] & decorations) != 0;
+        }
+        matched += count;
+        total += chunk.rowCount;
+    });
+    return total == 0 ? 0.0 : static_cast<double>(matched) / static_cast<double>(total);
+}
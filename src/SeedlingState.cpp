@@ -2,9 +2,10 @@
 #include "include/GrowingState.h"
 #include "include/DeadState.h"
 #include "include/Plant.h"
+#include "include/SpeciesTraits.h"
 #include <iostream>
 
-SeedlingState::SeedlingState() {
+SeedlingState::SeedlingState() : PlantState(LifecycleStage::Seedling) {
     std::cout << "Plant entered Seedling state." << std::endl;
 }
 
@@ -18,14 +19,14 @@ void SeedlingState::handleChange(Plant* plant) {
     int health = plant->getHealthLevel();
     
     // Check if plant has died due to poor health
-    if (health < 20) {
+    if (health < LifecycleTraits::YOUNG_DIES_BELOW) {
         std::cout << "Seedling " << plant->getID() << " has died due to poor health." << std::endl;
         plant->setState(new DeadState());
         return;
     }
     
     // Check if seedling is ready to transition to Growing state
-    if (age >= 7 && health >= 50) {
+    if (age >= LifecycleTraits::SEEDLING_GROWS_AT_AGE && health >= LifecycleTraits::GROWS_AT_HEALTH) {
         std::cout << "Seedling " << plant->getID() << " is growing... transitioning to Growing state." << std::endl;
         plant->setState(new GrowingState());
         return;
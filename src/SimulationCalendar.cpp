@@ -0,0 +1,147 @@
+#include "include/SimulationCalendar.h"
+#include "include/ThresholdMonitor.h"
+#include "include/Plant.h"
+#include <algorithm>
+
+SimulationCalendar::SimulationCalendar(ThresholdMonitor* monitor)
+    : monitor_(monitor), currentDay_(0), nextOrder_(0), nextTicket_(0), processedEvents_(0),
+      syncing_(false) {
+}
+
+SimulationCalendar::~SimulationCalendar() {
+    for (auto& item : entries_) {
+        item.first->calendar = nullptr;
+    }
+}
+
+void SimulationCalendar::addPlant(Plant* plant) {
+    if (plant == nullptr || plant->calendar != nullptr) {
+        return;
+    }
+    plant->calendar = this;
+    Entry& entry = entries_[plant];
+    entry.syncedDay = currentDay_;
+    entry.order = nextOrder_++;
+    entry.ticket = 0;
+    scheduleNext(plant, entry);
+}
+
+void SimulationCalendar::removePlant(Plant* plant) {
+    auto it = entries_.find(plant);
+    if (it == entries_.end()) {
+        return;
+    }
+    materialize(plant);
+    plant->calendar = nullptr;
+    // Its queued event goes stale and is skipped when popped
+    entries_.erase(it);
+}
+
+void SimulationCalendar::forget(Plant* plant) {
+    entries_.erase(plant);
+}
+
+int SimulationCalendar::advance(int days) {
+    if (days <= 0) {
+        return 0;
+    }
+
+    int targetDay = currentDay_ + days;
+    int scheduled = 0;
+    syncing_ = true;
+
+    while (!calendar_.empty() && calendar_.top().day <= targetDay) {
+        int day = calendar_.top().day;
+
+        // Collect every live event due on this day; the queue yields them in registration order
+        dueBatch_.clear();
+        while (!calendar_.empty() && calendar_.top().day == day) {
+            Event event = calendar_.top();
+            calendar_.pop();
+            auto it = entries_.find(event.plant);
+            if (it != entries_.end() && it->second.ticket == event.ticket) {
+                dueBatch_.push_back(event.plant);
+            }
+        }
+        if (dueBatch_.empty()) {
+            continue;
+        }
+
+        for (Plant* plant : dueBatch_) {
+            Entry& entry = entries_[plant];
+            plant->advanceDays(day - entry.syncedDay);
+            entry.syncedDay = day;
+        }
+
+        if (monitor_ != nullptr) {
+            scheduled += monitor_->scan(dueBatch_);
+        }
+
+        for (Plant* plant : dueBatch_) {
+            scheduleNext(plant, entries_[plant]);
+        }
+        processedEvents_ += static_cast<long long>(dueBatch_.size());
+    }
+
+    syncing_ = false;
+    currentDay_ = targetDay;
+    return scheduled;
+}
+
+void SimulationCalendar::materialize(Plant* plant) {
+    // Reads made while the calendar is advancing a plant see it as it is
+    if (syncing_) {
+        return;
+    }
+    auto it = entries_.find(plant);
+    if (it == entries_.end() || it->second.syncedDay == currentDay_) {
+        return;
+    }
+    syncing_ = true;
+    plant->advanceDays(currentDay_ - it->second.syncedDay);
+    syncing_ = false;
+    it->second.syncedDay = currentDay_;
+}
+
+void SimulationCalendar::materializeAll() {
+    syncing_ = true;
+    for (auto& item : entries_) {
+        item.first->advanceDays(currentDay_ - item.second.syncedDay);
+        item.second.syncedDay = currentDay_;
+    }
+    syncing_ = false;
+}
+
+void SimulationCalendar::reschedule(Plant* plant) {
+    auto it = entries_.find(plant);
+    if (it == entries_.end()) {
+        return;
+    }
+    materialize(plant);
+    scheduleNext(plant, it->second);
+}
+
+int SimulationCalendar::getCurrentDay() const {
+    return currentDay_;
+}
+
+int SimulationCalendar::getPlantCount() const {
+    return static_cast<int>(entries_.size());
+}
+
+long long SimulationCalendar::getProcessedEventCount() const {
+    return processedEvents_;
+}
+
+void SimulationCalendar::scheduleNext(Plant* plant, Entry& entry) {
+    int next = 1;
+    if (plant->getObserverCount() == 0) {
+        next = std::min(plant->daysUntilStateChange(LOOKAHEAD_DAYS), LOOKAHEAD_DAYS);
+        if (monitor_ != nullptr) {
+            next = std::min(next, monitor_->daysUntilZoneChange(plant, next));
+        }
+    }
+
+    entry.ticket = ++nextTicket_;
+    calendar_.push(Event{entry.syncedDay + next, entry.order, entry.ticket, plant});
+}
@@ -0,0 +1,35 @@
+#include "include/SpeciesKernel.h"
+
+void dailyUpdateBatch(Plant* const* plants, size_t count) {
+    size_t start = 0;
+    while (start < count) {
+        PlantSpecies species = plants[start]->getSpecies();
+        size_t end = start + 1;
+        while (end < count && plants[end]->getSpecies() == species) {
+            end++;
+        }
+
+        Plant* const* run = plants + start;
+        size_t runLength = end - start;
+        switch (species) {
+            case PlantSpecies::Flower:
+                SpeciesKernel<FlowerTraits>::dailyUpdate(run, runLength);
+                break;
+            case PlantSpecies::Succulent:
+                SpeciesKernel<SucculentTraits>::dailyUpdate(run, runLength);
+                break;
+            case PlantSpecies::Vegetable:
+                SpeciesKernel<VegetableTraits>::dailyUpdate(run, runLength);
+                break;
+            case PlantSpecies::Other:
+                SpeciesKernel<OtherPlantTraits>::dailyUpdate(run, runLength);
+                break;
+            case PlantSpecies::Custom:
+                for (size_t i = 0; i < runLength; i++) {
+                    run[i]->dailyUpdate();
+                }
+                break;
+        }
+        start = end;
+    }
+}
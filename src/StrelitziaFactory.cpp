@@ -2,27 +2,19 @@
 #include "include/Strelitzia.h"
 #include "include/FlowerCareStrategy.h"
 #include "include/SeedlingState.h"
-#include "include/WaterObserver.h"
-#include "include/FertilizeObserver.h"
-#include "include/SunlightObserver.h"
 #include "include/CareScheduler.h"
 
 Plant* StrelitziaFactory::buildPlant(CareScheduler* scheduler) const {
     static int strelitziaCounter = 1;
     std::string plantId = "STRELITZIA_" + std::to_string(strelitziaCounter++);
-    CareStrategy* careStrategy = new FlowerCareStrategy();
+    CareStrategy* careStrategy = FlowerCareStrategy::getInstance();
     PlantState* initialState = new SeedlingState();
     
     Strelitzia* plant = new Strelitzia(plantId, careStrategy, initialState);
     
+    // Standard observers are shared per scheduler, so they cost the plant no allocations
     if (scheduler != nullptr) {
-        WaterObserver* waterObs = new WaterObserver(scheduler, plant);
-        FertilizeObserver* fertObs = new FertilizeObserver(scheduler, plant);
-        SunlightObserver* sunObs = new SunlightObserver(scheduler, plant);
-        
-        plant->addOwnedObserver(waterObs);
-        plant->addOwnedObserver(fertObs);
-        plant->addOwnedObserver(sunObs);
+        scheduler->attachStandardObservers(plant);
     }
     
     return plant;
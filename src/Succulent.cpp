@@ -3,27 +3,21 @@
 Succulent::Succulent(const std::string& name, const std::string& id,
                      CareStrategy* careStrategy, PlantState* initialState)
     : Plant(name, id, careStrategy, initialState) {
-    setPrice(15.0);
+    setSpecies(SucculentTraits::SPECIES);
+    setPrice(SucculentTraits::BASE_PRICE);
 }
 
 Succulent::~Succulent() {
 }
 
-void Succulent::dailyUpdate() {
-    incrementAge();
-    
+int Succulent::getDailyWaterLoss() const {
     // Succulents lose water SLOWER than other plants
-    setWaterLevel(getWaterLevel() - 5);
-    
+    return SucculentTraits::DAILY_WATER_LOSS;
+}
+
+int Succulent::getDailyNutrientLoss() const {
     // Nutrients decay normally
-    setNutrientLevel(getNutrientLevel() - 5);
-    
-    updateHealth();
-    notify();
-    
-    if (getState() != nullptr) {
-        getState()->handleChange(this);
-    }
+    return SucculentTraits::DAILY_NUTRIENT_LOSS;
 }
 
 std::string Succulent::toString() const {
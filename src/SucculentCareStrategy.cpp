@@ -1,12 +1,16 @@
 #include "include/SucculentCareStrategy.h"
 #include "include/Plant.h"
+#include "include/SpeciesKernel.h"
 #include <iostream>
 
-
+SucculentCareStrategy* SucculentCareStrategy::getInstance() {
+    static SucculentCareStrategy instance;
+    return &instance;
+}
 
 void SucculentCareStrategy::water(Plant* plant) {
     // Succulents need minimal watering
-    plant->setWaterLevel(plant->getWaterLevel() + 15.0);
+    plant->setWaterLevel(plant->getWaterLevel() + SucculentTraits::WATER_GAIN);
     std::cout << "Watering succulent - requires minimal water" << std::endl;
     (void)plant;
 }
@@ -14,18 +18,23 @@ void SucculentCareStrategy::water(Plant* plant) {
 
 void SucculentCareStrategy::fertilize(Plant* plant) {
     // Succulents need minimal fertilizer
-   plant->setNutrientLevel(plant->getNutrientLevel() + 10);
+   plant->setNutrientLevel(plant->getNutrientLevel() + SucculentTraits::NUTRIENT_GAIN);
     std::cout << "Fertilizing succulent - light feeding" << std::endl;
 }
 
 
 void SucculentCareStrategy::adjustSunlight(Plant* plant) {
     // Succulents love lots of sunlight
-    plant->setSunlightExposure(85.0);
+    plant->setSunlightExposure(SucculentTraits::SUNLIGHT_TARGET);
     std::cout << "Adjusting succulent sunlight - high exposure preferred" << std::endl;
 }
 
 void SucculentCareStrategy::prune(Plant* plant) {
     std::cout << "Pruning succulent - removing dead leaves" << std::endl;
     (void)plant;
-}
\ No newline at end of file
+}
+
+void SucculentCareStrategy::careForBatch(CareAction action, Plant* const* plants, size_t count) {
+    SpeciesKernel<SucculentTraits>::care(action, plants, count);
+    std::cout << "Caring for " << count << " succulents in one batch" << std::endl;
+}
@@ -17,8 +17,16 @@ SunlightObserver::~SunlightObserver() {
 }
 
 void SunlightObserver::update(Plant* plant) {
-    if (plant->getSunlightExposure() < 40) {
+    if (plant->getSunlightExposure() < PlantTraits::LOW_SUNLIGHT) {
         Command* cmd = new AdjustSunlightCommand(plant);
         scheduler_->addTask(cmd);
     }
 }
+
+void SunlightObserver::updateBatch(Plant* const* plants, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (plants[i]->getSunlightExposure() < PlantTraits::LOW_SUNLIGHT) {
+            scheduler_->addTask(new AdjustSunlightCommand(plants[i]));
+        }
+    }
+}
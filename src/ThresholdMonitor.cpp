@@ -0,0 +1,214 @@
+#include "include/ThresholdMonitor.h"
+#include "include/Plant.h"
+#include "include/CareScheduler.h"
+#include "include/PlantGrid.h"
+#include <algorithm>
+#include <climits>
+#include <iostream>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/**
+ * @brief ORs a rule's bit into the zone mask of every plant whose value is in the zone.
+ *
+ * The comparator is normalised to a strict compare so the SSE2 path needs
+ * only _mm_cmplt_epi32 / _mm_cmpgt_epi32. The scalar tail (and the whole
+ * loop on targets without SSE2) is branch-free.
+ */
+void markZone(const int* values, size_t count, ThresholdComparator comparator,
+              int level, int bit, int* zone) {
+    bool below = (comparator == ThresholdComparator::Below ||
+                  comparator == ThresholdComparator::AtOrBelow);
+    int bound = level;
+    if (comparator == ThresholdComparator::AtOrBelow) {
+        bound = (level == INT_MAX) ? INT_MAX : level + 1;
+    } else if (comparator == ThresholdComparator::AtOrAbove) {
+        bound = (level == INT_MIN) ? INT_MIN : level - 1;
+    }
+    bool everything = (comparator == ThresholdComparator::AtOrBelow && level == INT_MAX) ||
+                      (comparator == ThresholdComparator::AtOrAbove && level == INT_MIN);
+
+    size_t i = 0;
+    if (everything) {
+        for (; i < count; i++) {
+            zone[i] |= bit;
+        }
+        return;
+    }
+
+#if defined(__SSE2__)
+    const __m128i boundVec = _mm_set1_epi32(bound);
+    const __m128i bitVec = _mm_set1_epi32(bit);
+    for (; i + 4 <= count; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        __m128i hit = below ? _mm_cmplt_epi32(v, boundVec) : _mm_cmpgt_epi32(v, boundVec);
+        __m128i z = _mm_loadu_si128(reinterpret_cast<const __m128i*>(zone + i));
+        z = _mm_or_si128(z, _mm_and_si128(hit, bitVec));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(zone + i), z);
+    }
+#endif
+
+    for (; i < count; i++) {
+        int hit = below ? (values[i] < bound) : (values[i] > bound);
+        zone[i] |= -hit & bit;
+    }
+}
+
+/**
+ * @brief Scalar check of a single value against a rule.
+ */
+bool inZone(const ThresholdRule& rule, int value) {
+    switch (rule.comparator) {
+        case ThresholdComparator::Below:
+            return value < rule.level;
+        case ThresholdComparator::AtOrBelow:
+            return value <= rule.level;
+        case ThresholdComparator::Above:
+            return value > rule.level;
+        case ThresholdComparator::AtOrAbove:
+            return value >= rule.level;
+    }
+    return false;
+}
+
+/**
+ * @brief Projects a vital some days ahead under daily decay.
+ */
+int projectVital(const Plant* plant, PlantVital vital, int days) {
+    switch (vital) {
+        case PlantVital::Water:
+            return plant->getWaterLevelAfter(days);
+        case PlantVital::Nutrients:
+            return plant->getNutrientLevelAfter(days);
+        case PlantVital::Sunlight:
+            return plant->getSunlightExposure();
+        case PlantVital::Health:
+            return plant->getHealthLevelAfter(days);
+    }
+    return 0;
+}
+
+} // namespace
+
+ThresholdMonitor::ThresholdMonitor(CareScheduler* scheduler)
+    : scheduler_(scheduler) {
+}
+
+int ThresholdMonitor::addThreshold(PlantVital vital, ThresholdComparator comparator,
+                                   int level, CareAction action) {
+    if (static_cast<int>(rules_.size()) >= MAX_RULES) {
+        std::cout << "[ThresholdMonitor] Cannot add more than " << MAX_RULES << " thresholds" << std::endl;
+        return -1;
+    }
+    rules_.push_back(ThresholdRule{vital, comparator, level, action});
+    return static_cast<int>(rules_.size()) - 1;
+}
+
+void ThresholdMonitor::addStandardThresholds() {
+    addThreshold(PlantVital::Water, ThresholdComparator::Below, PlantTraits::LOW_WATER, CareAction::Water);
+    addThreshold(PlantVital::Nutrients, ThresholdComparator::Below, PlantTraits::LOW_NUTRIENTS, CareAction::Fertilize);
+    addThreshold(PlantVital::Sunlight, ThresholdComparator::Below, PlantTraits::LOW_SUNLIGHT, CareAction::AdjustSunlight);
+}
+
+const std::vector<ThresholdRule>& ThresholdMonitor::getRules() const {
+    return rules_;
+}
+
+int ThresholdMonitor::scan(const std::vector<Plant*>& plants) {
+    batch_.clear();
+    for (Plant* plant : plants) {
+        if (plant != nullptr) {
+            batch_.push_back(plant);
+        }
+    }
+    return scanBatch();
+}
+
+int ThresholdMonitor::scan(const PlantGridView& plants) {
+    batch_.clear();
+    for (Plant* plant : plants) {
+        batch_.push_back(plant);
+    }
+    return scanBatch();
+}
+
+int ThresholdMonitor::scanBatch() {
+    size_t count = batch_.size();
+    if (count == 0 || rules_.empty()) {
+        return 0;
+    }
+
+    // Gather vitals into contiguous arrays, one per PlantVital
+    for (std::vector<int>& column : vitals_) {
+        column.resize(count);
+    }
+    zoneMasks_.assign(count, 0);
+    previousMasks_.resize(count);
+
+    for (size_t i = 0; i < count; i++) {
+        Plant* plant = batch_[i];
+        vitals_[static_cast<int>(PlantVital::Water)][i] = plant->getWaterLevel();
+        vitals_[static_cast<int>(PlantVital::Nutrients)][i] = plant->getNutrientLevel();
+        vitals_[static_cast<int>(PlantVital::Sunlight)][i] = plant->getSunlightExposure();
+        vitals_[static_cast<int>(PlantVital::Health)][i] = plant->getHealthLevel();
+        previousMasks_[i] = plant->getThresholdMask();
+    }
+
+    for (size_t r = 0; r < rules_.size(); r++) {
+        const ThresholdRule& rule = rules_[r];
+        markZone(vitals_[static_cast<int>(rule.vital)].data(), count,
+                 rule.comparator, rule.level, 1 << r, zoneMasks_.data());
+    }
+
+    // Only bits that were clear after the previous scan are edges
+    int fired = 0;
+    for (size_t i = 0; i < count; i++) {
+        int edges = zoneMasks_[i] & ~previousMasks_[i];
+        batch_[i]->setThresholdMask(static_cast<unsigned char>(zoneMasks_[i]));
+
+        if (edges == 0 || scheduler_ == nullptr) {
+            continue;
+        }
+        for (size_t r = 0; r < rules_.size(); r++) {
+            if (edges & (1 << r)) {
+                scheduler_->addTask(createCareCommand(rules_[r].action, batch_[i]));
+                fired++;
+            }
+        }
+    }
+
+    return fired;
+}
+
+int ThresholdMonitor::daysUntilZoneChange(const Plant* plant, int horizon) const {
+    int mask = plant->getThresholdMask();
+    int next = horizon + 1;
+
+    for (size_t r = 0; r < rules_.size(); r++) {
+        const ThresholdRule& rule = rules_[r];
+        bool inMask = (mask & (1 << r)) != 0;
+        bool tomorrow = inZone(rule, projectVital(plant, rule.vital, 1));
+        if (tomorrow != inMask) {
+            return 1;
+        }
+
+        // Zone membership is monotone in the day, so the first flip can be bisected
+        int lo = 2;
+        int hi = next;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (inZone(rule, projectVital(plant, rule.vital, mid)) != tomorrow) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        next = std::min(next, lo);
+    }
+
+    return next;
+}
@@ -0,0 +1,282 @@
+#include "include/TimingWheel.h"
+#include "include/Command.h"
+#include <algorithm>
+#include <limits>
+
+TimingWheel::TimingWheel()
+    : nodes_(SENTINELS), occupied_(LEVELS, 0), currentDay_(0), pendingCount_(0) {
+    for (int i = 0; i < SENTINELS; i++) {
+        nodes_[i] = Node{nullptr, 0, 0, 0, i, i, i, NodeState::Free};
+    }
+}
+
+TimingWheel::~TimingWheel() {
+    for (size_t i = SENTINELS; i < nodes_.size(); i++) {
+        if (nodes_[i].state != NodeState::Free) {
+            delete nodes_[i].command;
+        }
+    }
+}
+
+TimingWheel::TaskId TimingWheel::scheduleAt(Command* cmd, long long day) {
+    return schedule(cmd, day, 0);
+}
+
+TimingWheel::TaskId TimingWheel::scheduleEvery(Command* cmd, long long firstDay, int intervalDays) {
+    return schedule(cmd, firstDay, std::max(intervalDays, 1));
+}
+
+bool TimingWheel::cancel(TaskId id) {
+    int index = 0;
+    if (!lookUp(id, index)) {
+        return false;
+    }
+    Node& node = nodes_[index];
+    if (node.state == NodeState::Pending) {
+        unlink(index);
+        delete node.command;
+        releaseNode(index);
+        pendingCount_--;
+        return true;
+    }
+    if (node.state == NodeState::Running && node.interval > 0) {
+        // fire() deletes it once execute() returns
+        node.state = NodeState::Cancelled;
+        pendingCount_--;
+        return true;
+    }
+    return false;
+}
+
+bool TimingWheel::isScheduled(TaskId id) const {
+    int index = 0;
+    if (!lookUp(id, index)) {
+        return false;
+    }
+    const Node& node = nodes_[index];
+    return node.state == NodeState::Pending ||
+           (node.state == NodeState::Running && node.interval > 0);
+}
+
+int TimingWheel::tick() {
+    currentDay_++;
+    if (pendingCount_ == 0) {
+        return 0;
+    }
+    if ((currentDay_ & (SLOTS - 1)) == 0) {
+        cascade(currentDay_);
+    }
+    return fire();
+}
+
+int TimingWheel::advance(long long days) {
+    if (days <= 0) {
+        return 0;
+    }
+    long long targetDay = currentDay_ + days;
+    int executed = 0;
+    while (currentDay_ < targetDay) {
+        long long next = nextBusyDay();
+        if (next > targetDay) {
+            currentDay_ = targetDay;
+            break;
+        }
+        currentDay_ = next - 1;
+        executed += tick();
+    }
+    return executed;
+}
+
+long long TimingWheel::getCurrentDay() const {
+    return currentDay_;
+}
+
+int TimingWheel::getPendingCount() const {
+    return pendingCount_;
+}
+
+TimingWheel::TaskId TimingWheel::schedule(Command* cmd, long long day, int interval) {
+    if (cmd == nullptr) {
+        return 0;
+    }
+    int index = allocateNode();
+    Node& node = nodes_[index];
+    node.command = cmd;
+    node.dueDay = std::max(day, currentDay_ + 1);
+    node.interval = interval;
+    node.state = NodeState::Pending;
+    file(index);
+    pendingCount_++;
+    return makeId(index);
+}
+
+int TimingWheel::allocateNode() {
+    if (!freeNodes_.empty()) {
+        int index = freeNodes_.back();
+        freeNodes_.pop_back();
+        return index;
+    }
+    nodes_.push_back(Node{nullptr, 0, 0, 1, -1, -1, -1, NodeState::Free});
+    return static_cast<int>(nodes_.size()) - 1;
+}
+
+void TimingWheel::releaseNode(int index) {
+    Node& node = nodes_[index];
+    node.command = nullptr;
+    node.state = NodeState::Free;
+    node.generation++;
+    if (node.generation == 0) {
+        node.generation = 1;
+    }
+    freeNodes_.push_back(index);
+}
+
+void TimingWheel::file(int index) {
+    long long delta = nodes_[index].dueDay - currentDay_;
+    long long due = nodes_[index].dueDay;
+    for (int level = 0; level < LEVELS; level++) {
+        if (delta < (1LL << (SLOT_BITS * (level + 1)))) {
+            int slot = static_cast<int>((due >> (SLOT_BITS * level)) & (SLOTS - 1));
+            linkBack(level * SLOTS + slot, index);
+            return;
+        }
+    }
+    linkBack(OVERFLOW_LIST, index);
+}
+
+void TimingWheel::linkBack(int list, int index) {
+    Node& sentinel = nodes_[list];
+    Node& node = nodes_[index];
+    node.list = list;
+    node.prev = sentinel.prev;
+    node.next = list;
+    nodes_[sentinel.prev].next = index;
+    sentinel.prev = index;
+    if (list < OVERFLOW_LIST) {
+        occupied_[list / SLOTS] |= std::uint64_t(1) << (list % SLOTS);
+    }
+}
+
+void TimingWheel::unlink(int index) {
+    Node& node = nodes_[index];
+    nodes_[node.prev].next = node.next;
+    nodes_[node.next].prev = node.prev;
+    int list = node.list;
+    if (list < OVERFLOW_LIST && nodes_[list].next == list) {
+        occupied_[list / SLOTS] &= ~(std::uint64_t(1) << (list % SLOTS));
+    }
+    node.list = -1;
+    node.prev = -1;
+    node.next = -1;
+}
+
+void TimingWheel::moveAll(int fromList, int toList) {
+    Node& from = nodes_[fromList];
+    if (from.next == fromList) {
+        return;
+    }
+    // Splice the whole list; the moved nodes keep their old list index, which
+    // unlink() only uses to clear the old slot's bit once that slot is empty
+    Node& to = nodes_[toList];
+    nodes_[from.next].prev = to.prev;
+    nodes_[to.prev].next = from.next;
+    nodes_[from.prev].next = toList;
+    to.prev = from.prev;
+    from.next = fromList;
+    from.prev = fromList;
+    if (fromList < OVERFLOW_LIST) {
+        occupied_[fromList / SLOTS] &= ~(std::uint64_t(1) << (fromList % SLOTS));
+    }
+}
+
+void TimingWheel::cascade(long long day) {
+    // Each wheel above the first empties the slot for the block just entered,
+    // moving on to the next wheel only when this one has wrapped as well
+    for (int level = 1; level < LEVELS; level++) {
+        int slot = static_cast<int>((day >> (SLOT_BITS * level)) & (SLOTS - 1));
+        moveAll(level * SLOTS + slot, FIRING_LIST);
+        while (nodes_[FIRING_LIST].next != FIRING_LIST) {
+            int index = nodes_[FIRING_LIST].next;
+            unlink(index);
+            file(index);
+        }
+        if (slot != 0) {
+            return;
+        }
+    }
+
+    moveAll(OVERFLOW_LIST, FIRING_LIST);
+    while (nodes_[FIRING_LIST].next != FIRING_LIST) {
+        int index = nodes_[FIRING_LIST].next;
+        unlink(index);
+        file(index);
+    }
+}
+
+int TimingWheel::fire() {
+    moveAll(static_cast<int>(currentDay_ & (SLOTS - 1)), FIRING_LIST);
+
+    int executed = 0;
+    while (nodes_[FIRING_LIST].next != FIRING_LIST) {
+        int index = nodes_[FIRING_LIST].next;
+        unlink(index);
+        nodes_[index].state = NodeState::Running;
+        if (nodes_[index].interval == 0) {
+            pendingCount_--;
+        }
+
+        // execute() may schedule or cancel tasks, which can grow nodes_
+        Command* cmd = nodes_[index].command;
+        cmd->execute();
+        executed++;
+
+        Node& node = nodes_[index];
+        if (node.state == NodeState::Running && node.interval > 0) {
+            node.state = NodeState::Pending;
+            node.dueDay = currentDay_ + node.interval;
+            file(index);
+        } else {
+            delete node.command;
+            releaseNode(index);
+        }
+    }
+    return executed;
+}
+
+long long TimingWheel::nextBusyDay() const {
+    if (pendingCount_ == 0) {
+        return std::numeric_limits<long long>::max();
+    }
+
+    // Tasks further out sit in the upper wheels and must be cascaded at the next block boundary
+    long long next = (currentDay_ | (SLOTS - 1)) + 1;
+    bool upperBusy = (nodes_[OVERFLOW_LIST].next != OVERFLOW_LIST);
+    for (int level = 1; level < LEVELS; level++) {
+        upperBusy = upperBusy || occupied_[level] != 0;
+    }
+    if (!upperBusy) {
+        next = std::numeric_limits<long long>::max();
+    }
+
+    std::uint64_t firstWheel = occupied_[0];
+    for (long long day = currentDay_ + 1; firstWheel != 0 && day < currentDay_ + 1 + SLOTS; day++) {
+        if (firstWheel & (std::uint64_t(1) << (day & (SLOTS - 1)))) {
+            return std::min(next, day);
+        }
+    }
+    return next;
+}
+
+bool TimingWheel::lookUp(TaskId id, int& index) const {
+    std::uint64_t slot = id & 0xffffffffu;
+    if (slot < SENTINELS || slot >= nodes_.size()) {
+        return false;
+    }
+    index = static_cast<int>(slot);
+    return nodes_[index].state != NodeState::Free &&
+           nodes_[index].generation == static_cast<std::uint32_t>(id >> 32);
+}
+
+TimingWheel::TaskId TimingWheel::makeId(int index) const {
+    return (static_cast<TaskId>(nodes_[index].generation) << 32) | static_cast<TaskId>(index);
+}
@@ -0,0 +1,326 @@
+#include "include/TransactionJournal.h"
+#include "include/Plant.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(JournalRecord) == 96, "JournalRecord is written as-is and must keep its size");
+
+namespace {
+
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+#if defined(_WIN32)
+        int written = _write(fd, data, static_cast<unsigned>(size));
+#else
+        ssize_t written = ::write(fd, data, size);
+#endif
+        if (written <= 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool syncFile(int fd) {
+#if defined(_WIN32)
+    return _commit(fd) == 0;
+#elif defined(__APPLE__)
+    return fsync(fd) == 0;
+#else
+    return fdatasync(fd) == 0;
+#endif
+}
+
+void copyText(char* field, const std::string& text) {
+    size_t length = std::min(text.size(), JournalRecord::TEXT_SIZE - 1);
+    std::memcpy(field, text.data(), length);
+    field[length] = '\0';
+}
+
+} // namespace
+
+TransactionJournal* TransactionJournal::getInstance() {
+    static TransactionJournal instance;
+    return &instance;
+}
+
+TransactionJournal::TransactionJournal()
+    : open_(false), fd_(-1), groupSize_(DEFAULT_GROUP_SIZE), flushing_(false),
+      nextSequence_(0), durableSequence_(0), appended_(0), syncs_(0) {
+}
+
+TransactionJournal::~TransactionJournal() {
+    close();
+}
+
+bool TransactionJournal::open(const std::string& path, size_t groupSize) {
+    close();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+#if defined(_WIN32)
+    int fd = _open(path.c_str(), _O_WRONLY | _O_CREAT | _O_APPEND | _O_BINARY, _S_IREAD | _S_IWRITE);
+#else
+    int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+#endif
+    if (fd < 0) {
+        error_ = "cannot open " + path;
+        std::cout << "[Journal] " << error_ << "\n";
+        return false;
+    }
+
+    // Records are numbered by position, so the next one follows the last whole record
+#if defined(_WIN32)
+    long long size = _lseeki64(fd, 0, SEEK_END);
+    bool trimmed = size >= 0 && _chsize_s(fd, size - size % sizeof(JournalRecord)) == 0;
+#else
+    struct stat info;
+    long long size = (fstat(fd, &info) == 0) ? static_cast<long long>(info.st_size) : -1;
+    bool trimmed = size >= 0 && ftruncate(fd, size - size % sizeof(JournalRecord)) == 0;
+#endif
+    if (!trimmed) {
+#if defined(_WIN32)
+        _close(fd);
+#else
+        ::close(fd);
+#endif
+        error_ = "cannot prepare " + path;
+        std::cout << "[Journal] " << error_ << "\n";
+        return false;
+    }
+
+    fd_ = fd;
+    groupSize_ = (groupSize == 0) ? 1 : groupSize;
+    pending_.clear();
+    pending_.reserve(std::min(groupSize_, DEFAULT_GROUP_SIZE));
+    nextSequence_ = static_cast<uint64_t>(size) / sizeof(JournalRecord);
+    durableSequence_ = nextSequence_;
+    appended_ = 0;
+    syncs_ = 0;
+    error_.clear();
+    open_.store(true, std::memory_order_release);
+    return true;
+}
+
+void TransactionJournal::close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (flushing_) {
+        flushed_.wait(lock);
+    }
+    if (fd_ < 0) {
+        return;
+    }
+    if (!pending_.empty()) {
+        flushGroup(lock);
+    }
+    closeFile();
+}
+
+void TransactionJournal::closeFile() {
+    open_.store(false, std::memory_order_release);
+    if (fd_ >= 0) {
+#if defined(_WIN32)
+        _close(fd_);
+#else
+        ::close(fd_);
+#endif
+    }
+    fd_ = -1;
+    pending_.clear();
+}
+
+bool TransactionJournal::isOpen() const {
+    return open_.load(std::memory_order_acquire);
+}
+
+bool TransactionJournal::commit() {
+    if (!isOpen()) {
+        return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return false;
+    }
+    uint64_t target = nextSequence_;
+    while (durableSequence_ < target && fd_ >= 0) {
+        if (flushing_) {
+            // Whoever is writing may already be carrying our records
+            flushed_.wait(lock);
+            continue;
+        }
+        if (!flushGroup(lock)) {
+            return false;
+        }
+    }
+    return fd_ >= 0 && durableSequence_ >= target;
+}
+
+bool TransactionJournal::flushGroup(std::unique_lock<std::mutex>& lock) {
+    flushing_ = true;
+    writing_.swap(pending_);
+    uint64_t end = nextSequence_;
+    int fd = fd_;
+
+    lock.unlock();
+    bool ok = writeAll(fd, reinterpret_cast<const char*>(writing_.data()),
+                       writing_.size() * sizeof(JournalRecord))
+              && syncFile(fd);
+    lock.lock();
+
+    writing_.clear();
+    flushing_ = false;
+    if (ok) {
+        durableSequence_ = end;
+        syncs_++;
+    } else {
+        error_ = "write failed; journal closed";
+        std::cout << "[Journal] " << error_ << "\n";
+        closeFile();
+    }
+    flushed_.notify_all();
+    return ok;
+}
+
+uint32_t TransactionJournal::checksum(const JournalRecord& record) {
+    JournalRecord copy = record;
+    copy.checksum = 0;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&copy);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < sizeof(copy); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+JournalRecord TransactionJournal::makeRecord(JournalRecordType type, const Plant* plant, const std::string& party) {
+    JournalRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.type = static_cast<uint8_t>(type);
+    record.version = VERSION;
+    record.row = -1;
+    record.col = -1;
+    if (plant != nullptr) {
+        copyText(record.plantId, plant->getID());
+    }
+    copyText(record.party, party);
+    return record;
+}
+
+void TransactionJournal::append(JournalRecord& record) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ < 0) {
+        return;
+    }
+    record.sequence = nextSequence_++;
+    record.checksum = checksum(record);
+    pending_.push_back(record);
+    appended_++;
+    if (pending_.size() >= groupSize_ && !flushing_) {
+        flushGroup(lock);
+    }
+}
+
+void TransactionJournal::recordAddition(const Plant* plant, JournalLocation where, int row, int col) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Addition, plant, std::string());
+    record.detail = static_cast<uint8_t>(where);
+    record.row = row;
+    record.col = col;
+    append(record);
+}
+
+void TransactionJournal::recordDiscard(const Plant* plant) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Discard, plant, std::string());
+    append(record);
+}
+
+void TransactionJournal::recordSale(const std::string& customer, double amount) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Sale, nullptr, customer);
+    record.amount = amount;
+    append(record);
+}
+
+void TransactionJournal::recordPayment(const std::string& customer, double amount) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Payment, nullptr, customer);
+    record.amount = amount;
+    append(record);
+}
+
+void TransactionJournal::recordTransfer(const Plant* plant, const std::string& customer, JournalLocation from,
+                                        int row, int col) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Transfer, plant, customer);
+    record.detail = static_cast<uint8_t>(from);
+    record.row = row;
+    record.col = col;
+    append(record);
+}
+
+void TransactionJournal::recordRelocation(const Plant* plant, int row, int col) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Relocation, plant, std::string());
+    record.row = row;
+    record.col = col;
+    append(record);
+}
+
+void TransactionJournal::recordReturn(const Plant* plant, int row, int col) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Return, plant, std::string());
+    record.row = row;
+    record.col = col;
+    append(record);
+}
+
+void TransactionJournal::recordCare(const Plant* plant, CareAction action) {
+    if (!isOpen()) {
+        return;
+    }
+    JournalRecord record = makeRecord(JournalRecordType::Care, plant, std::string());
+    record.detail = static_cast<uint8_t>(action);
+    append(record);
+}
+
+uint64_t TransactionJournal::getAppendedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return appended_;
+}
+
+uint64_t TransactionJournal::getSyncCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return syncs_;
+}
+
+std::string TransactionJournal::getError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_;
+}
@@ -3,27 +3,21 @@
 Vegetable::Vegetable(const std::string& name, const std::string& id,
                      CareStrategy* careStrategy, PlantState* initialState)
     : Plant(name, id, careStrategy, initialState) {
-    setPrice(12.0);
+    setSpecies(VegetableTraits::SPECIES);
+    setPrice(VegetableTraits::BASE_PRICE);
 }
 
 Vegetable::~Vegetable() {
 }
 
-void Vegetable::dailyUpdate() {
-    incrementAge();
-    
+int Vegetable::getDailyWaterLoss() const {
     // Vegetables are heavy feeders and drinkers
-    setWaterLevel(getWaterLevel() - 12);
-    
+    return VegetableTraits::DAILY_WATER_LOSS;
+}
+
+int Vegetable::getDailyNutrientLoss() const {
     // Vegetables consume nutrients quickly
-    setNutrientLevel(getNutrientLevel() - 10);
-    
-    updateHealth();
-    notify();
-    
-    if (getState() != nullptr) {
-        getState()->handleChange(this);
-    }
+    return VegetableTraits::DAILY_NUTRIENT_LOSS;
 }
 
 std::string Vegetable::toString() const {
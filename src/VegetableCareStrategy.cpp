@@ -1,11 +1,16 @@
 #include "include/VegetableCareStrategy.h"
 #include "include/Plant.h"
+#include "include/SpeciesKernel.h"
 #include <iostream>
 
+VegetableCareStrategy* VegetableCareStrategy::getInstance() {
+    static VegetableCareStrategy instance;
+    return &instance;
+}
 
 void VegetableCareStrategy::water(Plant* plant) {
     // Vegetables need regular, moderate watering
-    plant->setWaterLevel(plant->getWaterLevel() + 100);
+    plant->setWaterLevel(plant->getWaterLevel() + VegetableTraits::WATER_GAIN);
     std::cout << "Watering vegetable - regular watering schedule" << std::endl;
     (void)plant;
 }
@@ -13,14 +18,14 @@ void VegetableCareStrategy::water(Plant* plant) {
 
 void VegetableCareStrategy::fertilize(Plant* plant) {
     // Vegetables are heavy feeders
-    plant->setNutrientLevel(plant->getNutrientLevel() + 25);
+    plant->setNutrientLevel(plant->getNutrientLevel() + VegetableTraits::NUTRIENT_GAIN);
     std::cout << "Fertilizing vegetable - nutrient-rich feeding" << std::endl;
 }
 
 
 void VegetableCareStrategy::adjustSunlight(Plant* plant) {
     // Vegetables need good sunlight
-    plant->setSunlightExposure(75);
+    plant->setSunlightExposure(VegetableTraits::SUNLIGHT_TARGET);
     std::cout << "Adjusting vegetable sunlight - full sun exposure" << std::endl;
 }
 
@@ -28,4 +33,9 @@ void VegetableCareStrategy::adjustSunlight(Plant* plant) {
 void VegetableCareStrategy::prune(Plant* plant) {
     std::cout << "Pruning vegetable - removing old growth and suckers" << std::endl;
 (void)plant;
-}
\ No newline at end of file
+}
+
+void VegetableCareStrategy::careForBatch(CareAction action, Plant* const* plants, size_t count) {
+    SpeciesKernel<VegetableTraits>::care(action, plants, count);
+    std::cout << "Caring for " << count << " vegetables in one batch" << std::endl;
+}
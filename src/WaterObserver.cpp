@@ -17,8 +17,16 @@ WaterObserver::~WaterObserver() {
 }
 
 void WaterObserver::update(Plant* plant) {
-    if (plant->getWaterLevel() < 30) {
+    if (plant->getWaterLevel() < PlantTraits::LOW_WATER) {
         Command* cmd = new WaterPlantCommand(plant);
         scheduler_->addTask(cmd);
     }
 }
+
+void WaterObserver::updateBatch(Plant* const* plants, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        if (plants[i]->getWaterLevel() < PlantTraits::LOW_WATER) {
+            scheduler_->addTask(new WaterPlantCommand(plants[i]));
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include "include/WaterPlantCommand.h"
 #include "include/Plant.h"
 #include "include/CareStrategy.h"
+#include "include/TransactionJournal.h"
 #include <iostream>
 
 WaterPlantCommand::WaterPlantCommand(Plant* target) 
@@ -10,6 +11,15 @@ WaterPlantCommand::WaterPlantCommand(Plant* target)
 void WaterPlantCommand::execute() {
     if (target_ != nullptr && target_->getStrategy() != nullptr) {
         target_->getStrategy()->water(target_);
+        TransactionJournal::getInstance()->recordCare(target_, CareAction::Water);
     }
 }
 
+Plant* WaterPlantCommand::getTarget() const {
+    return target_;
+}
+
+bool WaterPlantCommand::getCareAction(CareAction& action) const {
+    action = CareAction::Water;
+    return true;
+}
@@ -320,3 +320,37 @@ TEST(EdgeCaseTest, PruneExecutesWithoutError) {
     FlowerCareStrategy strategy;
     EXPECT_NO_THROW(strategy.prune(&plant));
 }
+
+// ==================== Shared Instance Tests ====================
+
+TEST(SharedStrategyTest, GetInstanceReturnsSameObject) {
+    EXPECT_EQ(FlowerCareStrategy::getInstance(), FlowerCareStrategy::getInstance());
+    EXPECT_EQ(SucculentCareStrategy::getInstance(), SucculentCareStrategy::getInstance());
+    EXPECT_EQ(VegetableCareStrategy::getInstance(), VegetableCareStrategy::getInstance());
+    EXPECT_EQ(OtherPlantCareStrategy::getInstance(), OtherPlantCareStrategy::getInstance());
+}
+
+TEST(SharedStrategyTest, PlantsShareStrategyWithoutOwningIt) {
+    Plant* plant1 = new Plant("Rose", "037", FlowerCareStrategy::getInstance(), nullptr);
+    Plant* plant2 = new Plant("Daisy", "038", FlowerCareStrategy::getInstance(), nullptr);
+    EXPECT_EQ(plant1->getStrategy(), plant2->getStrategy());
+
+    delete plant1;
+
+    // Shared strategy must survive the deletion of a plant that used it
+    plant2->setWaterLevel(10);
+    plant2->getStrategy()->water(plant2);
+    EXPECT_EQ(plant2->getWaterLevel(), 60);
+    delete plant2;
+}
+
+TEST(SharedStrategyTest, SetStrategySwapsPointer) {
+    Plant plant("Test", "039", FlowerCareStrategy::getInstance(), nullptr);
+    plant.setStrategy(SucculentCareStrategy::getInstance());
+    EXPECT_EQ(plant.getStrategy(), SucculentCareStrategy::getInstance());
+
+    plant.setStrategy(FlowerCareStrategy::getInstance());
+    plant.setWaterLevel(50);
+    plant.getStrategy()->water(&plant);
+    EXPECT_EQ(plant.getWaterLevel(), 100);
+}
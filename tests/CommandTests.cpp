@@ -3,8 +3,15 @@
 #include "include/WaterPlantCommand.h"
 #include "include/FertilizePlantCommand.h"
 #include "include/AdjustSunlightCommand.h"
+#include "include/RegionCareCommand.h"
+#include "include/Greenhouse.h"
+#include <string>
+#include <utility>
+#include <vector>
 #include "include/CareScheduler.h"
 #include "include/Plant.h"
+#include "include/Flower.h"
+#include "include/SimulationCalendar.h"
 #include "include/FlowerCareStrategy.h"
 #include "include/SucculentCareStrategy.h"
 #include "include/VegetableCareStrategy.h"
@@ -26,17 +33,17 @@ protected:
         scheduler = new CareScheduler();
         
         // Create test plants with different strategies
-        flowerPlant = new Plant("Rose", "R001", new FlowerCareStrategy(), new MatureState());
+        flowerPlant = new Plant("Rose", "R001", FlowerCareStrategy::getInstance(), new MatureState());
         flowerPlant->setWaterLevel(20);
         flowerPlant->setNutrientLevel(25);
         flowerPlant->setSunlightExposure(30);
         
-        succulentPlant = new Plant("Cactus", "C001", new SucculentCareStrategy(), new MatureState());
+        succulentPlant = new Plant("Cactus", "C001", SucculentCareStrategy::getInstance(), new MatureState());
         succulentPlant->setWaterLevel(15);
         succulentPlant->setNutrientLevel(20);
         succulentPlant->setSunlightExposure(25);
         
-        vegetablePlant = new Plant("Tomato", "T001", new VegetableCareStrategy(), new MatureState());
+        vegetablePlant = new Plant("Tomato", "T001", VegetableCareStrategy::getInstance(), new MatureState());
         vegetablePlant->setWaterLevel(10);
         vegetablePlant->setNutrientLevel(15);
         vegetablePlant->setSunlightExposure(20);
@@ -313,7 +320,7 @@ TEST_F(CommandTest, CommandsOnDifferentPlants) {
 
 TEST_F(CommandTest, CommandsDelegateToCorrectStrategy) {
     // Test that commands correctly delegate to strategy methods
-    Plant* otherPlant = new Plant("Generic", "G001", new OtherPlantCareStrategy(), new MatureState());
+    Plant* otherPlant = new Plant("Generic", "G001", OtherPlantCareStrategy::getInstance(), new MatureState());
     otherPlant->setWaterLevel(50);
     otherPlant->setNutrientLevel(50);
     otherPlant->setSunlightExposure(50);
@@ -358,4 +365,389 @@ TEST_F(CommandTest, LargeNumberOfCommands) {
     
     EXPECT_TRUE(scheduler->empty());
     EXPECT_EQ(flowerPlant->getWaterLevel(), 100); // Should be capped at 100
-}
\ No newline at end of file
+}
+
+// ============ RegionCareCommand Tests ============
+
+TEST_F(CommandTest, RegionCommandWatersRowBandInOneTask) {
+    Greenhouse greenhouse(nullptr, 3, 4);
+    Plant* rose = new Plant("Rose", "R100", FlowerCareStrategy::getInstance(), new MatureState());
+    Plant* cactus = new Plant("Cactus", "C100", SucculentCareStrategy::getInstance(), new MatureState());
+    Plant* tomato = new Plant("Tomato", "T100", VegetableCareStrategy::getInstance(), new MatureState());
+    rose->setWaterLevel(20);
+    cactus->setWaterLevel(20);
+    tomato->setWaterLevel(20);
+    greenhouse.addPlant(rose, 0, 3);
+    greenhouse.addPlant(cactus, 1, 0);
+    greenhouse.addPlant(tomato, 2, 1);
+
+    RegionCareCommand* cmd = new RegionCareCommand(&greenhouse, greenhouse.getGrid().getRowRange(0, 2), CareAction::Water);
+    cmd->execute();
+    EXPECT_EQ(cmd->getLastPlantCount(), 2);
+    delete cmd;
+
+    EXPECT_EQ(rose->getWaterLevel(), 70);    // FlowerCareStrategy adds 50
+    EXPECT_EQ(cactus->getWaterLevel(), 35);  // SucculentCareStrategy adds 15
+    EXPECT_EQ(tomato->getWaterLevel(), 20);  // Outside the band
+
+    scheduler->addTask(new RegionCareCommand(&greenhouse, greenhouse.getGrid().getColumnRange(1, 1), CareAction::AdjustSunlight));
+    scheduler->runAll();
+    EXPECT_EQ(tomato->getSunlightExposure(), 75);
+}
+
+TEST_F(CommandTest, RegionCommandResolvesNamedZoneWhenRun) {
+    Greenhouse greenhouse(nullptr, 4, 4);
+    Plant* north = new Plant("Rose", "R101", FlowerCareStrategy::getInstance(), new MatureState());
+    Plant* south = new Plant("Tulip", "T101", FlowerCareStrategy::getInstance(), new MatureState());
+    north->setNutrientLevel(10);
+    south->setNutrientLevel(10);
+    greenhouse.addPlant(north, 0, 0);
+    greenhouse.addPlant(south, 3, 3);
+
+    EXPECT_TRUE(greenhouse.defineZone("Bay A", GridRegion{0, 0, 2, 2}));
+    RegionCareCommand cmd(&greenhouse, std::string("Bay A"), CareAction::Fertilize);
+
+    cmd.execute();
+    EXPECT_EQ(north->getNutrientLevel(), 30);
+    EXPECT_EQ(south->getNutrientLevel(), 10);
+
+    // Moving the zone retargets the queued command
+    EXPECT_TRUE(greenhouse.defineZone("Bay A", GridRegion{2, 2, 10, 10}));
+    cmd.execute();
+    EXPECT_EQ(cmd.getLastPlantCount(), 1);
+    EXPECT_EQ(north->getNutrientLevel(), 30);
+    EXPECT_EQ(south->getNutrientLevel(), 30);
+
+    EXPECT_TRUE(greenhouse.removeZone("Bay A"));
+    cmd.execute();
+    EXPECT_EQ(cmd.getLastPlantCount(), 0);
+    EXPECT_FALSE(greenhouse.defineZone("Outside", GridRegion{5, 5, 2, 2}));
+}
+
+// ============ Batched Execution Tests ============
+
+namespace {
+
+typedef std::vector<std::pair<Plant*, std::string>> CareLog;
+
+/**
+ * @brief Strategy that records every call instead of changing the plant.
+ */
+class RecordingStrategy : public CareStrategy {
+public:
+    explicit RecordingStrategy(CareLog* log) : log_(log) {}
+    void water(Plant* plant) override { log_->push_back(std::make_pair(plant, std::string("water"))); }
+    void fertilize(Plant* plant) override { log_->push_back(std::make_pair(plant, std::string("fertilize"))); }
+    void adjustSunlight(Plant* plant) override { log_->push_back(std::make_pair(plant, std::string("sunlight"))); }
+    void prune(Plant* plant) override { (void)plant; }
+
+private:
+    CareLog* log_;
+};
+
+/**
+ * @brief Non-care command that marks its position in the log.
+ */
+class MarkerCommand : public Command {
+public:
+    explicit MarkerCommand(CareLog* log) : log_(log) {}
+    void execute() override { log_->push_back(std::make_pair(static_cast<Plant*>(nullptr), std::string("marker"))); }
+
+private:
+    CareLog* log_;
+};
+
+std::vector<std::string> actionsFor(const CareLog& log, Plant* plant) {
+    std::vector<std::string> actions;
+    for (const auto& entry : log) {
+        if (entry.first == plant) {
+            actions.push_back(entry.second);
+        }
+    }
+    return actions;
+}
+
+} // namespace
+
+TEST_F(CommandTest, BatchedRunMatchesSequentialResults) {
+    scheduler->addTask(new WaterPlantCommand(flowerPlant));
+    scheduler->addTask(new FertilizePlantCommand(succulentPlant));
+    scheduler->addTask(new WaterPlantCommand(vegetablePlant));
+    scheduler->addTask(new AdjustSunlightCommand(flowerPlant));
+    scheduler->addTask(new WaterPlantCommand(succulentPlant));
+    scheduler->addTask(new WaterPlantCommand(nullptr));
+
+    scheduler->runAllBatched();
+
+    EXPECT_TRUE(scheduler->empty());
+    EXPECT_EQ(flowerPlant->getWaterLevel(), 70);
+    EXPECT_EQ(flowerPlant->getSunlightExposure(), 70);
+    EXPECT_EQ(succulentPlant->getWaterLevel(), 30);
+    EXPECT_EQ(succulentPlant->getNutrientLevel(), 30);
+    EXPECT_EQ(vegetablePlant->getWaterLevel(), 100);
+}
+
+TEST_F(CommandTest, BatchedRunBringsCalendarPlantsUpToDateFirst) {
+    Flower sequential("Rose", "R1", FlowerCareStrategy::getInstance(), new MatureState());
+    Flower batched("Rose", "R2", FlowerCareStrategy::getInstance(), new MatureState());
+    sequential.setWaterLevel(80);
+    batched.setWaterLevel(80);
+
+    SimulationCalendar calendar;
+    calendar.addPlant(&sequential);
+    calendar.addPlant(&batched);
+    calendar.advance(6);
+
+    scheduler->addTask(new WaterPlantCommand(&sequential));
+    scheduler->runAll();
+    scheduler->addTask(new WaterPlantCommand(&batched));
+    scheduler->runAllBatched();
+
+    // The six missed days of decay come before the watering in both runs
+    EXPECT_EQ(sequential.getWaterLevel(), 50);
+    EXPECT_EQ(batched.getWaterLevel(), sequential.getWaterLevel());
+    EXPECT_EQ(batched.getNutrientLevel(), sequential.getNutrientLevel());
+    EXPECT_EQ(batched.getAge(), sequential.getAge());
+}
+
+TEST_F(CommandTest, BatchedRunGroupsByStrategyAndKeepsPerPlantOrder) {
+    CareLog log;
+    RecordingStrategy first(&log);
+    RecordingStrategy second(&log);
+    Plant a("A", "A1", &first, new MatureState());
+    Plant b("B", "B1", &second, new MatureState());
+    Plant c("C", "C1", &first, new MatureState());
+
+    scheduler->addTask(new WaterPlantCommand(&a));
+    scheduler->addTask(new WaterPlantCommand(&b));
+    scheduler->addTask(new FertilizePlantCommand(&a));
+    scheduler->addTask(new WaterPlantCommand(&c));
+    scheduler->addTask(new WaterPlantCommand(&a));
+    scheduler->addTask(new MarkerCommand(&log));
+    scheduler->addTask(new AdjustSunlightCommand(&b));
+
+    scheduler->runAllBatched();
+
+    ASSERT_EQ(log.size(), 7);
+    // First wave: every plant's first command, grouped by strategy
+    EXPECT_EQ(log[0].first, &a);
+    EXPECT_EQ(log[1].first, &c);
+    EXPECT_EQ(log[2].first, &b);
+    // The marker is a barrier for everything queued before it
+    EXPECT_EQ(log[5].second, "marker");
+    EXPECT_EQ(log[6].first, &b);
+
+    std::vector<std::string> expected = {"water", "fertilize", "water"};
+    EXPECT_EQ(actionsFor(log, &a), expected);
+    expected = {"water", "sunlight"};
+    EXPECT_EQ(actionsFor(log, &b), expected);
+}
+
+// ============ Delayed and Recurring Task Tests ============
+
+namespace {
+
+/**
+ * @brief Command that records the scheduler day it ran on.
+ */
+class DayRecordingCommand : public Command {
+public:
+    DayRecordingCommand(CareScheduler* scheduler, std::vector<long long>* days)
+        : scheduler_(scheduler), days_(days) {}
+    void execute() override { days_->push_back(scheduler_->getCurrentDay()); }
+
+private:
+    CareScheduler* scheduler_;
+    std::vector<long long>* days_;
+};
+
+} // namespace
+
+TEST_F(CommandTest, RecurringAndDelayedTasksRunOnTheirDays) {
+    std::vector<long long> everyTwo;
+    std::vector<long long> once;
+    scheduler->scheduleEvery(new DayRecordingCommand(scheduler, &everyTwo), 2);
+    scheduler->scheduleAt(new DayRecordingCommand(scheduler, &once), 10);
+    scheduler->scheduleAfter(new WaterPlantCommand(flowerPlant), 3);
+    EXPECT_EQ(scheduler->getScheduledCount(), 3);
+
+    EXPECT_EQ(scheduler->advanceDay(), 0);
+    EXPECT_EQ(scheduler->advanceDays(2), 2);   // day 2 recurring, day 3 water
+    EXPECT_EQ(flowerPlant->getWaterLevel(), 70);
+    scheduler->advanceDays(7);
+
+    std::vector<long long> expected = {2, 4, 6, 8, 10};
+    EXPECT_EQ(everyTwo, expected);
+    expected = {10};
+    EXPECT_EQ(once, expected);
+    EXPECT_EQ(scheduler->getCurrentDay(), 10);
+    EXPECT_EQ(scheduler->getScheduledCount(), 1);
+    EXPECT_TRUE(scheduler->empty());
+}
+
+TEST_F(CommandTest, CancelledAndFarFutureTasks) {
+    std::vector<long long> cancelled;
+    std::vector<long long> weekly;
+    std::vector<long long> far;
+    CareScheduler::TaskId id = scheduler->scheduleEvery(new DayRecordingCommand(scheduler, &cancelled), 1);
+    CareScheduler::TaskId weeklyId = scheduler->scheduleEvery(new DayRecordingCommand(scheduler, &weekly), 7, 5);
+    // Past the first two wheels, so it has to cascade down to fire on time
+    scheduler->scheduleAt(new DayRecordingCommand(scheduler, &far), 5000);
+
+    scheduler->advanceDays(3);
+    EXPECT_TRUE(scheduler->cancelTask(id));
+    EXPECT_FALSE(scheduler->cancelTask(id));
+    EXPECT_FALSE(scheduler->isTaskScheduled(id));
+    EXPECT_TRUE(scheduler->isTaskScheduled(weeklyId));
+
+    scheduler->advanceDays(4997);
+    EXPECT_EQ(cancelled.size(), 3);
+    ASSERT_EQ(far.size(), 1);
+    EXPECT_EQ(far[0], 5000);
+    ASSERT_FALSE(weekly.empty());
+    EXPECT_EQ(weekly.front(), 5);
+    EXPECT_EQ(weekly.back(), 4996);
+    EXPECT_EQ(weekly.size(), 714);
+    EXPECT_EQ(scheduler->getScheduledCount(), 1);
+}
+
+// ============ Parallel Execution Tests ============
+
+namespace {
+
+/**
+ * @brief Strategy that appends each action to a per-plant log indexed by plant ID.
+ *
+ * Each log is only touched by the worker that owns the plant, so the
+ * strategy is safe to share between workers.
+ */
+class SequenceStrategy : public CareStrategy {
+public:
+    explicit SequenceStrategy(std::vector<std::vector<int>>* logs) : logs_(logs) {}
+    void water(Plant* plant) override { record(plant, 0); }
+    void fertilize(Plant* plant) override { record(plant, 1); }
+    void adjustSunlight(Plant* plant) override { record(plant, 2); }
+    void prune(Plant* plant) override { (void)plant; }
+
+private:
+    void record(Plant* plant, int action) { (*logs_)[std::stoi(plant->getID())].push_back(action); }
+
+    std::vector<std::vector<int>>* logs_;
+};
+
+/**
+ * @brief Barrier command that counts how many care actions had run before it.
+ */
+class LogSizeProbe : public Command {
+public:
+    LogSizeProbe(const std::vector<std::vector<int>>* logs, size_t* seen) : logs_(logs), seen_(seen) {}
+    void execute() override {
+        *seen_ = 0;
+        for (const std::vector<int>& log : *logs_) {
+            *seen_ += log.size();
+        }
+    }
+
+private:
+    const std::vector<std::vector<int>>* logs_;
+    size_t* seen_;
+};
+
+} // namespace
+
+TEST_F(CommandTest, ParallelRunKeepsPerPlantOrderAndBarriers) {
+    const int plantCount = 500;
+    std::vector<std::vector<int>> logs(plantCount);
+    SequenceStrategy strategy(&logs);
+    std::vector<Plant*> plants;
+    for (int i = 0; i < plantCount; i++) {
+        plants.push_back(new Plant("P", std::to_string(i), &strategy, new MatureState()));
+    }
+
+    size_t seenAtBarrier = 0;
+    for (Plant* plant : plants) {
+        scheduler->addTask(new WaterPlantCommand(plant));
+        scheduler->addTask(new FertilizePlantCommand(plant));
+    }
+    scheduler->addTask(new LogSizeProbe(&logs, &seenAtBarrier));
+    for (Plant* plant : plants) {
+        scheduler->addTask(new AdjustSunlightCommand(plant));
+        scheduler->addTask(new WaterPlantCommand(plant));
+    }
+    scheduler->addTask(new WaterPlantCommand(nullptr));
+
+    CareScheduler::ParallelRunSummary summary = scheduler->runAllParallel(4);
+
+    EXPECT_TRUE(scheduler->empty());
+    EXPECT_EQ(summary.commandCount, 2002);
+    EXPECT_EQ(summary.barrierCount, 1);
+    EXPECT_EQ(summary.workerCount, 4u);
+    EXPECT_LT(summary.largestShard, 1000);
+    EXPECT_EQ(seenAtBarrier, 1000);
+    std::vector<int> expected = {0, 1, 2, 0};
+    for (int i = 0; i < plantCount; i++) {
+        EXPECT_EQ(logs[i], expected) << "plant " << i;
+    }
+
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+}
+
+TEST_F(CommandTest, ParallelRunKeepsPlantsWithSharedStateOnTheCallingThread) {
+    const int plantCount = 300;
+    Greenhouse greenhouse(nullptr, 10, 10);
+    SimulationCalendar calendar;
+    std::vector<Plant*> tracked;
+    std::vector<Plant*> bare;
+    for (int i = 0; i < plantCount; i++) {
+        Plant* plant = new Flower("Rose", std::to_string(i), FlowerCareStrategy::getInstance(), new MatureState());
+        plant->setWaterLevel(80);
+        if (i < 100) {
+            ASSERT_TRUE(greenhouse.addPlant(plant, i / 10, i % 10));
+        } else if (i < 200) {
+            calendar.addPlant(plant);
+            tracked.push_back(plant);
+        } else {
+            bare.push_back(plant);
+        }
+        scheduler->addTask(new WaterPlantCommand(plant));
+    }
+    calendar.advance(6);
+
+    CareScheduler::ParallelRunSummary summary = scheduler->runAllParallel(4);
+
+    // Greenhouse and calendar plants all land on the calling thread's shard
+    EXPECT_EQ(summary.commandCount, plantCount);
+    EXPECT_GE(summary.largestShard, 200u);
+    for (Plant* plant : tracked) {
+        EXPECT_EQ(plant->getWaterLevel(), 50) << plant->getID();
+    }
+    for (Plant* plant : bare) {
+        EXPECT_EQ(plant->getWaterLevel(), 100) << plant->getID();
+    }
+
+    for (Plant* plant : tracked) {
+        delete plant;
+    }
+    for (Plant* plant : bare) {
+        delete plant;
+    }
+}
+
+TEST_F(CommandTest, ParallelRunMatchesSequentialResults) {
+    scheduler->addTask(new WaterPlantCommand(flowerPlant));
+    scheduler->addTask(new FertilizePlantCommand(succulentPlant));
+    scheduler->addTask(new WaterPlantCommand(vegetablePlant));
+    scheduler->addTask(new AdjustSunlightCommand(flowerPlant));
+
+    CareScheduler::ParallelRunSummary summary = scheduler->runAllParallel();
+
+    EXPECT_TRUE(scheduler->empty());
+    EXPECT_EQ(summary.commandCount, 4);
+    EXPECT_GE(summary.workerCount, 1u);
+    EXPECT_EQ(flowerPlant->getWaterLevel(), 70);
+    EXPECT_EQ(flowerPlant->getSunlightExposure(), 70);
+    EXPECT_EQ(succulentPlant->getNutrientLevel(), 30);
+    EXPECT_EQ(vegetablePlant->getWaterLevel(), 100);
+}
@@ -37,17 +37,17 @@ protected:
     
     void SetUp() override {
         plant1 = new Plant("Rose", "R001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant1->setPrice(50.0);
         
         plant2 = new Plant("Tulip", "T001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant2->setPrice(30.0);
         
         plant3 = new Plant("Daisy", "D001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant3->setPrice(20.0);
     }
@@ -186,7 +186,7 @@ TEST_F(CompositeTest, OrderDescriptionIncludesAllLeaves) {
 TEST_F(CompositeTest, CloneCreatesDeepCopy) {
     ConcreteOrder* original = new ConcreteOrder("Original");
     Plant* p = new Plant("Rose", "R001", 
-                        new FlowerCareStrategy(), 
+                        FlowerCareStrategy::getInstance(), 
                         new MatureState());
     p->setPrice(50.0);
     original->add(new Leaf(p));
@@ -17,6 +17,8 @@
 #include "include/RibbonDecorator.h"
 #include "include/GiftWrapDecorator.h"
 #include "include/DecorativePotDecorator.h"
+#include "include/SalesLedger.h"
+#include <cstdio>
 
 // ============ Test Fixture for Customer Tests ============
 
@@ -48,15 +50,15 @@ protected:
         mediator->registerColleague(customer);
         
         // Create test plants
-        testPlant1 = new Plant("Rose", "R001", new FlowerCareStrategy(), new MatureState());
+        testPlant1 = new Plant("Rose", "R001", FlowerCareStrategy::getInstance(), new MatureState());
         testPlant1->setPrice(50.0);
         testPlant1->setReadyForSale(true);
         
-        testPlant2 = new Plant("Daisy", "D001", new FlowerCareStrategy(), new MatureState());
+        testPlant2 = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new MatureState());
         testPlant2->setPrice(30.0);
         testPlant2->setReadyForSale(true);
         
-        testPlant3 = new Plant("Tulip", "T001", new FlowerCareStrategy(), new MatureState());
+        testPlant3 = new Plant("Tulip", "T001", FlowerCareStrategy::getInstance(), new MatureState());
         testPlant3->setPrice(40.0);
         testPlant3->setReadyForSale(true);
         
@@ -207,6 +209,35 @@ TEST_F(CustomerTest, GetCartReturnsCorrectVector) {
     EXPECT_EQ(cart.size(), 2);
 }
 
+TEST_F(CustomerTest, CartBudgetAndFloorChangesAreCounted) {
+    uint64_t customerChanges = customer->getChangeCount();
+    uint64_t floorChanges = salesFloor->getChangeCount();
+    customer->addPlantFromSalesFloor("Rose");
+    EXPECT_GT(customer->getChangeCount(), customerChanges);
+    EXPECT_GT(salesFloor->getChangeCount(), floorChanges);
+
+    customerChanges = customer->getChangeCount();
+    customer->decorateCartItemWithRibbon(0);
+    EXPECT_GT(customer->getChangeCount(), customerChanges);
+
+    customerChanges = customer->getChangeCount();
+    customer->deductFromBudget(10.0);
+    EXPECT_GT(customer->getChangeCount(), customerChanges);
+
+    uint64_t greenhouseChanges = greenhouse->getChangeCount();
+    greenhouse->markChanged();
+    EXPECT_GT(greenhouse->getChangeCount(), greenhouseChanges);
+
+    // Plant setters and reads are not counted; whoever changes plants in place marks the container
+    customerChanges = customer->getChangeCount();
+    floorChanges = salesFloor->getChangeCount();
+    testPlant2->setWaterLevel(10);
+    customer->getCart();
+    customer->getBudget();
+    EXPECT_EQ(customer->getChangeCount(), customerChanges);
+    EXPECT_EQ(salesFloor->getChangeCount(), floorChanges);
+}
+
 // ============ Plant Decoration Tests ============
 
 TEST_F(CustomerTest, GetPlantFromCartReturnsCorrectPlant) {
@@ -549,4 +580,120 @@ TEST_F(CustomerTest, CompleteShoppingFlow) {
     EXPECT_EQ(customer->getCartSize(), 0);
     
     delete finalOrder;
-}
\ No newline at end of file
+}
+
+// ============ Sales Ledger Tests ============
+
+TEST_F(CustomerTest, CheckoutRecordsEachPlantInTheSalesLedger) {
+    SalesLedger* ledger = SalesLedger::getInstance();
+    ledger->clear();
+    ledger->setDay(9);
+
+    customer->addPlantFromSalesFloor("Rose");
+    customer->addPlantFromSalesFloor("Daisy");
+    customer->decorateCartItemWithRibbon(0);
+    customer->decorateCartItemWithPot(1, "blue");
+    double budgetBefore = customer->getBudget();
+
+    customer->checkOut();
+    double paid = budgetBefore - customer->getBudget();
+    ASSERT_GT(paid, 80.0);
+
+    EXPECT_EQ(ledger->getLineItemCount(), 2u);
+    EXPECT_NEAR(ledger->revenue(), paid, 1e-9);
+    EXPECT_NEAR(ledger->revenue(9, 9), paid, 1e-9);
+    EXPECT_DOUBLE_EQ(ledger->revenue(10, 20), 0.0);
+    EXPECT_NEAR(ledger->revenueByCustomerType()[SalesLedger::Regular], paid, 1e-9);
+    EXPECT_DOUBLE_EQ(ledger->revenueByCustomerType()[SalesLedger::WalkIn], 0.0);
+
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(), 1.0);
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(SalesLedger::Ribbon), 0.5);
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(SalesLedger::DecorativePot), 0.5);
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(SalesLedger::GiftWrap), 0.0);
+
+    // Decorations are unwrapped, so the sale counts for the species underneath
+    RevenueTable table = ledger->revenueBySpeciesPerWeek();
+    EXPECT_EQ(table.firstWeek, 1);
+    EXPECT_EQ(table.weekCount, 1);
+    EXPECT_GT(table.get(1, "Rose"), 50.0);
+    EXPECT_GT(table.get(1, "Daisy"), 30.0);
+    EXPECT_NEAR(table.get(1, "Rose") + table.get(1, "Daisy"), paid, 1e-9);
+
+    ledger->clear();
+    ledger->setDay(0);
+}
+
+TEST(SalesLedgerTest, SpilledChunksAnswerLikeResidentOnes) {
+    SalesLedger* ledger = SalesLedger::getInstance();
+    const size_t rows = SalesLedger::CHUNK_ROWS * 3 + 1234;
+    const char* speciesNames[] = {"Rose", "Daisy", "Cactus", "Monstera", "Carrot"};
+
+    double total = 0.0;
+    double weekTwoRose = 0.0;
+    double daysTenToTwenty = 0.0;
+    size_t giftWrapped = 0;
+
+    // Fills the ledger with the same line items each time; day rises slowly
+    // so every chunk covers a short range of days
+    auto fill = [&](bool tally) {
+        for (int s = 0; s < 5; s++) {
+            ledger->speciesCode(speciesNames[s]);
+        }
+        for (size_t i = 0; i < rows; i++) {
+            int day = static_cast<int>(i / 5000);
+            uint16_t species = static_cast<uint16_t>(i % 5);
+            uint8_t decorations = static_cast<uint8_t>(i % 7 == 0 ? SalesLedger::GiftWrap : 0);
+            double price = 10.0 + static_cast<double>(i % 13);
+            SalesLedger::CustomerType type = static_cast<SalesLedger::CustomerType>(i % 3);
+            ledger->addLineItem(day, type, species, decorations, price, PaymentMethod::CreditCard);
+            if (tally) {
+                total += price;
+                weekTwoRose += (day / 7 == 2 && species == 0) ? price : 0.0;
+                daysTenToTwenty += (day >= 10 && day <= 20) ? price : 0.0;
+                giftWrapped += decorations != 0;
+            }
+        }
+    };
+
+    ledger->clear();
+    fill(true);
+    EXPECT_EQ(ledger->getLineItemCount(), rows);
+    EXPECT_EQ(ledger->getSpilledLineItemCount(), 0u);
+    EXPECT_NEAR(ledger->revenue(), total, 1e-6);
+    EXPECT_NEAR(ledger->revenue(10, 20), daysTenToTwenty, 1e-6);
+    EXPECT_NEAR(ledger->revenueBySpeciesPerWeek().get(2, "Rose"), weekTwoRose, 1e-6);
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(SalesLedger::GiftWrap),
+                     static_cast<double>(giftWrapped) / static_cast<double>(rows));
+    std::vector<double> byType = ledger->revenueByCustomerType();
+    RevenueTable resident = ledger->revenueBySpeciesPerWeek(3, 30);
+
+    std::string path = ::testing::TempDir() + "nursery_ledger.spill";
+    ledger->clear();
+    ASSERT_TRUE(ledger->setSpillFile(path, 1));
+    fill(false);
+    EXPECT_EQ(ledger->getLineItemCount(), rows);
+    EXPECT_EQ(ledger->getSpilledLineItemCount(), SalesLedger::CHUNK_ROWS * 2);
+    EXPECT_NEAR(ledger->revenue(), total, 1e-6);
+    EXPECT_NEAR(ledger->revenue(10, 20), daysTenToTwenty, 1e-6);
+    EXPECT_DOUBLE_EQ(ledger->decorationAttachRate(SalesLedger::GiftWrap),
+                     static_cast<double>(giftWrapped) / static_cast<double>(rows));
+    std::vector<double> spilledByType = ledger->revenueByCustomerType();
+    for (size_t t = 0; t < byType.size(); t++) {
+        EXPECT_NEAR(spilledByType[t], byType[t], 1e-6);
+    }
+
+    RevenueTable spilled = ledger->revenueBySpeciesPerWeek(3, 30);
+    EXPECT_EQ(spilled.firstWeek, 0);
+    EXPECT_EQ(spilled.weekCount, 5);
+    ASSERT_EQ(spilled.revenue.size(), resident.revenue.size());
+    for (size_t cell = 0; cell < spilled.revenue.size(); cell++) {
+        EXPECT_NEAR(spilled.revenue[cell], resident.revenue[cell], 1e-6);
+    }
+
+    ledger->clear();
+    std::FILE* gone = std::fopen(path.c_str(), "rb");
+    EXPECT_EQ(gone, nullptr);
+    if (gone != nullptr) {
+        std::fclose(gone);
+    }
+}
@@ -32,7 +32,7 @@ protected:
     void SetUp() override {
         // Create a base plant with mature state so it has a reasonable price
         basePlant = new Plant("Rose", "R001", 
-                              new FlowerCareStrategy(), 
+                              FlowerCareStrategy::getInstance(), 
                               new MatureState());
         basePlant->setPrice(50.0);
     }
@@ -167,7 +167,7 @@ TEST_F(DecoratorTest, TripleStackedDecoratorsAllDescriptions) {
 //Tests plant with base price 0.0
 TEST_F(DecoratorTest, DecoratorOnZeroPricePlant) {
     Plant* freePlant = new Plant("Freebie", "F001", 
-                                 new OtherPlantCareStrategy(), 
+                                 OtherPlantCareStrategy::getInstance(), 
                                  new SeedlingState());
     freePlant->setPrice(0.0);
     
@@ -181,12 +181,12 @@ TEST_F(DecoratorTest, DecoratorOnZeroPricePlant) {
 //Testing different decorator orders give you the same price
 TEST_F(DecoratorTest, DecoratorOrderDoesNotAffectPrice) {
     Plant* plant1 = new Plant("Rose1", "R001", 
-                             new FlowerCareStrategy(), 
+                             FlowerCareStrategy::getInstance(), 
                              new MatureState());
     plant1->setPrice(50.0);
     
     Plant* plant2 = new Plant("Rose2", "R002", 
-                             new FlowerCareStrategy(), 
+                             FlowerCareStrategy::getInstance(), 
                              new MatureState());
     plant2->setPrice(50.0);
     
@@ -204,7 +204,18 @@ TEST_F(DecoratorTest, DecoratorPreservesPlantName) {
     Plant* decoratedPlant = new RibbonDecorator(basePlant);
     
     EXPECT_EQ(decoratedPlant->getName(), "Rose");
-    
+
+    delete decoratedPlant;
+}
+
+//Tests a decorator starts with the sprite cached on the plant it wraps
+TEST_F(DecoratorTest, DecoratorKeepsCachedSpriteId) {
+    EXPECT_EQ(basePlant->getSpriteId(), Plant::NO_SPRITE_ID);
+    basePlant->setSpriteId(4);
+
+    Plant* decoratedPlant = new GiftWrapDecorator(basePlant);
+    EXPECT_EQ(decoratedPlant->getSpriteId(), 4);
+
     delete decoratedPlant;
 }
 
@@ -224,12 +235,12 @@ TEST_F(DecoratorTest, DailyUpdatePropagatesThroughDecorators) {
 //Tests different pot colours appear correctly in descriptions
 TEST_F(DecoratorTest, DifferentPotColorsInDescription) {
     Plant* plant1 = new Plant("Cactus1", "C001", 
-                             new SucculentCareStrategy(), 
+                             SucculentCareStrategy::getInstance(), 
                              new MatureState());
     plant1->setPrice(25.0);
     
     Plant* plant2 = new Plant("Cactus2", "C002", 
-                             new SucculentCareStrategy(), 
+                             SucculentCareStrategy::getInstance(), 
                              new MatureState());
     plant2->setPrice(25.0);
     
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/InventoryImporter.h"
+#include "include/NurseryMediator.h"
+#include "include/Greenhouse.h"
+#include "include/Plant.h"
+#include "include/PlantState.h"
+
+// ============ InventoryImporter Tests ============
+
+TEST(InventoryImporterTest, StreamsRowsInChunksAndSkipsBadOnes) {
+    NurseryMediator mediator;
+    Greenhouse greenhouse(&mediator, 4, 4);
+    std::string manifest =
+        "species,id,age,water,sunlight,nutrients,price,row,col\r\n"
+        "Rose,SUP-1,14,90,90,90,45.5,0,0\r\n"
+        "\"Venus Fly Trap\",\"SUP-2\",0,60,60,60,120,0,1\n"
+        "venus_fly_trap,,1,50,50,50,99,0,2\n"
+        "\n"
+        "Orchid,SUP-3,1,50,50,50,10,0,3\n"
+        "Cactus,SUP-4,two,50,50,50,10,1,0\n"
+        "Cactus,SUP-5,1,50,50,50\n"
+        "Cactus,SUP-6,1,50,50,50,-1,1,0\n"
+        "Daisy,SUP-7,3,50,50,50,10,0,0\n"
+        "Daisy,SUP-8,3,50,50,50,10,9,9\n"
+        "Carrot,SUP-9,40,5,5,5,8,3,3";
+    std::istringstream in(manifest);
+
+    // A buffer shorter than the manifest, so rows straddle reads
+    InventoryImporter importer(&greenhouse, nullptr, 64);
+    ASSERT_TRUE(importer.importStream(in)) << importer.getError();
+    EXPECT_EQ(importer.getImportedCount(), 4u);
+    EXPECT_EQ(importer.getRejectedCount(), 6u);
+    EXPECT_EQ(greenhouse.getNumberOfPlants(), 4);
+
+    Plant* rose = greenhouse.getPlantAt(0, 0);
+    ASSERT_NE(rose, nullptr);
+    EXPECT_EQ(rose->getName(), "Rose");
+    EXPECT_EQ(rose->getID(), "SUP-1");
+    EXPECT_EQ(rose->getAge(), 14);
+    EXPECT_EQ(rose->getHealthLevel(), 90);
+    EXPECT_DOUBLE_EQ(rose->getPrice(), 45.5);
+    EXPECT_EQ(rose->getState()->getStateName(), "Mature");
+    EXPECT_TRUE(rose->isReadyForSale());
+
+    ASSERT_NE(greenhouse.getPlantAt(0, 1), nullptr);
+    EXPECT_EQ(greenhouse.getPlantAt(0, 1)->getID(), "SUP-2");
+    EXPECT_EQ(greenhouse.getPlantAt(0, 1)->getState()->getStateName(), "Seedling");
+    ASSERT_NE(greenhouse.getPlantAt(0, 2), nullptr);
+    EXPECT_EQ(greenhouse.getPlantAt(0, 2)->getName(), "Venus Fly Trap");
+    EXPECT_NE(greenhouse.getPlantAt(0, 2)->getID(), "");
+    ASSERT_NE(greenhouse.getPlantAt(3, 3), nullptr);
+    EXPECT_EQ(greenhouse.getPlantAt(3, 3)->getState()->getStateName(), "Dead");
+
+    const std::vector<std::string>& errors = importer.getRowErrors();
+    ASSERT_EQ(errors.size(), 6u);
+    EXPECT_EQ(errors[0], "line 6: unknown species");
+    EXPECT_EQ(errors[1], "line 7: field is not a number");
+    EXPECT_EQ(errors[2].compare(0, 23, "line 8: expected 9 fiel"), 0);
+    EXPECT_EQ(errors[3], "line 9: age and price cannot be negative");
+    EXPECT_EQ(errors[4], "line 10: cell is taken or outside the greenhouse");
+    EXPECT_EQ(errors[5], "line 11: cell is taken or outside the greenhouse");
+}
+
+TEST(InventoryImporterTest, SkipsLinesLongerThanTheBuffer) {
+    NurseryMediator mediator;
+    Greenhouse greenhouse(&mediator, 2, 2);
+    std::string manifest = "Rose,R-1,1,50,50,50,10,0,0\n" +
+                           std::string("Rose,") + std::string(100, 'x') + ",1,50,50,50,10,0,1\n" +
+                           "Rose,R-3,1,50,50,50,10,1,1\n";
+    std::string path = ::testing::TempDir() + "nursery_manifest.csv";
+    {
+        std::ofstream out(path.c_str(), std::ios::binary);
+        out << manifest;
+    }
+
+    InventoryImporter importer(&greenhouse, nullptr, 32);
+    ASSERT_TRUE(importer.importFile(path)) << importer.getError();
+    EXPECT_EQ(importer.getImportedCount(), 2u);
+    EXPECT_EQ(importer.getRejectedCount(), 1u);
+    ASSERT_EQ(importer.getRowErrors().size(), 1u);
+    EXPECT_EQ(importer.getRowErrors()[0], "line 2: line is longer than the read buffer");
+    EXPECT_EQ(greenhouse.getPlantAt(1, 1)->getID(), "R-3");
+
+    EXPECT_FALSE(importer.importFile(path + ".missing"));
+    std::remove(path.c_str());
+}
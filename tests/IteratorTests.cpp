@@ -66,17 +66,17 @@ protected:
     
     void SetUp() override {
         plant1 = new Plant("Rose", "R001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant1->setPrice(50.0);
         
         plant2 = new Plant("Tulip", "T001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant2->setPrice(30.0);
         
         plant3 = new Plant("Daisy", "D001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant3->setPrice(20.0);
     }
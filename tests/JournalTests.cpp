@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "include/TransactionJournal.h"
+#include "include/JournalReplay.h"
+#include "include/NurseryCoordinator.h"
+#include "include/SalesFloor.h"
+#include "include/Greenhouse.h"
+#include "include/DerivedCustomers.h"
+#include "include/Plant.h"
+#include "include/FlowerCareStrategy.h"
+#include "include/MatureState.h"
+#include "include/SeedlingState.h"
+#include "include/DeadState.h"
+#include "include/WaterPlantCommand.h"
+#include "include/CashPayment.h"
+#include "include/FinalOrder.h"
+#include "include/Leaf.h"
+
+// ============ TransactionJournal Tests ============
+
+class JournalTest : public ::testing::Test {
+protected:
+    NurseryCoordinator* coordinator;
+    SalesFloor* salesFloor;
+    Greenhouse* greenhouse;
+    Plant* testPlant;
+
+    void SetUp() override {
+        coordinator = new NurseryCoordinator();
+        salesFloor = new SalesFloor(coordinator, 3, 3);
+        greenhouse = new Greenhouse(coordinator, 2, 2);
+
+        coordinator->registerColleague(salesFloor);
+        coordinator->registerColleague(greenhouse);
+        coordinator->setSalesFloor(salesFloor);
+        coordinator->setGreenhouse(greenhouse);
+
+        testPlant = new Plant("Rose", "R001",
+                             FlowerCareStrategy::getInstance(),
+                             new MatureState());
+        testPlant->setPrice(50.0);
+        testPlant->setReadyForSale(true);
+    }
+
+    void TearDown() override {
+        delete salesFloor;
+        delete greenhouse;
+        delete coordinator;
+        // Plant deleted by containers
+    }
+};
+
+TEST_F(JournalTest, TransactionsAreJournaledAndReplayed) {
+    std::string path = ::testing::TempDir() + "nursery_transactions.journal";
+    std::remove(path.c_str());
+    TransactionJournal* journal = TransactionJournal::getInstance();
+    ASSERT_TRUE(journal->open(path)) << journal->getError();
+
+    Plant* tulip = new Plant("Tulip", "T001", FlowerCareStrategy::getInstance(), new MatureState());
+    tulip->setPrice(30.0);
+    tulip->setReadyForSale(true);
+    greenhouse->addPlant(testPlant, 0, 0);
+    greenhouse->addPlant(tulip, 0, 1);
+    Plant* fern = new Plant("Fern", "F001", FlowerCareStrategy::getInstance(), new SeedlingState());
+    Plant* daisy = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new MatureState());
+    PlantPlacement stock[] = {{fern, 1, 0, false}, {daisy, 1, 1, false}};
+    ASSERT_EQ(greenhouse->addPlants(stock, 2), 2u);
+    daisy->setState(new DeadState());
+    ASSERT_EQ(greenhouse->removeDeadPlants(), 1);
+    coordinator->checkPlantRelocation();
+
+    RegularCustomer buyer;
+    buyer.setMediator(coordinator);
+    buyer.setName("Ada");
+    ASSERT_TRUE(coordinator->transferPlantToCustomer("Rose", &buyer));
+    ASSERT_TRUE(coordinator->transferPlantToCustomer("Tulip", &buyer));
+    ASSERT_TRUE(buyer.returnPlantToSalesFloor(1));
+    WaterPlantCommand(testPlant).execute();
+
+    FinalOrder order("Ada");
+    order.addOrder(new Leaf(testPlant, false));
+    CashPayment payment;
+    payment.processTransaction(&order);
+    ASSERT_TRUE(buyer.deductFromBudget(order.calculateTotalPrice()));
+
+    EXPECT_EQ(journal->getAppendedCount(), 13u);
+    EXPECT_EQ(journal->getSyncCount(), 0u);     // Only the checkout commits, and this one was done by hand
+    EXPECT_TRUE(journal->commit());
+    EXPECT_EQ(journal->getSyncCount(), 1u);     // One sync covers the whole sale
+    journal->close();
+    EXPECT_FALSE(journal->isOpen());
+
+    JournalReplay replay;
+    ASSERT_TRUE(replay.replay(path)) << replay.getError();
+    EXPECT_EQ(replay.getRecordCount(), 13u);
+    EXPECT_FALSE(replay.hasDamagedTail());
+    EXPECT_EQ(replay.getLocation("R001"), JournalLocation::Sold);
+    EXPECT_EQ(replay.getLocation("T001"), JournalLocation::SalesFloor);
+    EXPECT_EQ(replay.getLocation("F001"), JournalLocation::Greenhouse);    // Stocked and never moved
+    EXPECT_EQ(replay.getLocation("D001"), JournalLocation::Unknown);       // Died and was thrown out
+    EXPECT_EQ(replay.getLocation("X999"), JournalLocation::Unknown);
+    EXPECT_EQ(replay.getPlantCount(JournalLocation::Greenhouse), 1u);
+    EXPECT_EQ(replay.getPlantCount(JournalLocation::Cart), 0u);
+    EXPECT_EQ(replay.getSaleCount(), 1u);
+    EXPECT_DOUBLE_EQ(replay.getSalesTotal(), 50.0);
+    EXPECT_EQ(replay.getPaymentCount(), 1u);
+    EXPECT_DOUBLE_EQ(replay.getPaymentsTotal(), 50.0);
+    EXPECT_EQ(replay.getCareCount(CareAction::Water), 1u);
+    EXPECT_EQ(replay.getCareCount(CareAction::Fertilize), 0u);
+    std::remove(path.c_str());
+}
+
+TEST(TransactionJournalTest, GroupsRecordsPerSyncAndSurvivesATornTail) {
+    std::string path = ::testing::TempDir() + "nursery_groups.journal";
+    std::remove(path.c_str());
+    Plant plant("Rose", "R001", FlowerCareStrategy::getInstance(), new MatureState());
+    TransactionJournal* journal = TransactionJournal::getInstance();
+
+    // Closed journals keep nothing
+    journal->recordCare(&plant, CareAction::Water);
+    EXPECT_FALSE(journal->commit());
+
+    ASSERT_TRUE(journal->open(path, 4));
+    for (int i = 0; i < 10; i++) {
+        journal->recordCare(&plant, CareAction::Fertilize);
+    }
+    EXPECT_EQ(journal->getSyncCount(), 2u);
+    EXPECT_TRUE(journal->commit());
+    EXPECT_EQ(journal->getSyncCount(), 3u);
+    EXPECT_TRUE(journal->commit());
+    EXPECT_EQ(journal->getSyncCount(), 3u);     // Nothing new to sync
+    journal->close();
+
+    // A crash in the middle of a write leaves part of a record behind
+    {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::app);
+        out.write("torn", 4);
+    }
+    JournalReplay replay;
+    ASSERT_TRUE(replay.replay(path));
+    EXPECT_EQ(replay.getRecordCount(), 10u);
+    EXPECT_TRUE(replay.hasDamagedTail());
+
+    // Reopening cuts the torn record off and carries on numbering
+    ASSERT_TRUE(journal->open(path, 4));
+    journal->recordSale("Ada", 12.5);
+    journal->close();
+    ASSERT_TRUE(replay.replay(path));
+    EXPECT_EQ(replay.getRecordCount(), 11u);
+    EXPECT_FALSE(replay.hasDamagedTail());
+    EXPECT_EQ(replay.getCareCount(CareAction::Fertilize), 10u);
+    EXPECT_DOUBLE_EQ(replay.getSalesTotal(), 12.5);
+
+    // A damaged record ends the replay there
+    {
+        std::fstream file(path.c_str(), std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(static_cast<std::streamoff>(5 * sizeof(JournalRecord) + offsetof(JournalRecord, plantId)));
+        file.write("X", 1);
+    }
+    ASSERT_TRUE(replay.replay(path));
+    EXPECT_EQ(replay.getRecordCount(), 5u);
+    EXPECT_TRUE(replay.hasDamagedTail());
+    EXPECT_DOUBLE_EQ(replay.getSalesTotal(), 0.0);
+    std::remove(path.c_str());
+}
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "include/NurseryMediator.h"
@@ -14,6 +16,10 @@
 #include "include/Plant.h"
 #include "include/FlowerCareStrategy.h"
 #include "include/MatureState.h"
+#include "include/SeedlingState.h"
+#include "include/DeadState.h"
+#include "include/PlantEventStream.h"
+#include "include/DirtyEpoch.h"
 
 // ============ Mediator Pattern Test Fixture ============
 
@@ -36,13 +42,13 @@ protected:
         
         // Create test plants
         testPlant1 = new Plant("Rose", "R001", 
-                              new FlowerCareStrategy(), 
+                              FlowerCareStrategy::getInstance(), 
                               new MatureState());
         testPlant1->setPrice(50.0);
         testPlant1->setReadyForSale(true);
         
         testPlant2 = new Plant("Tulip", "T001", 
-                              new FlowerCareStrategy(), 
+                              FlowerCareStrategy::getInstance(), 
                               new MatureState());
         testPlant2->setPrice(30.0);
         testPlant2->setReadyForSale(true);
@@ -230,7 +236,7 @@ protected:
         coordinator->setGreenhouse(greenhouse);
         
         testPlant = new Plant("Rose", "R001", 
-                             new FlowerCareStrategy(), 
+                             FlowerCareStrategy::getInstance(), 
                              new MatureState());
         testPlant->setPrice(50.0);
         testPlant->setReadyForSale(true);
@@ -297,6 +303,31 @@ TEST_F(CoordinatorTest, CheckPlantRelocation) {
     EXPECT_EQ(salesFloor->getNumberOfPlants(), 1);
 }
 
+TEST_F(CoordinatorTest, LifecycleEventsArePublished) {
+    PlantEventQueue events(16);
+    ASSERT_TRUE(PlantEventStream::getInstance()->subscribe(&events));
+
+    greenhouse->addPlant(testPlant, 0, 0);
+    testPlant->setState(new MatureState());
+    coordinator->checkPlantRelocation();
+
+    RegularCustomer buyer;
+    EXPECT_TRUE(coordinator->transferPlantToCustomer("Rose", &buyer));
+    PlantEventStream::getInstance()->unsubscribe(&events);
+
+    std::vector<PlantEvent> received;
+    ASSERT_EQ(events.drain(received), 3u);
+    EXPECT_EQ(received[0].type, PlantEventType::StateChanged);
+    EXPECT_STREQ(received[0].detail, "Mature");
+    EXPECT_EQ(received[0].plant, testPlant);
+    EXPECT_EQ(received[1].type, PlantEventType::MovedToSalesFloor);
+    EXPECT_EQ(received[1].row, 0);
+    EXPECT_EQ(received[1].col, 0);
+    EXPECT_EQ(received[2].type, PlantEventType::TransferredToCustomer);
+    EXPECT_LT(received[0].sequence, received[1].sequence);
+    EXPECT_LT(received[1].sequence, received[2].sequence);
+}
+
 // ============ Colleague Tests ============
 
 class ColleagueTest : public ::testing::Test {
@@ -346,12 +377,12 @@ protected:
         salesFloor = new SalesFloor(mediator, 3, 3);
         
         plant1 = new Plant("Rose", "R001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant1->setPrice(50.0);
         
         plant2 = new Plant("Tulip", "T001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant2->setPrice(30.0);
     }
@@ -438,7 +469,7 @@ TEST_F(SalesFloorTest, IsFull) {
     for (int i = 0; i < 3; i++) {
         for (int j = 0; j < 3; j++) {
             Plant* p = new Plant("Plant", "P" + std::to_string(i*3+j), 
-                               new FlowerCareStrategy(), 
+                               FlowerCareStrategy::getInstance(), 
                                new MatureState());
             salesFloor->addPlantToDisplay(p, i, j);
         }
@@ -474,6 +505,55 @@ TEST_F(SalesFloorTest, GetPlantsInColumn) {
     EXPECT_EQ(colPlants.size(), 2);
 }
 
+TEST_F(SalesFloorTest, GridViewsSkipEmptyCellsInRowMajorOrder) {
+    salesFloor->addPlantToDisplay(plant2, 2, 1);
+    salesFloor->addPlantToDisplay(plant1, 0, 2);
+
+    std::vector<Plant*> seen;
+    for (Plant* plant : salesFloor->getGrid().getAll()) {
+        seen.push_back(plant);
+    }
+
+    ASSERT_EQ(seen.size(), 2);
+    EXPECT_EQ(seen[0], plant1);
+    EXPECT_EQ(seen[1], plant2);
+    EXPECT_EQ(salesFloor->getGrid().getColumn(1).countPlants(), 1);
+    EXPECT_TRUE(salesFloor->getGrid().getRow(1).empty());
+}
+
+TEST_F(SalesFloorTest, GridViewReflectsRemovals) {
+    salesFloor->addPlantToDisplay(plant1, 0, 0);
+    salesFloor->addPlantToDisplay(plant2, 1, 1);
+
+    PlantGridView all = salesFloor->getGrid().getAll();
+    salesFloor->removePlantFromDisplay(plant1);
+
+    EXPECT_EQ(all.countPlants(), 1);
+    EXPECT_EQ(*all.begin(), plant2);
+
+    delete plant1;
+}
+
+TEST_F(SalesFloorTest, ForEachPlantInRegionReportsPositions) {
+    salesFloor->addPlantToDisplay(plant1, 0, 0);
+    salesFloor->addPlantToDisplay(plant2, 2, 2);
+
+    std::vector<int> positions;
+    salesFloor->forEachPlant(GridRegion{1, 1, 5, 5}, [&positions](Plant*, int row, int col) {
+        positions.push_back(row * 10 + col);
+    });
+
+    ASSERT_EQ(positions.size(), 1);
+    EXPECT_EQ(positions[0], 22);
+
+    GridRegion clipped = salesFloor->getGrid().clip(GridRegion{-1, 1, 2, 9});
+    EXPECT_EQ(clipped.row, 0);
+    EXPECT_EQ(clipped.col, 1);
+    EXPECT_EQ(clipped.rowCount, 1);
+    EXPECT_EQ(clipped.colCount, 2);
+    EXPECT_TRUE(salesFloor->getGrid().getRegion(GridRegion{5, 5, 2, 2}).empty());
+}
+
 TEST_F(SalesFloorTest, AddCustomer) {
     RegularCustomer* customer = new RegularCustomer();
     
@@ -508,12 +588,12 @@ protected:
         greenhouse = new Greenhouse(mediator, 2, 2);
         
         plant1 = new Plant("Rose", "R001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant1->setReadyForSale(false);
         
         plant2 = new Plant("Tulip", "T001", 
-                          new FlowerCareStrategy(), 
+                          FlowerCareStrategy::getInstance(), 
                           new MatureState());
         plant2->setReadyForSale(false);
     }
@@ -616,7 +696,7 @@ TEST_F(GreenhouseTest, IsFull) {
     for (int i = 0; i < 2; i++) {
         for (int j = 0; j < 2; j++) {
             Plant* p = new Plant("Plant", "P" + std::to_string(i*2+j), 
-                               new FlowerCareStrategy(), 
+                               FlowerCareStrategy::getInstance(), 
                                new MatureState());
             greenhouse->addPlant(p, i, j);
         }
@@ -649,4 +729,307 @@ TEST_F(GreenhouseTest, GetPlantsInColumn) {
     std::vector<Plant*> colPlants = greenhouse->getPlantsInColumn(0);
     
     EXPECT_EQ(colPlants.size(), 2);
-}
\ No newline at end of file
+}
+
+TEST_F(GreenhouseTest, StateCountsFollowTransitions) {
+    greenhouse->addPlant(plant1, 0, 0);
+    greenhouse->addPlant(plant2, 0, 1);
+
+    EXPECT_EQ(greenhouse->getStateCount("Mature"), 2);
+    EXPECT_EQ(greenhouse->getStateCount("Dead"), 0);
+
+    plant1->setState(new DeadState());
+
+    EXPECT_EQ(greenhouse->getStateCount("Mature"), 1);
+    EXPECT_EQ(greenhouse->getStateCount("Dead"), 1);
+    ASSERT_EQ(greenhouse->getPlantsInState("Dead").size(), 1);
+    EXPECT_EQ(greenhouse->getPlantsInState("Dead")[0], plant1);
+}
+
+TEST_F(GreenhouseTest, ReadyPlantsFollowReadinessInGridOrder) {
+    greenhouse->addPlant(plant1, 1, 1);
+    greenhouse->addPlant(plant2, 0, 1);
+    EXPECT_EQ(greenhouse->getReadyCount(), 0);
+
+    plant1->setReadyForSale(true);
+    plant2->setReadyForSale(true);
+
+    std::vector<Plant*> ready = greenhouse->getReadyPlants();
+    ASSERT_EQ(ready.size(), 2);
+    EXPECT_EQ(ready[0], plant2);
+    EXPECT_EQ(ready[1], plant1);
+
+    plant2->setReadyForSale(false);
+    EXPECT_EQ(greenhouse->getReadyCount(), 1);
+}
+
+TEST_F(GreenhouseTest, SpeciesCountsTrackAddAndRemove) {
+    Plant* secondRose = new Plant("Rose", "R002", FlowerCareStrategy::getInstance(), new SeedlingState());
+    greenhouse->addPlant(plant1, 0, 0);
+    greenhouse->addPlant(plant2, 0, 1);
+    greenhouse->addPlant(secondRose, 1, 0);
+
+    EXPECT_EQ(greenhouse->getSpeciesCount("Rose"), 2);
+    EXPECT_EQ(greenhouse->getSpeciesCount("Tulip"), 1);
+    EXPECT_EQ(greenhouse->getSpeciesCount("Cactus"), 0);
+
+    greenhouse->removePlant(plant1);
+    EXPECT_EQ(greenhouse->getSpeciesCount("Rose"), 1);
+    delete plant1;
+}
+
+TEST_F(GreenhouseTest, RemovedPlantNoLongerUpdatesIndexes) {
+    greenhouse->addPlant(plant1, 0, 0);
+    EXPECT_EQ(plant1->getStateListener(), greenhouse);
+
+    greenhouse->removePlant(plant1);
+    EXPECT_EQ(plant1->getStateListener(), nullptr);
+
+    plant1->setState(new DeadState());
+    EXPECT_EQ(greenhouse->getStateCount("Dead"), 0);
+    EXPECT_EQ(greenhouse->getStateCount("Mature"), 0);
+    delete plant1;
+}
+
+TEST_F(GreenhouseTest, RemoveDeadPlantsSweepsOnlyDeadPlants) {
+    Plant* seedling = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new SeedlingState());
+    greenhouse->addPlant(plant1, 0, 0);
+    greenhouse->addPlant(plant2, 0, 1);
+    greenhouse->addPlant(seedling, 1, 0);
+
+    plant1->setState(new DeadState());
+    seedling->setState(new DeadState());
+
+    EXPECT_EQ(greenhouse->removeDeadPlants(), 2);
+    EXPECT_EQ(greenhouse->getNumberOfPlants(), 1);
+    EXPECT_TRUE(greenhouse->isPositionEmpty(0, 0));
+    EXPECT_TRUE(greenhouse->isPositionEmpty(1, 0));
+    EXPECT_EQ(greenhouse->getPlantAt(0, 1), plant2);
+    EXPECT_EQ(greenhouse->getStateCount("Dead"), 0);
+    EXPECT_EQ(greenhouse->removeDeadPlants(), 0);
+}
+
+TEST_F(GreenhouseTest, FastForwardKeepsIndexesCurrent) {
+    Plant* seedling = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new SeedlingState());
+    greenhouse->addPlant(seedling, 0, 0);
+    EXPECT_EQ(greenhouse->getStateCount("Seedling"), 1);
+
+    // Without care the seedling never reaches 50 health and dies
+    seedling->advanceDays(30);
+
+    EXPECT_EQ(seedling->getState()->getStateName(), "Dead");
+    EXPECT_EQ(greenhouse->getStateCount("Seedling"), 0);
+    EXPECT_EQ(greenhouse->getStateCount("Dead"), 1);
+    EXPECT_EQ(greenhouse->removeDeadPlants(), 1);
+}
+
+TEST_F(GreenhouseTest, ForEachPlantVisitsWholeGrid) {
+    greenhouse->addPlant(plant1, 1, 0);
+    greenhouse->addPlant(plant2, 0, 1);
+
+    int visited = 0;
+    greenhouse->forEachPlant([&](Plant* plant, int row, int col) {
+        EXPECT_EQ(greenhouse->getPlantAt(row, col), plant);
+        visited++;
+    });
+
+    EXPECT_EQ(visited, 2);
+    EXPECT_EQ(greenhouse->getGrid().getCapacity(), 4);
+    EXPECT_EQ(greenhouse->getAllPlants()[0], plant2);
+}
+
+TEST_F(GreenhouseTest, SparseGreenhouseKeepsPositionSemantics) {
+    Greenhouse* huge = new Greenhouse(mediator, 500, 800, GridStorage::Sparse);
+
+    EXPECT_EQ(huge->getCapacity(), 400000);
+    EXPECT_TRUE(huge->isPositionEmpty(499, 799));
+    EXPECT_FALSE(huge->isPositionEmpty(500, 0));
+
+    EXPECT_TRUE(huge->addPlant(plant1, 499, 799));
+    EXPECT_TRUE(huge->addPlant(plant2, 3, 7));
+    EXPECT_FALSE(huge->addPlant(plant2, 3, 7));
+
+    EXPECT_EQ(huge->getPlantAt(499, 799), plant1);
+    EXPECT_EQ(huge->getPlantAt(3, 8), nullptr);
+    EXPECT_FALSE(huge->isPositionEmpty(3, 7));
+    EXPECT_EQ(huge->findPlant("Rose"), plant1);
+
+    std::vector<Plant*> all = huge->getAllPlants();
+    ASSERT_EQ(all.size(), 2);
+    EXPECT_EQ(all[0], plant2);
+    EXPECT_EQ(all[1], plant1);
+    EXPECT_EQ(huge->getPlantsInColumn(799).size(), 1);
+    EXPECT_EQ(huge->getGrid().getRegion(GridRegion{0, 0, 10, 10}).countPlants(), 1);
+
+    EXPECT_EQ(huge->removePlantAt(3, 7), plant2);
+    EXPECT_TRUE(huge->isPositionEmpty(3, 7));
+    EXPECT_EQ(huge->getGrid().getPlantCount(), 1);
+
+    delete plant2;
+    delete huge;
+}
+
+TEST_F(GreenhouseTest, ChangedCellsAreForgottenOnceTheirEpochCloses) {
+    GridStorage storages[] = {GridStorage::Dense, GridStorage::Sparse};
+    for (GridStorage storage : storages) {
+        PlantGrid grid(50, 40, storage);
+        uint32_t since = DirtyEpoch::current();
+        grid.setPlantAt(2, 3, plant1);
+        grid.setPlantAt(2, 3, plant2);
+        grid.setPlantAt(49, 39, plant1);
+        grid.setPlantAt(49, 39, nullptr);
+
+        int changed = 0;
+        int emptied = 0;
+        grid.forEachCellChangedSince(since, [&](Plant* plant, int, int) {
+            changed++;
+            emptied += plant == nullptr;
+        });
+        EXPECT_EQ(changed, 2);
+        EXPECT_EQ(emptied, 1);
+        EXPECT_EQ(grid.getCellEpoch(2, 3), since);
+
+        since = DirtyEpoch::advance();
+        grid.setPlantAt(0, 0, plant1);
+        changed = 0;
+        grid.forEachCellChangedSince(since, [&](Plant*, int row, int col) {
+            changed++;
+            EXPECT_EQ(row, 0);
+            EXPECT_EQ(col, 0);
+        });
+        EXPECT_EQ(changed, 1);
+        EXPECT_LT(grid.getCellEpoch(2, 3), since);
+        EXPECT_EQ(grid.getPlantAt(2, 3), plant2);
+    }
+}
+
+TEST_F(GreenhouseTest, AddPlantsPlacesWhatFitsAndReturnsTheRest) {
+    Plant* outside = new Plant("Rose", "R002", FlowerCareStrategy::getInstance(), new SeedlingState());
+    Plant* clash = new Plant("Rose", "R003", FlowerCareStrategy::getInstance(), new SeedlingState());
+    PlantPlacement placements[] = {
+        {plant1, 0, 0, false}, {outside, 2, 0, false}, {clash, 0, 0, false}, {plant2, 1, 1, false}
+    };
+
+    EXPECT_EQ(greenhouse->addPlants(placements, 4), 2u);
+    EXPECT_TRUE(placements[0].placed);
+    EXPECT_FALSE(placements[1].placed);
+    EXPECT_FALSE(placements[2].placed);
+    EXPECT_TRUE(placements[3].placed);
+    EXPECT_EQ(greenhouse->getNumberOfPlants(), 2);
+    EXPECT_EQ(greenhouse->getPlantAt(1, 1), plant2);
+    EXPECT_EQ(greenhouse->getStateCount("Mature"), 2);
+
+    delete outside;
+    delete clash;
+}
+
+// ============ PlantEventQueue Tests ============
+
+TEST(PlantEventQueueTest, DropsWhenFullAndRoundsCapacity) {
+    PlantEventQueue queue(3);
+    EXPECT_EQ(queue.getCapacity(), 4u);
+
+    PlantEvent event = PlantEvent();
+    for (int i = 0; i < 6; i++) {
+        event.sequence = static_cast<unsigned long long>(i);
+        EXPECT_EQ(queue.tryPush(event), i < 4);
+    }
+    EXPECT_EQ(queue.getDroppedCount(), 2u);
+
+    PlantEvent out;
+    ASSERT_TRUE(queue.tryPop(out));
+    EXPECT_EQ(out.sequence, 0u);
+    EXPECT_TRUE(queue.tryPush(event));  // A freed cell can be reused on the next lap
+}
+
+TEST(PlantEventQueueTest, ConcurrentProducersKeepTheirOrder) {
+    const int producerCount = 4;
+    const int eventsPerProducer = 20000;
+    PlantEventQueue queue(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < producerCount; p++) {
+        producers.emplace_back([&queue, p, eventsPerProducer]() {
+            PlantEvent event = PlantEvent();
+            event.row = p;
+            for (int i = 0; i < eventsPerProducer; i++) {
+                event.col = i;
+                while (!queue.tryPush(event)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextExpected(producerCount, 0);
+    int received = 0;
+    bool ordered = true;
+    PlantEvent event;
+    while (received < producerCount * eventsPerProducer) {
+        if (!queue.tryPop(event)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ordered = ordered && event.col == nextExpected[event.row];
+        nextExpected[event.row] = event.col + 1;
+        received++;
+    }
+    for (std::thread& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_TRUE(ordered);
+    EXPECT_FALSE(queue.tryPop(event));
+}
+
+TEST(PlantEventStreamTest, QueuesCanBeDestroyedRightAfterUnsubscribing) {
+    PlantEventStream* stream = PlantEventStream::getInstance();
+    std::atomic<bool> done(false);
+    std::thread publisher([stream, &done]() {
+        while (!done.load()) {
+            stream->publish(PlantEventType::StateChanged, nullptr, "Mature");
+        }
+    });
+
+    for (int i = 0; i < 200; i++) {
+        PlantEventQueue* queue = new PlantEventQueue(16);
+        ASSERT_TRUE(stream->subscribe(queue));
+        std::this_thread::yield();
+        stream->unsubscribe(queue);
+        delete queue;
+    }
+    done.store(true);
+    publisher.join();
+
+    EXPECT_FALSE(stream->hasSubscribers());
+}
+
+TEST(PlantEventStreamTest, UnsubscribeOnlyWaitsForItsOwnQueue) {
+    PlantEventStream* stream = PlantEventStream::getInstance();
+    PlantEventQueue busy(16);
+    ASSERT_TRUE(stream->subscribe(&busy));
+    std::atomic<bool> done(false);
+    std::vector<std::thread> publishers;
+    for (int i = 0; i < 3; i++) {
+        publishers.emplace_back([stream, &done]() {
+            while (!done.load()) {
+                stream->publish(PlantEventType::StateChanged, nullptr, "Mature");
+            }
+        });
+    }
+
+    // Publishers never stop delivering to the busy queue, so waiting for all publishing to stop could starve
+    for (int i = 0; i < 200; i++) {
+        PlantEventQueue* queue = new PlantEventQueue(16);
+        EXPECT_TRUE(stream->subscribe(queue));
+        stream->unsubscribe(queue);
+        delete queue;
+    }
+    done.store(true);
+    for (std::thread& publisher : publishers) {
+        publisher.join();
+    }
+    stream->unsubscribe(&busy);
+
+    EXPECT_FALSE(stream->hasSubscribers());
+}
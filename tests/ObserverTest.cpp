@@ -5,6 +5,8 @@
 #include "include/FertilizeObserver.h"
 #include "include/SunlightObserver.h"
 #include "include/CareScheduler.h"
+#include "include/ThresholdMonitor.h"
+#include "include/NotificationBatch.h"
 #include "include/FlowerCareStrategy.h"
 #include "include/SucculentCareStrategy.h"
 #include "include/SeedlingState.h"
@@ -31,6 +33,21 @@ public:
     }
 };
 
+// ============ Batch Observer Helper Class ============
+
+class BatchRecordingObserver : public TestObserver {
+public:
+    int batchCount = 0;
+    std::vector<Plant*> batchedPlants;
+    int waterSeen = -1;
+
+    virtual void updateBatch(Plant* const* plants, size_t count) override {
+        batchCount++;
+        batchedPlants.assign(plants, plants + count);
+        waterSeen = count > 0 ? plants[0]->getWaterLevel() : -1;
+    }
+};
+
 // ============ Test Fixture for Observer Tests ============
 
 class ObserverTest : public ::testing::Test {
@@ -43,7 +60,7 @@ protected:
     void SetUp() override {
         scheduler = new CareScheduler();
         
-        testPlant = new Plant("Rose", "R001", new FlowerCareStrategy(), new MatureState());
+        testPlant = new Plant("Rose", "R001", FlowerCareStrategy::getInstance(), new MatureState());
         testPlant->setWaterLevel(50);
         testPlant->setNutrientLevel(50);
         testPlant->setSunlightExposure(50);
@@ -390,7 +407,7 @@ TEST_F(ObserverTest, ObserversTriggeredDuringUpdateCondition) {
 TEST_F(ObserverTest, ObserversWorkWithStateChanges) {
     // Test observers work when plant changes states
     Plant* maturePlant = new Plant("Mature Rose", "M001", 
-                                   new FlowerCareStrategy(), 
+                                   FlowerCareStrategy::getInstance(), 
                                    new GrowingState());
     
     WaterObserver* waterObs = new WaterObserver(scheduler, maturePlant);
@@ -414,7 +431,7 @@ TEST_F(ObserverTest, ObserversWorkWithStateChanges) {
 
 TEST_F(ObserverTest, ObserversWhenPlantDies) {
     Plant* dyingPlant = new Plant("Dying Rose", "D001",
-                                  new FlowerCareStrategy(),
+                                  FlowerCareStrategy::getInstance(),
                                   new MatureState());
     
     WaterObserver* waterObs = new WaterObserver(scheduler, dyingPlant);
@@ -448,7 +465,7 @@ TEST_F(ObserverTest, ObserverWithNullPlant) {
 }
 
 TEST_F(ObserverTest, MultipleObserversSameScheduler) {
-    Plant* plant2 = new Plant("Daisy", "D001", new FlowerCareStrategy(), new MatureState());
+    Plant* plant2 = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new MatureState());
     
     WaterObserver* waterObs1 = new WaterObserver(scheduler, testPlant);
     WaterObserver* waterObs2 = new WaterObserver(scheduler, plant2);
@@ -502,7 +519,7 @@ TEST_F(ObserverTest, ObserverChainReaction) {
 
 TEST_F(ObserverTest, ObserversWithDifferentStrategies) {
     Plant* succulent = new Plant("Cactus", "C001", 
-                                new SucculentCareStrategy(), 
+                                SucculentCareStrategy::getInstance(), 
                                 new MatureState());
     
     WaterObserver* waterObs1 = new WaterObserver(scheduler, testPlant);
@@ -563,4 +580,272 @@ TEST_F(ObserverTest, ObserversCreateCorrectCommandTypes) {
     delete scheduler1;
     delete scheduler2;
     delete scheduler3;
-}
\ No newline at end of file
+}
+
+// ============ Inline Observer Storage ============
+
+class OrderRecordingObserver : public PlantObserver {
+public:
+    OrderRecordingObserver(int id, std::vector<int>* log) : id_(id), log_(log) {}
+
+    virtual void update(Plant* plant) override {
+        (void)plant;
+        log_->push_back(id_);
+    }
+
+private:
+    int id_;
+    std::vector<int>* log_;
+};
+
+TEST_F(ObserverTest, ObserversBeyondInlineCapacityAreNotified) {
+    std::vector<int> log;
+    std::vector<OrderRecordingObserver*> recorders;
+    for (int i = 0; i < 6; i++) {
+        recorders.push_back(new OrderRecordingObserver(i, &log));
+        testPlant->attach(recorders.back());
+    }
+    EXPECT_EQ(testPlant->getObserverCount(), 6);
+
+    testPlant->notify();
+    EXPECT_EQ(log, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    for (OrderRecordingObserver* recorder : recorders) {
+        delete recorder;
+    }
+}
+
+TEST_F(ObserverTest, DetachKeepsAttachOrderAcrossSpill) {
+    std::vector<int> log;
+    std::vector<OrderRecordingObserver*> recorders;
+    for (int i = 0; i < 5; i++) {
+        recorders.push_back(new OrderRecordingObserver(i, &log));
+        testPlant->attach(recorders.back());
+    }
+
+    testPlant->detach(recorders[1]);
+    testPlant->detach(recorders[4]);
+    testPlant->attach(recorders[0]); // duplicate, ignored
+    testPlant->notify();
+
+    EXPECT_EQ(log, (std::vector<int>{0, 2, 3}));
+    EXPECT_EQ(testPlant->getObserverCount(), 3);
+
+    for (OrderRecordingObserver* recorder : recorders) {
+        delete recorder;
+    }
+}
+
+TEST_F(ObserverTest, StandardObserversAreSharedBetweenPlants) {
+    Plant* plant2 = new Plant("Daisy", "D002", FlowerCareStrategy::getInstance(), new MatureState());
+
+    scheduler->attachStandardObservers(testPlant);
+    scheduler->attachStandardObservers(plant2);
+    scheduler->attachStandardObservers(plant2); // attaching twice has no effect
+
+    EXPECT_EQ(testPlant->getObserverCount(), 3);
+    EXPECT_EQ(plant2->getObserverCount(), 3);
+
+    testPlant->setWaterLevel(20);
+    plant2->setNutrientLevel(20);
+    testPlant->notify();
+    plant2->notify();
+
+    int commandCount = 0;
+    while (!scheduler->empty()) {
+        scheduler->runNext();
+        commandCount++;
+    }
+    EXPECT_EQ(commandCount, 2);
+    EXPECT_EQ(testPlant->getWaterLevel(), 70);
+    EXPECT_EQ(plant2->getNutrientLevel(), 40);
+
+    delete plant2;
+}
+
+TEST_F(ObserverTest, OwnedObserverDeletedWithPlant) {
+    Plant* plant2 = new Plant("Daisy", "D003", FlowerCareStrategy::getInstance(), new MatureState());
+    plant2->addOwnedObserver(new WaterObserver(scheduler, plant2));
+    EXPECT_EQ(plant2->getObserverCount(), 1);
+
+    plant2->setWaterLevel(10);
+    plant2->notify();
+    EXPECT_FALSE(scheduler->empty());
+    scheduler->runAll();
+
+    // Plant deletes the owned observer; nothing should leak or crash
+    EXPECT_NO_THROW(delete plant2);
+}
+
+// ============ Threshold Monitor (batch, edge-triggered) ============
+
+static int drainScheduler(CareScheduler* scheduler) {
+    int commandCount = 0;
+    while (!scheduler->empty()) {
+        scheduler->runNext();
+        commandCount++;
+    }
+    return commandCount;
+}
+
+TEST_F(ObserverTest, ThresholdMonitorFiresOnlyOnEdge) {
+    ThresholdMonitor monitor(scheduler);
+    monitor.addStandardThresholds();
+    std::vector<Plant*> plants = {testPlant};
+
+    testPlant->setWaterLevel(20);
+    EXPECT_EQ(monitor.scan(plants), 1);
+    EXPECT_EQ(monitor.scan(plants), 0); // still low, no repeat command
+    EXPECT_EQ(monitor.scan(plants), 0);
+    EXPECT_EQ(drainScheduler(scheduler), 1);
+    EXPECT_EQ(testPlant->getWaterLevel(), 70);
+
+    // Recovered above the threshold, then dropping again is a new edge
+    EXPECT_EQ(monitor.scan(plants), 0);
+    testPlant->setWaterLevel(10);
+    EXPECT_EQ(monitor.scan(plants), 1);
+    drainScheduler(scheduler);
+}
+
+TEST_F(ObserverTest, ThresholdMonitorMatchesStandardObserverLevels) {
+    ThresholdMonitor monitor(scheduler);
+    monitor.addStandardThresholds();
+    std::vector<Plant*> plants = {testPlant};
+
+    testPlant->setWaterLevel(30);       // exactly at threshold
+    testPlant->setNutrientLevel(29);    // below
+    testPlant->setSunlightExposure(39); // below
+    EXPECT_EQ(monitor.scan(plants), 2);
+    EXPECT_EQ(testPlant->getThresholdMask(), 0x6);
+
+    drainScheduler(scheduler);
+    EXPECT_EQ(testPlant->getNutrientLevel(), 49);
+    EXPECT_EQ(testPlant->getSunlightExposure(), 70);
+}
+
+TEST_F(ObserverTest, ThresholdMonitorScansLargeBatch) {
+    ThresholdMonitor monitor(scheduler);
+    monitor.addThreshold(PlantVital::Water, ThresholdComparator::AtOrBelow, 30, CareAction::Water);
+
+    // Odd count exercises both the SIMD body and the scalar tail
+    std::vector<Plant*> plants;
+    for (int i = 0; i < 11; i++) {
+        Plant* plant = new Plant("P", "BATCH", FlowerCareStrategy::getInstance(), new MatureState());
+        plant->setWaterLevel(i * 5); // 0, 5, ..., 50
+        plants.push_back(plant);
+    }
+    plants.push_back(nullptr);
+
+    EXPECT_EQ(monitor.scan(plants), 7); // 0..30 inclusive
+    for (int i = 0; i < 11; i++) {
+        EXPECT_EQ(plants[i]->getThresholdMask(), i <= 6 ? 1 : 0) << "plant " << i;
+    }
+    EXPECT_EQ(monitor.scan(plants), 0);
+    EXPECT_EQ(drainScheduler(scheduler), 7);
+
+    for (Plant* plant : plants) {
+        delete plant;
+    }
+}
+
+TEST_F(ObserverTest, ThresholdMonitorAboveComparators) {
+    ThresholdMonitor monitor(scheduler);
+    monitor.addThreshold(PlantVital::Health, ThresholdComparator::Above, 60, CareAction::Water);
+    monitor.addThreshold(PlantVital::Sunlight, ThresholdComparator::AtOrAbove, 50, CareAction::AdjustSunlight);
+    std::vector<Plant*> plants = {testPlant};
+
+    testPlant->setSunlightExposure(50);
+    testPlant->updateHealth(); // (50 + 50 + 50) / 3 = 50
+    EXPECT_EQ(monitor.scan(plants), 1);
+    EXPECT_EQ(testPlant->getThresholdMask(), 0x2);
+    drainScheduler(scheduler);
+}
+
+TEST_F(ObserverTest, ThresholdMonitorRuleLimit) {
+    ThresholdMonitor monitor(scheduler);
+    for (int i = 0; i < ThresholdMonitor::MAX_RULES; i++) {
+        EXPECT_EQ(monitor.addThreshold(PlantVital::Water, ThresholdComparator::Below, i, CareAction::Water), i);
+    }
+    EXPECT_EQ(monitor.addThreshold(PlantVital::Water, ThresholdComparator::Below, 99, CareAction::Water), -1);
+    EXPECT_EQ(static_cast<int>(monitor.getRules().size()), ThresholdMonitor::MAX_RULES);
+}
+
+// ============ Coalesced Notification Tests ============
+
+TEST_F(ObserverTest, NotificationBatchCoalescesPerPlant) {
+    BatchRecordingObserver batched;
+    Plant other("Aloe", "A001", SucculentCareStrategy::getInstance(), new MatureState());
+    testPlant->attach(&batched);
+    testPlant->attach(testObserver1);
+    other.attach(&batched);
+
+    {
+        NotificationBatch batch;
+        testPlant->dailyUpdate();
+        testPlant->updateCondition();
+        other.notify();
+        testPlant->notify();
+
+        EXPECT_EQ(batch.getPendingCount(), 2);
+        EXPECT_EQ(batched.batchCount, 0);
+        EXPECT_EQ(testObserver1->updateCount, 0);
+    }
+
+    // One call per observer, one entry per plant, after the final change
+    EXPECT_EQ(batched.batchCount, 1);
+    std::vector<Plant*> expected = {testPlant, &other};
+    EXPECT_EQ(batched.batchedPlants, expected);
+    EXPECT_EQ(batched.waterSeen, testPlant->getWaterLevel());
+    EXPECT_EQ(testObserver1->updateCount, 1);
+    EXPECT_EQ(batched.updateCount, 0);
+
+    // Outside a batch, notifications are immediate again
+    testPlant->notify();
+    EXPECT_EQ(testObserver1->updateCount, 2);
+    EXPECT_EQ(NotificationBatch::getActive(), nullptr);
+
+    testPlant->detach(&batched);
+    testPlant->detach(testObserver1);
+    other.detach(&batched);
+}
+
+TEST_F(ObserverTest, NotificationBatchStandardObserversAndDeletedPlants) {
+    scheduler->attachStandardObservers(testPlant);
+    Plant* doomed = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new MatureState());
+    doomed->attach(testObserver1);
+
+    {
+        NotificationBatch batch;
+        testPlant->setWaterLevel(10);
+        testPlant->notify();
+        testPlant->notify();
+        doomed->notify();
+        delete doomed;
+        EXPECT_EQ(batch.getPendingCount(), 1);
+    }
+
+    EXPECT_EQ(testObserver1->updateCount, 0);
+    EXPECT_EQ(drainScheduler(scheduler), 1);  // One watering, not two
+}
+
+TEST_F(ObserverTest, NotificationBatchForgetsPlantsPendingInAnOuterBatch) {
+    Plant* doomed = new Plant("Daisy", "D001", FlowerCareStrategy::getInstance(), new MatureState());
+    doomed->attach(testObserver1);
+    testPlant->attach(testObserver1);
+
+    {
+        NotificationBatch outer;
+        testPlant->notify();
+        doomed->notify();
+        {
+            NotificationBatch inner;
+            testPlant->notify();
+            delete doomed;
+            EXPECT_EQ(inner.getPendingCount(), 0);
+        }
+        EXPECT_EQ(outer.getPendingCount(), 1);
+    }
+
+    EXPECT_EQ(testObserver1->updateCount, 1);
+    testPlant->detach(testObserver1);
+}
@@ -2,6 +2,17 @@
 #include <gtest/gtest.h>
 #include "include/FinalOrder.h"
 #include "include/ConcreteOrder.h"
+#include "include/Leaf.h"
+#include "include/OrderHistory.h"
+#include "include/RoseFactory.h"
+#include "include/DaisyFactory.h"
+#include "include/CactusFactory.h"
+#include "include/MonsteraFactory.h"
+#include "include/RibbonDecorator.h"
+#include "include/GiftWrapDecorator.h"
+#include "include/DecorativePotDecorator.h"
+#include <cstdio>
+#include <fstream>
 
 
 class PrototypeTest : public ::testing::Test {
@@ -63,3 +74,168 @@ TEST_F(PrototypeTest, MultipleClonesRemainConsistent) {
     delete clone1;
     delete clone2;
 }
+
+
+// ============ Order History Tests ============
+
+namespace {
+
+Plant* pricedPlant(const PlantFactory& factory, double price) {
+    Plant* plant = factory.buildPlant(nullptr);
+    plant->setPrice(price);
+    return plant;
+}
+
+/**
+ * @brief A bundle of a decorated Rose and a Daisy, and a gift-wrapped Cactus on its own.
+ */
+FinalOrder* buildBundleOrder() {
+    RoseFactory roseFactory;
+    DaisyFactory daisyFactory;
+    CactusFactory cactusFactory;
+
+    FinalOrder* order = new FinalOrder("Regular Customer");
+    ConcreteOrder* bundle = new ConcreteOrder("Flower Bundle");
+    bundle->add(new Leaf(new DecorativePotDecorator(new RibbonDecorator(pricedPlant(roseFactory, 25.0)), "blue")));
+    bundle->add(new Leaf(pricedPlant(daisyFactory, 18.0)));
+    order->addOrder(bundle);
+    order->addOrder(new Leaf(new GiftWrapDecorator(pricedPlant(cactusFactory, 30.0))));
+    return order;
+}
+
+} // namespace
+
+TEST(OrderHistoryTest, ListsSearchesAndRebuildsRecordedOrders) {
+    std::string path = ::testing::TempDir() + "nursery_order_history.bin";
+    std::remove(path.c_str());
+
+    MonsteraFactory monsteraFactory;
+    FinalOrder* bundleOrder = buildBundleOrder();
+    FinalOrder* monsteraOrder = new FinalOrder("Regular Customer");
+    monsteraOrder->addOrder(new Leaf(pricedPlant(monsteraFactory, 35.0)));
+    FinalOrder* corporateOrder = new FinalOrder("Corporate Client");
+    corporateOrder->addOrder(new Leaf(pricedPlant(monsteraFactory, 40.0)));
+
+    {
+        OrderHistory history;
+        ASSERT_TRUE(history.open(path));
+        EXPECT_TRUE(history.append(bundleOrder, "REG-001", 3));
+        EXPECT_TRUE(history.append(monsteraOrder, "REG-001", 5));
+        EXPECT_TRUE(history.append(corporateOrder, "CORP-001", 5));
+    }
+
+    OrderHistory history;
+    ASSERT_TRUE(history.open(path));
+    EXPECT_EQ(history.getOrderCount(), 3u);
+    EXPECT_EQ(history.getOrderCount("REG-001"), 2u);
+    EXPECT_EQ(history.getOrderCount("WALK-001"), 0u);
+    EXPECT_FALSE(history.getLatestOrder("WALK-001").isValid());
+
+    std::vector<OrderHistory::OrderView> orders = history.getOrders("REG-001");
+    ASSERT_EQ(orders.size(), 2u);
+    EXPECT_EQ(orders[0].getDay(), 3);
+    EXPECT_EQ(orders[0].getSequence(), 0u);
+    EXPECT_EQ(orders[0].getCustomerName(), "Regular Customer");
+    EXPECT_EQ(orders[0].getNodeCount(), 4u);
+    EXPECT_EQ(orders[0].getPlantCount(), 3u);
+    EXPECT_DOUBLE_EQ(orders[0].getTotal(), bundleOrder->calculateTotalPrice());
+    EXPECT_EQ(history.getLatestOrder("REG-001").getDay(), 5);
+    EXPECT_DOUBLE_EQ(history.getTotalSpent("REG-001"),
+                     bundleOrder->calculateTotalPrice() + monsteraOrder->calculateTotalPrice());
+
+    std::vector<OrderHistory::OrderView> withRose = history.findOrders("REG-001", "Rose");
+    ASSERT_EQ(withRose.size(), 1u);
+    EXPECT_EQ(withRose[0].getSequence(), 0u);
+    EXPECT_EQ(history.findOrders("REG-001", "Monstera").size(), 1u);
+    EXPECT_EQ(history.findOrders("CORP-001", "Rose").size(), 0u);
+
+    // The bundle node carries its subtree's price and the Rose its decorations
+    const HistoryNode& bundle = orders[0].getNode(0);
+    EXPECT_EQ(bundle.isGroup, 1);
+    EXPECT_EQ(bundle.subtreeEnd, 3u);
+    EXPECT_EQ(orders[0].getString(bundle.name), "Flower Bundle");
+    const HistoryNode& rose = orders[0].getNode(1);
+    EXPECT_EQ(rose.parent, 0u);
+    EXPECT_DOUBLE_EQ(rose.basePrice, 25.0);
+    ASSERT_EQ(rose.decorationCount, 2);
+    EXPECT_EQ(rose.decorations[0], OrderHistory::Ribbon);
+    EXPECT_EQ(rose.decorations[1], OrderHistory::DecorativePot);
+    EXPECT_EQ(orders[0].getString(rose.potColour), "blue");
+    EXPECT_EQ(orders[0].getNode(3).parent, OrderHistory::NO_PARENT);
+
+    FinalOrder* reorder = history.materialize(orders[0]);
+    ASSERT_NE(reorder, nullptr);
+    EXPECT_EQ(reorder->getCustomerName(), "Regular Customer");
+    EXPECT_DOUBLE_EQ(reorder->calculateTotalPrice(), bundleOrder->calculateTotalPrice());
+    EXPECT_EQ(reorder->getFormattedReceipt(), bundleOrder->getFormattedReceipt());
+    ASSERT_EQ(reorder->getOrders().size(), 2u);
+    Leaf* cactus = dynamic_cast<Leaf*>(reorder->getOrders()[1]);
+    ASSERT_NE(cactus, nullptr);
+    EXPECT_NE(dynamic_cast<GiftWrapDecorator*>(cactus->getPlant()), nullptr);
+
+    Order* bundleOnly = history.materializeItem(orders[0], 0);
+    ASSERT_NE(bundleOnly, nullptr);
+    EXPECT_EQ(bundleOnly->getName(), "Flower Bundle");
+    EXPECT_DOUBLE_EQ(bundleOnly->getPrice(), bundle.price);
+    EXPECT_EQ(history.materializeItem(orders[0], 4), nullptr);
+
+    delete bundleOnly;
+    delete reorder;
+    delete bundleOrder;
+    delete monsteraOrder;
+    delete corporateOrder;
+    history.close();
+    std::remove(path.c_str());
+}
+
+TEST(OrderHistoryTest, DropsATornTailAndKeepsAppending) {
+    std::string path = ::testing::TempDir() + "nursery_order_history_torn.bin";
+    std::remove(path.c_str());
+    FinalOrder* order = buildBundleOrder();
+
+    {
+        OrderHistory history;
+        ASSERT_TRUE(history.open(path));
+        EXPECT_TRUE(history.append(order, "REG-001"));
+        EXPECT_TRUE(history.append(order, "REG-001"));
+    }
+    std::streamoff goodBytes;
+    {
+        std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+        goodBytes = in.tellg();
+    }
+    {
+        // Half of a record header, as left by a crash mid-append
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::app);
+        const char torn[20] = {64, 0, 0, 0, 1};
+        out.write(torn, sizeof(torn));
+    }
+
+    OrderHistory history;
+    ASSERT_TRUE(history.open(path));
+    EXPECT_EQ(history.getOrderCount(), 2u);
+    EXPECT_TRUE(history.append(order, "WALK-001", 7));
+    EXPECT_EQ(history.getLatestOrder("WALK-001").getDay(), 7);
+    history.close();
+
+    ASSERT_TRUE(history.open(path));
+    EXPECT_EQ(history.getOrderCount(), 3u);
+    EXPECT_EQ(history.getLatestOrder("WALK-001").getSequence(), 2u);
+    EXPECT_EQ(history.getOrders("REG-001")[1].getTotal(), order->calculateTotalPrice());
+    history.close();
+
+    {
+        std::ifstream in(path.c_str(), std::ios::binary | std::ios::ate);
+        EXPECT_GT(static_cast<std::streamoff>(in.tellg()), goodBytes);
+    }
+    {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+        out << "not a history file";
+    }
+    EXPECT_FALSE(history.open(path));
+    EXPECT_FALSE(history.isOpen());
+    EXPECT_FALSE(history.getError().empty());
+
+    delete order;
+    std::remove(path.c_str());
+}
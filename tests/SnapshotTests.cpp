@@ -0,0 +1,391 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "include/NurserySnapshot.h"
+#include "include/NurseryCheckpoint.h"
+#include "include/NurseryMediator.h"
+#include "include/SalesFloor.h"
+#include "include/Greenhouse.h"
+#include "include/DerivedCustomers.h"
+#include "include/Plant.h"
+#include "include/FlowerCareStrategy.h"
+#include "include/MatureState.h"
+#include "include/SeedlingState.h"
+#include "include/CareScheduler.h"
+#include "include/WaterPlantCommand.h"
+#include "include/FinalOrder.h"
+#include "include/ConcreteOrder.h"
+#include "include/Leaf.h"
+#include "include/Decorator.h"
+#include "include/Flower.h"
+#include "include/RoseFactory.h"
+#include "include/CactusFactory.h"
+#include "include/MonsteraFactory.h"
+
+// ============ NurserySnapshot Tests ============
+
+namespace {
+
+void expectSameSnapshotPlant(const Plant* expected, const Plant* actual) {
+    ASSERT_NE(actual, nullptr);
+    EXPECT_EQ(expected->getName(), actual->getName());
+    EXPECT_EQ(expected->getID(), actual->getID());
+    EXPECT_EQ(expected->getAge(), actual->getAge());
+    EXPECT_EQ(expected->getWaterLevel(), actual->getWaterLevel());
+    EXPECT_EQ(expected->getNutrientLevel(), actual->getNutrientLevel());
+    EXPECT_EQ(expected->getSunlightExposure(), actual->getSunlightExposure());
+    EXPECT_EQ(expected->getHealthLevel(), actual->getHealthLevel());
+    EXPECT_EQ(expected->isReadyForSale(), actual->isReadyForSale());
+    EXPECT_DOUBLE_EQ(expected->getPrice(), actual->getPrice());
+    EXPECT_EQ(expected->getSpecies(), actual->getSpecies());
+    EXPECT_EQ(expected->getStrategy(), actual->getStrategy());
+    EXPECT_EQ(expected->getState()->getStateName(), actual->getState()->getStateName());
+}
+
+} // namespace
+
+TEST(NurserySnapshotTest, RoundTripRestoresTheWholeNursery) {
+    std::string path = ::testing::TempDir() + "nursery_roundtrip.snap";
+    NurseryMediator mediator;
+
+    NurseryContents saved;
+    saved.greenhouse = new Greenhouse(&mediator, 3, 4);
+    saved.salesFloor = new SalesFloor(&mediator, 2, 2);
+    saved.scheduler = new CareScheduler();
+    saved.day = 42;
+    mediator.registerColleague(saved.greenhouse);
+    mediator.registerColleague(saved.salesFloor);
+
+    RoseFactory roseFactory;
+    CactusFactory cactusFactory;
+    MonsteraFactory monsteraFactory;
+    Plant* rose = roseFactory.buildPlant(nullptr);
+    rose->advanceDays(9);
+    Plant* cactus = cactusFactory.buildPlant(nullptr);
+    cactus->setWaterLevel(12);
+    Plant* tulip = new Flower("Tulip", "TULIP_1", FlowerCareStrategy::getInstance(), new MatureState());
+    tulip->setPrice(19.5);
+    saved.greenhouse->addPlant(rose, 0, 1);
+    saved.greenhouse->addPlant(cactus, 2, 3);
+    saved.greenhouse->addPlant(tulip, 1, 0);
+
+    Plant* monstera = monsteraFactory.buildPlant(nullptr);
+    monstera->advanceDaysMaintained(40);
+    Plant* display = roseFactory.buildPlant(nullptr);
+    display->setReadyForSale(true);
+    saved.salesFloor->addPlantToDisplay(monstera, 0, 0);
+    saved.salesFloor->addPlantToDisplay(display, 1, 1);
+
+    RegularCustomer* customer = new RegularCustomer();
+    customer->setMediator(&mediator);
+    customer->setName("Ada");
+    customer->setBudget(250.0);
+    mediator.registerColleague(customer);
+    ASSERT_TRUE(customer->addPlantFromSalesFloorPosition(1, 1));
+    customer->decorateCartItemWithRibbon(0);
+    customer->decorateCartItemWithPot(0, "Blue");
+    saved.customers.push_back(customer);
+
+    saved.scheduler->addTask(new WaterPlantCommand(cactus));
+    saved.scheduler->addTask(new WaterPlantCommand(customer->getCart()[0]));
+    saved.scheduler->scheduleAfter(new WaterPlantCommand(rose), 3);
+
+    FinalOrder* order = new FinalOrder("Ada");
+    ConcreteOrder* bundle = new ConcreteOrder("Bundle");
+    bundle->add(new Leaf(roseFactory.buildPlant(nullptr), true));
+    bundle->add(new Leaf(cactusFactory.buildPlant(nullptr), true));
+    order->addOrder(bundle);
+    order->addOrder(new Leaf(monsteraFactory.buildPlant(nullptr), true));
+    saved.orders.push_back(order);
+
+    NurserySnapshot writer;
+    ASSERT_TRUE(writer.save(path, saved)) << writer.getError();
+    EXPECT_EQ(writer.getPlantCount(), 8u);
+    EXPECT_EQ(writer.getSkippedCommandCount(), 1u);
+
+    NurseryMediator restoredMediator;
+    NurseryContents restored;
+    restored.scheduler = new CareScheduler();
+    NurserySnapshot reader;
+    ASSERT_TRUE(reader.load(path, &restoredMediator, restored)) << reader.getError();
+    EXPECT_EQ(reader.getPlantCount(), 8u);
+    EXPECT_EQ(restored.day, 42);
+
+    ASSERT_NE(restored.greenhouse, nullptr);
+    EXPECT_EQ(restored.greenhouse->getRows(), 3);
+    EXPECT_EQ(restored.greenhouse->getColumns(), 4);
+    EXPECT_EQ(restored.greenhouse->getNumberOfPlants(), 3);
+    expectSameSnapshotPlant(rose, restored.greenhouse->getPlantAt(0, 1));
+    expectSameSnapshotPlant(cactus, restored.greenhouse->getPlantAt(2, 3));
+    expectSameSnapshotPlant(tulip, restored.greenhouse->getPlantAt(1, 0));
+    EXPECT_EQ(restored.greenhouse->getStateCount("Mature"), saved.greenhouse->getStateCount("Mature"));
+
+    ASSERT_NE(restored.salesFloor, nullptr);
+    EXPECT_EQ(restored.salesFloor->getNumberOfPlants(), 1);
+    expectSameSnapshotPlant(monstera, restored.salesFloor->getPlantAt(0, 0));
+
+    ASSERT_EQ(restored.customers.size(), 1u);
+    Customer* restoredCustomer = restored.customers[0];
+    EXPECT_EQ(restoredCustomer->getName(), "Ada");
+    EXPECT_DOUBLE_EQ(restoredCustomer->getBudget(), 250.0);
+    ASSERT_EQ(restoredCustomer->getCartSize(), 1);
+    EXPECT_TRUE(Decorator::isDecorated(restoredCustomer->getCart()[0]));
+    EXPECT_DOUBLE_EQ(restoredCustomer->getCart()[0]->getPrice(), customer->getCart()[0]->getPrice());
+    EXPECT_EQ(restoredCustomer->getCart()[0]->description(), customer->getCart()[0]->description());
+
+    const std::vector<Command*>& queue = restored.scheduler->getQueuedTasks();
+    ASSERT_EQ(queue.size(), 2u);
+    EXPECT_EQ(queue[0]->getTarget(), restored.greenhouse->getPlantAt(2, 3));
+    EXPECT_EQ(queue[1]->getTarget(), restoredCustomer->getCart()[0]);
+    restored.scheduler->runAll();
+    EXPECT_EQ(restored.greenhouse->getPlantAt(2, 3)->getWaterLevel(), 12 + SucculentTraits::WATER_GAIN);
+
+    ASSERT_EQ(restored.orders.size(), 1u);
+    EXPECT_EQ(restored.orders[0]->getCustomerName(), "Ada");
+    EXPECT_DOUBLE_EQ(restored.orders[0]->calculateTotalPrice(), order->calculateTotalPrice());
+    ASSERT_EQ(restored.orders[0]->getOrders().size(), 2u);
+    ConcreteOrder* restoredBundle = dynamic_cast<ConcreteOrder*>(restored.orders[0]->getOrders()[0]);
+    ASSERT_NE(restoredBundle, nullptr);
+    EXPECT_EQ(restoredBundle->getName(), "Bundle");
+    EXPECT_EQ(restoredBundle->getChildren().size(), 2u);
+
+    for (NurseryContents* contents : {&saved, &restored}) {
+        for (FinalOrder* finalOrder : contents->orders) {
+            delete finalOrder;
+        }
+        for (Customer* c : contents->customers) {
+            delete c;
+        }
+        delete contents->scheduler;
+        delete contents->greenhouse;
+        delete contents->salesFloor;
+    }
+    std::remove(path.c_str());
+}
+
+TEST(NurserySnapshotTest, RejectsDamagedFilesWithoutCreatingAnything) {
+    std::string path = ::testing::TempDir() + "nursery_damaged.snap";
+    NurseryMediator mediator;
+
+    NurseryContents saved;
+    saved.greenhouse = new Greenhouse(&mediator, 2, 2);
+    saved.greenhouse->addPlant(new Plant("Fern", "FERN_1", nullptr, new SeedlingState()), 1, 1);
+    NurserySnapshot snapshot;
+    ASSERT_TRUE(snapshot.save(path, saved));
+    delete saved.greenhouse;
+
+    std::string bytes;
+    {
+        std::ifstream in(path.c_str(), std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    auto rewrite = [&path](const std::string& data) {
+        std::ofstream out(path.c_str(), std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    };
+
+    // Truncated
+    rewrite(bytes.substr(0, bytes.size() - 3));
+    NurseryContents contents;
+    EXPECT_FALSE(snapshot.load(path, &mediator, contents));
+    EXPECT_FALSE(snapshot.getError().empty());
+    EXPECT_EQ(contents.greenhouse, nullptr);
+
+    // Wrong magic
+    std::string badMagic = bytes;
+    badMagic[0] = 'X';
+    rewrite(badMagic);
+    EXPECT_FALSE(snapshot.load(path, &mediator, contents));
+    EXPECT_EQ(contents.greenhouse, nullptr);
+
+    // Plant outside the greenhouse
+    std::string badCell = bytes;
+    SnapshotPlant record;
+    std::memcpy(&record, &badCell[sizeof(SnapshotHeader)], sizeof(record));
+    record.row = 7;
+    std::memcpy(&badCell[sizeof(SnapshotHeader)], &record, sizeof(record));
+    rewrite(badCell);
+    EXPECT_FALSE(snapshot.load(path, &mediator, contents));
+    EXPECT_EQ(contents.greenhouse, nullptr);
+
+    // Grids far larger than the plants in the file, including sizes that overflow int
+    const int32_t hugeSizes[][2] = {{65536, 65536}, {0x7fffffff, 0x7fffffff}, {2, 16777216}};
+    for (const auto& size : hugeSizes) {
+        std::string hugeGrid = bytes;
+        SnapshotHeader header;
+        std::memcpy(&header, &hugeGrid[0], sizeof(header));
+        header.salesFloorRows = size[0];
+        header.salesFloorCols = size[1];
+        std::memcpy(&hugeGrid[0], &header, sizeof(header));
+        rewrite(hugeGrid);
+        EXPECT_FALSE(snapshot.load(path, &mediator, contents));
+        EXPECT_FALSE(snapshot.getError().empty());
+        EXPECT_EQ(contents.salesFloor, nullptr);
+    }
+
+    // Intact file restores the generic plant under its own name
+    rewrite(bytes);
+    ASSERT_TRUE(snapshot.load(path, &mediator, contents)) << snapshot.getError();
+    ASSERT_NE(contents.greenhouse->getPlantAt(1, 1), nullptr);
+    EXPECT_EQ(contents.greenhouse->getPlantAt(1, 1)->getName(), "Fern");
+    EXPECT_EQ(contents.greenhouse->getPlantAt(1, 1)->getStrategy(), nullptr);
+
+    // Loading on top of existing objects is refused
+    EXPECT_FALSE(snapshot.load(path, &mediator, contents));
+
+    delete contents.greenhouse;
+    delete contents.salesFloor;
+    std::remove(path.c_str());
+}
+
+// ============ NurseryCheckpoint Tests ============
+
+namespace {
+
+void deleteNurseryContents(NurseryContents& contents) {
+    for (FinalOrder* finalOrder : contents.orders) {
+        delete finalOrder;
+    }
+    for (Customer* customer : contents.customers) {
+        delete customer;
+    }
+    delete contents.scheduler;
+    delete contents.greenhouse;
+    delete contents.salesFloor;
+    contents = NurseryContents();
+}
+
+bool fileExists(const std::string& path) {
+    std::ifstream in(path.c_str(), std::ios::binary);
+    return static_cast<bool>(in);
+}
+
+} // namespace
+
+TEST(NurseryCheckpointTest, DeltasHoldOnlyChangesAndRestoreReplaysTheChain) {
+    std::string path = ::testing::TempDir() + "nursery_chain.snap";
+    NurseryMediator mediator;
+    RoseFactory roseFactory;
+
+    NurseryContents live;
+    live.greenhouse = new Greenhouse(&mediator, 4, 4);
+    live.salesFloor = new SalesFloor(&mediator, 2, 2);
+    live.scheduler = new CareScheduler();
+    for (int i = 0; i < 6; i++) {
+        live.greenhouse->addPlant(roseFactory.buildPlant(nullptr), i / 4, i % 4);
+    }
+
+    NurseryCheckpoint checkpoint(path);
+    ASSERT_TRUE(checkpoint.checkpoint(live)) << checkpoint.getError();
+    EXPECT_TRUE(checkpoint.wasLastFull());
+    EXPECT_EQ(checkpoint.getLastPlantCount(), 6u);
+
+    // Nothing changed
+    ASSERT_TRUE(checkpoint.checkpoint(live)) << checkpoint.getError();
+    EXPECT_FALSE(checkpoint.wasLastFull());
+    EXPECT_EQ(checkpoint.getLastPlantCount(), 0u);
+
+    // One plant changes, one leaves, one arrives, a command targets an unchanged
+    // plant and an order is placed
+    Plant* watered = live.greenhouse->getPlantAt(0, 0);
+    watered->setWaterLevel(17);
+    Plant* sold = live.greenhouse->getPlantAt(0, 1);
+    ASSERT_TRUE(live.greenhouse->removePlant(sold));
+    delete sold;
+    Plant* arrived = roseFactory.buildPlant(nullptr);
+    live.greenhouse->addPlant(arrived, 3, 3);
+    live.scheduler->addTask(new WaterPlantCommand(live.greenhouse->getPlantAt(1, 1)));
+    FinalOrder* order = new FinalOrder("Ada");
+    order->addOrder(new Leaf(roseFactory.buildPlant(nullptr), true));
+    live.orders.push_back(order);
+
+    ASSERT_TRUE(checkpoint.checkpoint(live)) << checkpoint.getError();
+    EXPECT_FALSE(checkpoint.wasLastFull());
+    EXPECT_EQ(checkpoint.getLastPlantCount(), 4u);
+    EXPECT_EQ(checkpoint.getDeltaCount(), 2);
+
+    NurseryCheckpoint reader(path);
+    NurseryContents restored;
+    restored.scheduler = new CareScheduler();
+    ASSERT_TRUE(reader.restore(&mediator, restored)) << reader.getError();
+    EXPECT_EQ(reader.getDeltaCount(), 2);
+    EXPECT_EQ(restored.greenhouse->getNumberOfPlants(), 6);
+    EXPECT_EQ(restored.greenhouse->getPlantAt(0, 1), nullptr);
+    expectSameSnapshotPlant(watered, restored.greenhouse->getPlantAt(0, 0));
+    expectSameSnapshotPlant(arrived, restored.greenhouse->getPlantAt(3, 3));
+    expectSameSnapshotPlant(live.greenhouse->getPlantAt(1, 0), restored.greenhouse->getPlantAt(1, 0));
+    ASSERT_EQ(restored.scheduler->getQueuedTasks().size(), 1u);
+    EXPECT_EQ(restored.scheduler->getQueuedTasks()[0]->getTarget(), restored.greenhouse->getPlantAt(1, 1));
+    ASSERT_EQ(restored.orders.size(), 1u);
+    EXPECT_DOUBLE_EQ(restored.orders[0]->calculateTotalPrice(), order->calculateTotalPrice());
+
+    // Compacting folds the chain into the base without changing what it restores
+    ASSERT_TRUE(reader.compact()) << reader.getError();
+    EXPECT_EQ(reader.getDeltaCount(), 0);
+    EXPECT_FALSE(fileExists(reader.getDeltaPath(1)));
+    NurseryContents compacted;
+    ASSERT_TRUE(reader.restore(&mediator, compacted)) << reader.getError();
+    EXPECT_EQ(compacted.greenhouse->getNumberOfPlants(), 6);
+    expectSameSnapshotPlant(watered, compacted.greenhouse->getPlantAt(0, 0));
+    EXPECT_EQ(compacted.greenhouse->getPlantAt(0, 1), nullptr);
+    EXPECT_EQ(compacted.orders.size(), 1u);
+
+    deleteNurseryContents(live);
+    deleteNurseryContents(restored);
+    deleteNurseryContents(compacted);
+    std::remove(path.c_str());
+}
+
+TEST(NurseryCheckpointTest, RebasesAfterTheIntervalAndIgnoresStaleDeltas) {
+    std::string path = ::testing::TempDir() + "nursery_rebase.snap";
+    NurseryMediator mediator;
+    CactusFactory cactusFactory;
+
+    NurseryContents live;
+    live.greenhouse = new Greenhouse(&mediator, 2, 2);
+    live.greenhouse->addPlant(cactusFactory.buildPlant(nullptr), 0, 0);
+    Plant* cactus = live.greenhouse->getPlantAt(0, 0);
+
+    NurseryCheckpoint checkpoint(path, 2);
+    ASSERT_TRUE(checkpoint.checkpoint(live));
+    for (int day = 1; day <= 2; day++) {
+        cactus->dailyUpdate();
+        ASSERT_TRUE(checkpoint.checkpoint(live));
+        EXPECT_FALSE(checkpoint.wasLastFull());
+        EXPECT_EQ(checkpoint.getLastPlantCount(), 1u);
+    }
+    EXPECT_TRUE(fileExists(checkpoint.getDeltaPath(2)));
+
+    std::string stale;
+    {
+        std::ifstream in(checkpoint.getDeltaPath(1).c_str(), std::ios::binary);
+        stale.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    cactus->dailyUpdate();
+    ASSERT_TRUE(checkpoint.checkpoint(live));
+    EXPECT_TRUE(checkpoint.wasLastFull());
+    EXPECT_EQ(checkpoint.getDeltaCount(), 0);
+    EXPECT_FALSE(fileExists(checkpoint.getDeltaPath(1)));
+
+    // A delta from the old chain, as a crash between rebasing and cleaning up would leave
+    {
+        std::ofstream out(checkpoint.getDeltaPath(1).c_str(), std::ios::binary | std::ios::trunc);
+        out.write(stale.data(), static_cast<std::streamsize>(stale.size()));
+    }
+    NurseryCheckpoint reader(path);
+    NurseryContents restored;
+    ASSERT_TRUE(reader.restore(&mediator, restored)) << reader.getError();
+    EXPECT_EQ(reader.getDeltaCount(), 0);
+    expectSameSnapshotPlant(cactus, restored.greenhouse->getPlantAt(0, 0));
+
+    deleteNurseryContents(live);
+    deleteNurseryContents(restored);
+    std::remove(checkpoint.getDeltaPath(1).c_str());
+    std::remove(path.c_str());
+}
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
+#include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 #include "include/PlantState.h"
 #include "include/SeedlingState.h"
@@ -10,6 +13,14 @@
 #include "include/DeadState.h"
 
 #include "include/Plant.h"
+#include "include/Flower.h"
+#include "include/Succulent.h"
+#include "include/Vegetable.h"
+#include "include/OtherPlant.h"
+#include "include/CareScheduler.h"
+#include "include/ThresholdMonitor.h"
+#include "include/SimulationCalendar.h"
+#include "include/SpeciesKernel.h"
 #include "include/CareStrategy.h"
 #include "include/FlowerCareStrategy.h"
 #include "include/SucculentCareStrategy.h"
@@ -22,7 +33,7 @@ protected:
     
     void SetUp() override {
         testPlant = new Plant("TestPlant", "TEST-001", 
-                             new FlowerCareStrategy(), 
+                             FlowerCareStrategy::getInstance(), 
                              new SeedlingState());
         testPlant->setPrice(50.0);
     }
@@ -53,6 +64,20 @@ TEST_F(StateTest, SeedlingStateInitialization) {
     EXPECT_EQ(state->getStateName(), "Seedling");
 }
 
+TEST_F(StateTest, StatesReportTheirLifecycleStage) {
+    SeedlingState seedling;
+    GrowingState growing;
+    MatureState mature;
+    FloweringState flowering;
+    DeadState dead;
+
+    EXPECT_EQ(seedling.getStage(), LifecycleStage::Seedling);
+    EXPECT_EQ(growing.getStage(), LifecycleStage::Growing);
+    EXPECT_EQ(mature.getStage(), LifecycleStage::Mature);
+    EXPECT_EQ(flowering.getStage(), LifecycleStage::Flowering);
+    EXPECT_EQ(dead.getStage(), LifecycleStage::Dead);
+}
+
 TEST_F(StateTest, SeedlingStateNotReadyForSale) {
     testPlant->getState()->handleChange(testPlant);
     
@@ -326,7 +351,7 @@ TEST_F(StateTest, CompleteLifeCycleTransitions) {
 
 TEST_F(StateTest, PlantCanDieAtAnyStage) {
     // Test dying from Seedling (needs health < 20)
-    Plant* plant1 = new Plant("P1", "P1", new FlowerCareStrategy(), new SeedlingState());
+    Plant* plant1 = new Plant("P1", "P1", FlowerCareStrategy::getInstance(), new SeedlingState());
     plant1->setWaterLevel(5);
     plant1->setNutrientLevel(5);
     plant1->setSunlightExposure(5);
@@ -336,7 +361,7 @@ TEST_F(StateTest, PlantCanDieAtAnyStage) {
     delete plant1;
     
     // Test dying from Growing (needs health < 20)
-    Plant* plant2 = new Plant("P2", "P2", new FlowerCareStrategy(), new GrowingState());
+    Plant* plant2 = new Plant("P2", "P2", FlowerCareStrategy::getInstance(), new GrowingState());
     plant2->setWaterLevel(5);
     plant2->setNutrientLevel(5);
     plant2->setSunlightExposure(5);
@@ -346,7 +371,7 @@ TEST_F(StateTest, PlantCanDieAtAnyStage) {
     delete plant2;
     
     // Test dying from Mature (needs health < 10)
-    Plant* plant3 = new Plant("P3", "P3", new FlowerCareStrategy(), new MatureState());
+    Plant* plant3 = new Plant("P3", "P3", FlowerCareStrategy::getInstance(), new MatureState());
     plant3->setWaterLevel(0);
     plant3->setNutrientLevel(0);
     plant3->setSunlightExposure(0);
@@ -429,7 +454,7 @@ TEST_F(StateTest, StateHandleChangeDoesNotCrash) {
     
     // Test with valid plant
     Plant* validPlant = new Plant("Valid", "V001", 
-                                  new FlowerCareStrategy(), 
+                                  FlowerCareStrategy::getInstance(), 
                                   new SeedlingState());
     validPlant->setWaterLevel(60);
     validPlant->setNutrientLevel(60);
@@ -521,8 +546,470 @@ TEST_F(StateTest, StateTransitionsDoNotLeakMemory) {
 
 TEST_F(StateTest, PlantDestructorCleansUpState) {
     Plant* tempPlant = new Plant("Temp", "T001", 
-                                  new FlowerCareStrategy(), 
+                                  FlowerCareStrategy::getInstance(), 
                                   new SeedlingState());
     
     EXPECT_NO_THROW(delete tempPlant);
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// FAST-FORWARD TESTS
+// ============================================================================
+
+namespace {
+
+PlantState* makeState(int index) {
+    switch (index) {
+        case 0: return new SeedlingState();
+        case 1: return new GrowingState();
+        case 2: return new MatureState();
+        case 3: return new FloweringState();
+        default: return new DeadState();
+    }
+}
+
+Plant* makeSpecies(int index, int stateIndex) {
+    switch (index) {
+        case 0: return new Flower("Rose", "FF-1", FlowerCareStrategy::getInstance(), makeState(stateIndex));
+        case 1: return new Succulent("Cactus", "FF-2", SucculentCareStrategy::getInstance(), makeState(stateIndex));
+        case 2: return new Vegetable("Potato", "FF-3", VegetableCareStrategy::getInstance(), makeState(stateIndex));
+        default: return new OtherPlant("Monstera", "FF-4", OtherPlantCareStrategy::getInstance(), makeState(stateIndex));
+    }
+}
+
+void expectSamePlant(const Plant* expected, const Plant* actual) {
+    EXPECT_EQ(expected->getAge(), actual->getAge());
+    EXPECT_EQ(expected->getWaterLevel(), actual->getWaterLevel());
+    EXPECT_EQ(expected->getNutrientLevel(), actual->getNutrientLevel());
+    EXPECT_EQ(expected->getSunlightExposure(), actual->getSunlightExposure());
+    EXPECT_EQ(expected->getHealthLevel(), actual->getHealthLevel());
+    EXPECT_EQ(expected->isReadyForSale(), actual->isReadyForSale());
+    EXPECT_DOUBLE_EQ(expected->getPrice(), actual->getPrice());
+    EXPECT_EQ(expected->getState()->getStateName(), actual->getState()->getStateName());
+}
+
+class CountingObserver : public PlantObserver {
+public:
+    int updates = 0;
+    void update(Plant*) override { updates++; }
+};
+
+} // namespace
+
+TEST(FastForwardTest, AdvanceDaysMatchesDailyUpdates) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    const int waters[] = {100, 45};
+    const int nutrients[] = {100, 30};
+    const int sunlights[] = {100, 60, 15};
+    const int ages[] = {0, 34, 49};
+    const int spans[] = {3, 16, 70};
+
+    for (int species = 0; species < 4; species++) {
+        for (int stateIndex = 0; stateIndex < 5; stateIndex++) {
+            for (int water : waters) {
+                for (int nutrient : nutrients) {
+                    for (int sunlight : sunlights) {
+                        for (int age : ages) {
+                            for (int days : spans) {
+                                Plant* iterated = makeSpecies(species, stateIndex);
+                                Plant* forwarded = makeSpecies(species, stateIndex);
+                                for (Plant* plant : {iterated, forwarded}) {
+                                    plant->setWaterLevel(water);
+                                    plant->setNutrientLevel(nutrient);
+                                    plant->setSunlightExposure(sunlight);
+                                    plant->setPrice(8.0);
+                                    for (int i = 0; i < age; i++) {
+                                        plant->incrementAge();
+                                    }
+                                    plant->updateHealth();
+                                }
+
+                                for (int i = 0; i < days; i++) {
+                                    iterated->dailyUpdate();
+                                }
+                                forwarded->advanceDays(days);
+
+                                SCOPED_TRACE("species " + std::to_string(species) +
+                                             " state " + std::to_string(stateIndex) +
+                                             " vitals " + std::to_string(water) + "/" +
+                                             std::to_string(nutrient) + "/" + std::to_string(sunlight) +
+                                             " age " + std::to_string(age) + " days " + std::to_string(days));
+                                expectSamePlant(iterated, forwarded);
+
+                                delete iterated;
+                                delete forwarded;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout.rdbuf(saved);
+}
+
+TEST(FastForwardTest, AdvanceDaysMaintainedMatchesHeldVitals) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    // Held at 90/90/90 the plant keeps alternating between Mature and Flowering after day 50
+    const int vitals[][3] = {{80, 80, 70}, {90, 90, 90}, {30, 20, 10}};
+    for (const auto& held : vitals) {
+        for (int days : {6, 35, 54, 201}) {
+            Plant* iterated = makeSpecies(3, 0);
+            Plant* forwarded = makeSpecies(3, 0);
+            iterated->setPrice(2.0);
+            forwarded->setPrice(2.0);
+
+            for (int i = 0; i < days; i++) {
+                iterated->setWaterLevel(held[0]);
+                iterated->setNutrientLevel(held[1]);
+                iterated->setSunlightExposure(held[2]);
+                iterated->updateHealth();
+                iterated->incrementAge();
+                iterated->getState()->handleChange(iterated);
+            }
+
+            forwarded->setWaterLevel(held[0]);
+            forwarded->setNutrientLevel(held[1]);
+            forwarded->setSunlightExposure(held[2]);
+            forwarded->updateHealth();
+            forwarded->advanceDaysMaintained(days);
+
+            SCOPED_TRACE("held " + std::to_string(held[0]) + " days " + std::to_string(days));
+            expectSamePlant(iterated, forwarded);
+
+            delete iterated;
+            delete forwarded;
+        }
+    }
+
+    std::cout.rdbuf(saved);
+}
+
+TEST(FastForwardTest, AdvanceDaysNotifiesObserversEachDay) {
+    Plant* plant = makeSpecies(0, 0);
+    CountingObserver observer;
+    plant->attach(&observer);
+
+    plant->advanceDays(9);
+
+    EXPECT_EQ(observer.updates, 9);
+    EXPECT_EQ(plant->getAge(), 9);
+
+    plant->detach(&observer);
+    delete plant;
+}
+
+TEST(FastForwardTest, AdvanceDaysIgnoresNonPositiveSpans) {
+    Plant* plant = makeSpecies(2, 0);
+
+    plant->advanceDays(0);
+    plant->advanceDays(-5);
+    plant->advanceDaysMaintained(-1);
+
+    EXPECT_EQ(plant->getAge(), 0);
+    EXPECT_EQ(plant->getWaterLevel(), 100);
+    EXPECT_EQ(plant->getState()->getStateName(), "Seedling");
+
+    delete plant;
+}
+
+// ============================================================================
+// SIMULATION CALENDAR TESTS
+// ============================================================================
+
+namespace {
+
+std::vector<Plant*> makeNursery(int count) {
+    std::vector<Plant*> plants;
+    for (int i = 0; i < count; i++) {
+        Plant* plant = makeSpecies(i % 4, (i / 4) % 4);
+        plant->setWaterLevel(100 - (i * 7) % 60);
+        plant->setNutrientLevel(100 - (i * 11) % 70);
+        plant->setSunlightExposure(30 + (i * 13) % 70);
+        plant->setPrice(5.0 + i % 20);
+        for (int day = 0; day < (i * 5) % 45; day++) {
+            plant->incrementAge();
+        }
+        plant->updateHealth();
+        plants.push_back(plant);
+    }
+    return plants;
+}
+
+void addCalendarRules(ThresholdMonitor& monitor) {
+    monitor.addStandardThresholds();
+    monitor.addThreshold(PlantVital::Health, ThresholdComparator::AtOrBelow, 35, CareAction::Fertilize);
+    monitor.addThreshold(PlantVital::Water, ThresholdComparator::AtOrAbove, 90, CareAction::AdjustSunlight);
+}
+
+} // namespace
+
+TEST(SimulationCalendarTest, MatchesDayByDayLoop) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    std::vector<Plant*> daily = makeNursery(48);
+    std::vector<Plant*> evented = makeNursery(48);
+    CareScheduler dailyScheduler;
+    CareScheduler eventScheduler;
+    ThresholdMonitor dailyMonitor(&dailyScheduler);
+    ThresholdMonitor eventMonitor(&eventScheduler);
+    addCalendarRules(dailyMonitor);
+    addCalendarRules(eventMonitor);
+
+    SimulationCalendar calendar(&eventMonitor);
+    for (Plant* plant : evented) {
+        calendar.addPlant(plant);
+    }
+
+    int dailyFired = 0;
+    int eventFired = 0;
+    const int steps[] = {1, 4, 30, 25, 60};
+    for (int step : steps) {
+        for (int day = 0; day < step; day++) {
+            for (Plant* plant : daily) {
+                plant->dailyUpdate();
+            }
+            dailyFired += dailyMonitor.scan(daily);
+        }
+        eventFired += calendar.advance(step);
+
+        // Care for a few plants in between, as the scheduled commands would
+        for (int i = 0; i < 48; i += 9) {
+            calendar.materialize(evented[i]);
+            daily[i]->setWaterLevel(100);
+            evented[i]->setWaterLevel(100);
+            daily[i]->updateHealth();
+            evented[i]->updateHealth();
+            calendar.reschedule(evented[i]);
+        }
+    }
+    calendar.materializeAll();
+
+    std::cout.rdbuf(saved);
+
+    EXPECT_EQ(calendar.getCurrentDay(), 120);
+    EXPECT_EQ(dailyFired, eventFired);
+    EXPECT_GT(dailyFired, 0);
+    EXPECT_LT(calendar.getProcessedEventCount(), 48LL * 120);
+    for (size_t i = 0; i < daily.size(); i++) {
+        SCOPED_TRACE("plant " + std::to_string(i));
+        expectSamePlant(daily[i], evented[i]);
+        EXPECT_EQ(daily[i]->getThresholdMask(), evented[i]->getThresholdMask());
+    }
+
+    for (size_t i = 0; i < daily.size(); i++) {
+        delete daily[i];
+        delete evented[i];
+    }
+}
+
+TEST(SimulationCalendarTest, PlantsWithObserversAreProcessedDaily) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    Plant* watched = makeSpecies(1, 2);
+    Plant* quiet = makeSpecies(1, 2);
+    CountingObserver observer;
+    watched->attach(&observer);
+
+    SimulationCalendar calendar;
+    calendar.addPlant(watched);
+    calendar.addPlant(quiet);
+    calendar.advance(30);
+
+    std::cout.rdbuf(saved);
+
+    EXPECT_EQ(observer.updates, 30);
+    EXPECT_LT(calendar.getProcessedEventCount(), 2 * 30);
+
+    // Reading the quiet plant brings it up to the calendar's day
+    EXPECT_EQ(watched->getAge(), 30);
+    EXPECT_EQ(quiet->getAge(), 30);
+
+    watched->detach(&observer);
+    delete watched;
+    delete quiet;
+}
+
+TEST(SimulationCalendarTest, RemovedPlantIsMaterializedAndForgotten) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    Plant* plant = makeSpecies(3, 0);
+    SimulationCalendar calendar;
+    calendar.addPlant(plant);
+    calendar.addPlant(plant);
+    EXPECT_EQ(calendar.getPlantCount(), 1);
+
+    calendar.advance(5);
+    calendar.removePlant(plant);
+    calendar.advance(100);
+
+    std::cout.rdbuf(saved);
+
+    EXPECT_EQ(calendar.getPlantCount(), 0);
+    EXPECT_EQ(plant->getAge(), 5);
+
+    delete plant;
+}
+
+TEST(SimulationCalendarTest, TrackedPlantsCatchUpBeforeTheyAreChanged) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    Plant* daily = makeSpecies(2, 0);
+    Plant* tracked = makeSpecies(2, 0);
+    Plant* doomed = makeSpecies(2, 0);
+    SimulationCalendar calendar;
+    calendar.addPlant(tracked);
+    calendar.addPlant(doomed);
+    delete doomed;
+    EXPECT_EQ(calendar.getPlantCount(), 1);
+
+    calendar.advance(4);
+    for (int day = 0; day < 4; day++) {
+        daily->dailyUpdate();
+    }
+    // Watering without materialize() must not let the old days run on the new level
+    daily->setWaterLevel(100);
+    tracked->setWaterLevel(100);
+    daily->updateHealth();
+    tracked->updateHealth();
+    calendar.reschedule(tracked);
+
+    calendar.advance(3);
+    for (int day = 0; day < 3; day++) {
+        daily->dailyUpdate();
+    }
+
+    std::cout.rdbuf(saved);
+
+    expectSamePlant(daily, tracked);
+    delete daily;
+    delete tracked;
+}
+
+// ============================================================================
+// SPECIES KERNEL TESTS
+// ============================================================================
+
+TEST(SpeciesKernelTest, SpeciesUseTheirTraits) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    const PlantSpecies expected[] = {
+        PlantSpecies::Flower, PlantSpecies::Succulent, PlantSpecies::Vegetable, PlantSpecies::Other
+    };
+    const double prices[] = {
+        FlowerTraits::BASE_PRICE, SucculentTraits::BASE_PRICE,
+        VegetableTraits::BASE_PRICE, OtherPlantTraits::BASE_PRICE
+    };
+    for (int species = 0; species < 4; species++) {
+        Plant* plant = makeSpecies(species, 0);
+        EXPECT_EQ(plant->getSpecies(), expected[species]);
+        EXPECT_DOUBLE_EQ(plant->getPrice(), prices[species]);
+        delete plant;
+    }
+
+    Plant* generic = new Plant("Generic", "SK-1", nullptr, new SeedlingState());
+    EXPECT_EQ(generic->getSpecies(), PlantSpecies::Custom);
+    delete generic;
+
+    std::cout.rdbuf(saved);
+}
+
+TEST(SpeciesKernelTest, BatchUpdateMatchesDailyUpdates) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    // Runs of each species, interleaved plants and a Custom plant in between
+    const int layout[] = {0, 0, 0, 1, 1, 2, 3, 3, 0, 1, 2, 3, -1, 2, 2, 0};
+    std::vector<Plant*> iterated;
+    std::vector<Plant*> batched;
+    for (size_t i = 0; i < sizeof(layout) / sizeof(layout[0]); i++) {
+        for (std::vector<Plant*>* plants : {&iterated, &batched}) {
+            Plant* plant = layout[i] < 0
+                ? new Plant("Generic", "SK-2", nullptr, makeState(static_cast<int>(i) % 5))
+                : makeSpecies(layout[i], static_cast<int>(i) % 5);
+            plant->setWaterLevel(40 + static_cast<int>(i) * 3);
+            plant->setNutrientLevel(90 - static_cast<int>(i) * 2);
+            plant->setSunlightExposure(70);
+            plant->updateHealth();
+            plants->push_back(plant);
+        }
+    }
+
+    CountingObserver iteratedObserver;
+    CountingObserver batchedObserver;
+    iterated[4]->attach(&iteratedObserver);
+    batched[4]->attach(&batchedObserver);
+
+    for (int day = 0; day < 60; day++) {
+        for (Plant* plant : iterated) {
+            plant->dailyUpdate();
+        }
+        dailyUpdateBatch(batched.data(), batched.size());
+    }
+
+    EXPECT_EQ(batchedObserver.updates, 60);
+    EXPECT_EQ(iteratedObserver.updates, batchedObserver.updates);
+    for (size_t i = 0; i < iterated.size(); i++) {
+        SCOPED_TRACE("plant " + std::to_string(i));
+        expectSamePlant(iterated[i], batched[i]);
+        delete iterated[i];
+        delete batched[i];
+    }
+
+    std::cout.rdbuf(saved);
+}
+
+TEST(SpeciesKernelTest, CareBatchMatchesStrategyMethods) {
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    CareStrategy* strategies[] = {
+        FlowerCareStrategy::getInstance(), SucculentCareStrategy::getInstance(),
+        VegetableCareStrategy::getInstance(), OtherPlantCareStrategy::getInstance()
+    };
+    const CareAction actions[] = {CareAction::Water, CareAction::Fertilize, CareAction::AdjustSunlight};
+
+    for (int species = 0; species < 4; species++) {
+        for (CareAction action : actions) {
+            std::vector<Plant*> single;
+            std::vector<Plant*> batched;
+            for (int level : {0, 20, 55, 95}) {
+                for (std::vector<Plant*>* plants : {&single, &batched}) {
+                    Plant* plant = makeSpecies(species, 1);
+                    plant->setWaterLevel(level);
+                    plant->setNutrientLevel(level);
+                    plant->setSunlightExposure(level);
+                    plants->push_back(plant);
+                }
+            }
+
+            for (Plant* plant : single) {
+                switch (action) {
+                    case CareAction::Water:          strategies[species]->water(plant); break;
+                    case CareAction::Fertilize:      strategies[species]->fertilize(plant); break;
+                    case CareAction::AdjustSunlight: strategies[species]->adjustSunlight(plant); break;
+                }
+            }
+            strategies[species]->careForBatch(action, batched.data(), batched.size());
+
+            for (size_t i = 0; i < single.size(); i++) {
+                SCOPED_TRACE("species " + std::to_string(species) + " plant " + std::to_string(i));
+                expectSamePlant(single[i], batched[i]);
+                delete single[i];
+                delete batched[i];
+            }
+        }
+    }
+
+    std::cout.rdbuf(saved);
+}